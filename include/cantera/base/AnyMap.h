@@ -224,6 +224,20 @@ public:
     //! @see AnyMap::applyUnits
     void applyUnits(const UnitSystem& units);
 
+    //! Estimate of the memory used by the keys and values stored in this
+    //! AnyMap and its children, in bytes. Metadata shared with other AnyMap
+    //! objects is not included.
+    size_t memoryUsage() const;
+
+    //! Remove all entries from the cache of previously-parsed input files
+    //! used by fromYamlFile(). Objects created from these files are not
+    //! affected.
+    static void clearCache();
+
+    //! Estimate of the memory used by the cache of previously-parsed input
+    //! files, in bytes
+    static size_t cacheMemoryUsage();
+
 private:
     std::string demangle(const std::type_info& type) const;
 
@@ -509,6 +523,20 @@ public:
      */
     void applyUnits(const UnitSystem& units);
 
+    //! Estimate of the memory used by the keys and values stored in this
+    //! AnyMap and its children, in bytes. Metadata shared with other AnyMap
+    //! objects is not included.
+    size_t memoryUsage() const;
+
+    //! Remove all entries from the cache of previously-parsed input files
+    //! used by fromYamlFile(). Objects created from these files are not
+    //! affected.
+    static void clearCache();
+
+    //! Estimate of the memory used by the cache of previously-parsed input
+    //! files, in bytes
+    static size_t cacheMemoryUsage();
+
 private:
     //! The stored data
     std::unordered_map<std::string, AnyValue> m_data;
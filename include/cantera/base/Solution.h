@@ -61,6 +61,43 @@ public:
         return m_transport;
     }
 
+    //! Create a new Solution object with the same definition as this one
+    /*!
+     * The Species and Reaction objects are shared with this Solution and the
+     * fits of the transport properties are copied from it, instead of being
+     * created from the input file again, which makes this much faster than
+     * newSolution(). The new object has its own state, initially a copy of
+     * the state of this Solution, and its own coefficient and work arrays,
+     * and can be used concurrently with this Solution, e.g. by a different
+     * thread, as long as neither is modified. The shared Species and Reaction
+     * objects must not be modified in place while either Solution is in use.
+     * See
+     * newPhase(const ThermoPhase&), newKinetics(std::vector<ThermoPhase*>&,
+     * Kinetics&) and newTransportMgr(const Transport&, thermo_t*) for the
+     * requirements and for the information which is not copied.
+     *
+     * Solutions which include adjacent phases cannot be cloned.
+     */
+    shared_ptr<Solution> clone() const;
+
+    //! Release the input data held by the ThermoPhase and Kinetics objects.
+    /*!
+     * See ThermoPhase::compact() and Kinetics::compact() for the information
+     * which is no longer available afterwards.
+     *
+     * @param clearInputCache  If `true`, also clear the cache of parsed input
+     *     files with AnyMap::clearCache(). This cache is shared by all objects
+     *     in the process, and other objects created from the same files later
+     *     need to parse them again.
+     */
+    void compact(bool clearInputCache=false);
+
+    //! Estimates of the memory used by the ThermoPhase and Kinetics objects
+    //! and by the cache of parsed input files (entry `input-cache`), in
+    //! bytes. See ThermoPhase::getMemoryUsage() and
+    //! Kinetics::getMemoryUsage() for the other entries.
+    std::map<std::string, size_t> memoryUsage() const;
+
 protected:
     shared_ptr<ThermoPhase> m_thermo;  //!< ThermoPhase manager
     shared_ptr<Kinetics> m_kinetics;  //!< Kinetics manager
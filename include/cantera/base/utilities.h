@@ -530,6 +530,35 @@ const U& getValue(const std::map<T, U>& m, const T& key, const U& default_val) {
     return (iter == m.end()) ? default_val : iter->second;
 }
 
+//! Estimate of the memory used by a std::map with string keys, in bytes.
+/*!
+ * Each entry is counted as a separately-allocated tree node holding the key,
+ * the value and three pointers.
+ */
+template <class U>
+size_t mapMemoryUsage(const std::map<std::string, U>& m) {
+    size_t usage = sizeof(m);
+    for (const auto& item : m) {
+        usage += 4 * sizeof(void*) + sizeof(item) + item.first.capacity();
+    }
+    return usage;
+}
+
+//! Estimate of the memory used by a std::map with keys and values that do
+//! not allocate memory of their own, in bytes.
+template <class T, class U>
+size_t mapMemoryUsage(const std::map<T, U>& m) {
+    return sizeof(m) + m.size() * (4 * sizeof(void*)
+        + sizeof(typename std::map<T, U>::value_type));
+}
+
+//! Estimate of the memory used by a std::vector, in bytes, not including
+//! memory allocated by its elements
+template <class T>
+size_t vectorMemoryUsage(const std::vector<T>& v) {
+    return sizeof(v) + v.capacity() * sizeof(T);
+}
+
 }
 
 #endif
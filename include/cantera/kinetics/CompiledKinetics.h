@@ -0,0 +1,143 @@
+/**
+ * @file CompiledKinetics.h
+ * Generation and loading of mechanism-specific kinetics kernels (see
+ * \link Cantera::CompiledKinetics CompiledKinetics\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_COMPILEDKINETICS_H
+#define CT_COMPILEDKINETICS_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Kinetics;
+
+//! Write C++ source code for kinetics kernels specialized to a mechanism.
+/*!
+ * The generated source contains the stoichiometry, rate parameters, third-body
+ * efficiencies and falloff parameters of the reactions in `kin` as constant
+ * data, with the calculation of the enhanced third-body concentrations, the
+ * falloff functions, the concentration products and the species production
+ * rates unrolled for each reaction. The equilibrium constants and the rate
+ * constants of P-log and Chebyshev reactions are evaluated by the generic
+ * kinetics manager and passed to the generated functions.
+ *
+ * The source is compiled into a shared library, e.g. with
+ *
+ *     c++ -O2 -shared -fPIC mech_kinetics.cpp -o libmech_kinetics.so
+ *
+ * which can be loaded by GasKinetics::loadCompiledKinetics(). The
+ * generated source does not depend on any Cantera headers.
+ *
+ * Only elementary, three-body, falloff, chemically activated, P-log and
+ * Chebyshev reactions with Lindemann, Troe or SRI falloff functions are
+ * supported.
+ *
+ * @param kin  Kinetics manager containing the reactions
+ * @param out  Stream the source code is written to
+ * @ingroup kinetics
+ */
+void generateCompiledKinetics(Kinetics& kin, std::ostream& out);
+
+//! Write the source code generated by generateCompiledKinetics() to the file
+//! `filename`.
+void generateCompiledKinetics(Kinetics& kin, const std::string& filename);
+
+//! A shared library containing kinetics kernels created by
+//! generateCompiledKinetics().
+/*!
+ * The library is loaded when the object is constructed and released when it
+ * is destroyed. The functions of this class wrap the functions exported by
+ * the library.
+ * @ingroup kinetics
+ */
+class CompiledKinetics
+{
+public:
+    //! Load the shared library at `path`
+    explicit CompiledKinetics(const std::string& path);
+    ~CompiledKinetics();
+    CompiledKinetics(const CompiledKinetics&) = delete;
+    CompiledKinetics& operator=(const CompiledKinetics&) = delete;
+
+    //! Path of the shared library
+    const std::string& path() const {
+        return m_path;
+    }
+
+    size_t nSpecies() const {
+        return m_nSpecies;
+    }
+
+    size_t nReactions() const {
+        return m_nReactions;
+    }
+
+    //! Length of the work array used by updateTemp() and updateROP()
+    size_t workSize() const {
+        return m_workSize;
+    }
+
+    //! Names of the species, in the order of the kinetics species index
+    const std::vector<std::string>& speciesNames() const {
+        return m_speciesNames;
+    }
+
+    //! Evaluate the temperature-dependent rate constants and falloff
+    //! parameters, which are stored in `work`
+    void updateTemp(double T, double logT, double* work) const {
+        m_updateTemp(T, logT, work);
+    }
+
+    //! Evaluate the rates of progress
+    /*!
+     * @param work     Work array as set by updateTemp()
+     * @param conc     Activity concentrations of the species
+     * @param ctot     Total molar concentration
+     * @param kf       Forward rate constants. Only the entries for P-log and
+     *                 Chebyshev reactions are used.
+     * @param rkcn     Reciprocals of the equilibrium constants, or zero for
+     *                 irreversible reactions
+     * @param perturb  Multipliers of the forward rate constants
+     * @param[out] ropf  Forward rates of progress
+     * @param[out] ropr  Reverse rates of progress
+     * @param[out] ropnet  Net rates of progress
+     */
+    void updateROP(const double* work, const double* conc, double ctot,
+                   const double* kf, const double* rkcn, const double* perturb,
+                   double* ropf, double* ropr, double* ropnet) const {
+        m_updateROP(work, conc, ctot, kf, rkcn, perturb, ropf, ropr, ropnet);
+    }
+
+    //! Evaluate the net production rates of the species from the net rates of
+    //! progress
+    void getNetProductionRates(const double* ropnet, double* wdot) const {
+        m_getNetProductionRates(ropnet, wdot);
+    }
+
+protected:
+    //! Look up the function `name` exported by the library
+    void* symbol(const std::string& name);
+
+    std::string m_path;
+    void* m_handle;
+    size_t m_nSpecies;
+    size_t m_nReactions;
+    size_t m_workSize;
+    std::vector<std::string> m_speciesNames;
+
+    void (*m_updateTemp)(double, double, double*);
+    void (*m_updateROP)(const double*, const double*, double, const double*,
+                        const double*, const double*, double*, double*,
+                        double*);
+    void (*m_getNetProductionRates)(const double*, double*);
+};
+
+}
+
+#endif
@@ -11,12 +11,21 @@
 #include "reaction_defs.h"
 #include "FalloffFactory.h"
 #include "cantera/base/global.h"
+#include "cantera/base/utilities.h"
+#include <limits>
 
 namespace Cantera
 {
 
 /**
  *  A falloff manager that implements any set of falloff functions.
+ *
+ *  Falloff functions of the built-in types (Lindemann, Troe and SRI) are
+ *  grouped by type, and the parameters of each group are stored in contiguous
+ *  arrays. The falloff functions of each group are then evaluated in a single
+ *  loop without virtual function calls. Falloff functions of any other type
+ *  are evaluated through the Falloff interface.
+ *
  *  @ingroup falloffGroup
  */
 class FalloffMgr
@@ -38,26 +47,67 @@ public:
      */
     void install(size_t rxn, int reactionType, shared_ptr<Falloff> f) {
         m_rxn.push_back(rxn);
-        m_offset.push_back(m_worksize);
-        m_worksize += f->workSize();
         m_falloff.push_back(f);
         m_reactionType.push_back(reactionType);
         m_indices[rxn] = m_falloff.size()-1;
+        m_offset.push_back(0);
+        m_F.push_back(0.0);
+        addToGroup(m_falloff.size()-1);
     }
 
     /*!
      * Replace an existing falloff function calculator
      *
      * @param rxn   External reaction index
-     * @param f     New falloff function, of the same kind as the existing one
+     * @param f     New falloff function. If it is of a different kind than
+     *     the existing one, the required work array size may change.
      */
     void replace(size_t rxn, shared_ptr<Falloff> f) {
         m_falloff[m_indices[rxn]] = f;
+        // regroup all reactions, since the new function may belong to a
+        // different group
+        m_simple.clear();
+        m_troe.clear();
+        m_sri.clear();
+        m_generic.clear();
+        m_troe_A.clear();
+        m_troe_rT3.clear();
+        m_troe_rT1.clear();
+        m_troe_T2.clear();
+        m_sri_a.clear();
+        m_sri_b.clear();
+        m_sri_c.clear();
+        m_sri_d.clear();
+        m_sri_e.clear();
+        m_worksize = 0;
+        for (size_t i = 0; i < m_falloff.size(); i++) {
+            addToGroup(i);
+        }
     }
 
     //! Size of the work array required to store intermediate results.
     size_t workSize() {
-        return m_worksize;
+        return m_worksize + m_troe.size() + 2 * m_sri.size();
+    }
+
+    //! Estimate of the memory used by this object, in bytes. Each falloff
+    //! function is counted as an object holding its parameters.
+    size_t memoryUsage() const {
+        size_t usage = vectorMemoryUsage(m_rxn) + vectorMemoryUsage(m_falloff)
+            + vectorMemoryUsage(m_loc)
+            + vectorMemoryUsage(m_offset) + vectorMemoryUsage(m_reactionType)
+            + mapMemoryUsage(m_indices) + vectorMemoryUsage(m_F)
+            + vectorMemoryUsage(m_simple) + vectorMemoryUsage(m_troe)
+            + vectorMemoryUsage(m_sri) + vectorMemoryUsage(m_generic)
+            + vectorMemoryUsage(m_troe_A) + vectorMemoryUsage(m_troe_rT3)
+            + vectorMemoryUsage(m_troe_rT1) + vectorMemoryUsage(m_troe_T2)
+            + vectorMemoryUsage(m_sri_a) + vectorMemoryUsage(m_sri_b)
+            + vectorMemoryUsage(m_sri_c) + vectorMemoryUsage(m_sri_d)
+            + vectorMemoryUsage(m_sri_e);
+        for (const auto& f : m_falloff) {
+            usage += sizeof(Falloff) + f->nParameters() * sizeof(double);
+        }
+        return usage;
     }
 
     /**
@@ -67,7 +117,36 @@ public:
      * @param work Work array. Must be dimensioned at least workSize().
      */
     void updateTemp(doublereal t, doublereal* work) {
-        for (size_t i = 0; i < m_rxn.size(); i++) {
+        double recipT = 1.0 / t;
+
+        // Troe: log10 of F_cent
+        double* troeWork = work + m_worksize;
+        for (size_t n = 0; n < m_troe.size(); n++) {
+            double A = m_troe_A[n];
+            double Fcent = (1.0 - A) * exp(-t*m_troe_rT3[n])
+                           + A * exp(-t*m_troe_rT1[n]);
+            if (m_troe_T2[n]) {
+                Fcent += exp(-m_troe_T2[n] * recipT);
+            }
+            troeWork[n] = std::max(Fcent, SmallNumber);
+        }
+        for (size_t n = 0; n < m_troe.size(); n++) {
+            troeWork[n] = log10(troeWork[n]);
+        }
+
+        // SRI: a*exp(-b/T) + exp(-T/c) and d*T^e
+        double* sriWork = troeWork + m_troe.size();
+        double logT = log(t);
+        for (size_t n = 0; n < m_sri.size(); n++) {
+            double X = m_sri_a[n] * exp(-m_sri_b[n] * recipT);
+            if (m_sri_c[n] != 0.0) {
+                X += exp(-t / m_sri_c[n]);
+            }
+            sriWork[2*n] = X;
+            sriWork[2*n+1] = m_sri_d[n] * exp(m_sri_e[n] * logT);
+        }
+
+        for (size_t i : m_generic) {
             m_falloff[i]->updateTemp(t, work + m_offset[i]);
         }
     }
@@ -77,26 +156,256 @@ public:
      * replace each entry by the value of the falloff function.
      */
     void pr_to_falloff(doublereal* values, const doublereal* work) {
+        // Values of the falloff function F for each reaction
+        for (size_t i : m_simple) {
+            m_F[i] = 1.0;
+        }
+
+        const double* troeWork = work + m_worksize;
+        for (size_t n = 0; n < m_troe.size(); n++) {
+            m_F[m_troe[n]] = log10(std::max(values[m_rxn[m_troe[n]]],
+                                            SmallNumber));
+        }
+        for (size_t n = 0; n < m_troe.size(); n++) {
+            double lpr = m_F[m_troe[n]];
+            double cc = -0.4 - 0.67 * troeWork[n];
+            double nn = 0.75 - 1.27 * troeWork[n];
+            double f1 = (lpr + cc) / (nn - 0.14 * (lpr + cc));
+            m_F[m_troe[n]] = troeWork[n] / (1.0 + f1 * f1);
+        }
+        const double ln10 = 2.302585092994045684;
+        for (size_t n = 0; n < m_troe.size(); n++) {
+            m_F[m_troe[n]] = exp(m_F[m_troe[n]] * ln10); // 10^lgf
+        }
+
+        const double* sriWork = troeWork + m_troe.size();
+        for (size_t n = 0; n < m_sri.size(); n++) {
+            m_F[m_sri[n]] = log10(std::max(values[m_rxn[m_sri[n]]],
+                                           SmallNumber));
+        }
+        for (size_t n = 0; n < m_sri.size(); n++) {
+            double lpr = m_F[m_sri[n]];
+            double xx = 1.0 / (1.0 + lpr * lpr);
+            m_F[m_sri[n]] = pow(sriWork[2*n], xx) * sriWork[2*n+1];
+        }
+
+        for (size_t i : m_generic) {
+            m_F[i] = m_falloff[i]->F(values[m_rxn[i]], work + m_offset[i]);
+        }
+
         for (size_t i = 0; i < m_rxn.size(); i++) {
             double pr = values[m_rxn[i]];
-            if (m_reactionType[i] == FALLOFF_RXN) {
-                // Pr / (1 + Pr) * F
-                values[m_rxn[i]] *=
-                    m_falloff[i]->F(pr, work + m_offset[i]) /(1.0 + pr);
-            } else {
-                // 1 / (1 + Pr) * F
-                values[m_rxn[i]] =
-                    m_falloff[i]->F(pr, work + m_offset[i]) /(1.0 + pr);
+            // Pr / (1 + Pr) * F for falloff reactions, and 1 / (1 + Pr) * F
+            // for chemically activated reactions
+            double factor = (m_reactionType[i] == FALLOFF_RXN) ? pr : 1.0;
+            values[m_rxn[i]] = factor * m_F[i] / (1.0 + pr);
+        }
+    }
+
+    /**
+     * Version of pr_to_falloff() which only replaces the entries `values[i]`
+     * for which `active[i]` is non-zero. The other entries are not modified.
+     */
+    void pr_to_falloff(double* values, const double* work,
+                       const std::vector<char>& active) {
+        const double* troeWork = work + m_worksize;
+        const double ln10 = 2.302585092994045684;
+        for (size_t n = 0; n < m_troe.size(); n++) {
+            size_t i = m_troe[n];
+            if (active[m_rxn[i]]) {
+                double lpr = log10(std::max(values[m_rxn[i]], SmallNumber));
+                double cc = -0.4 - 0.67 * troeWork[n];
+                double nn = 0.75 - 1.27 * troeWork[n];
+                double f1 = (lpr + cc) / (nn - 0.14 * (lpr + cc));
+                m_F[i] = exp(troeWork[n] / (1.0 + f1 * f1) * ln10);
             }
         }
+
+        const double* sriWork = troeWork + m_troe.size();
+        for (size_t n = 0; n < m_sri.size(); n++) {
+            size_t i = m_sri[n];
+            if (active[m_rxn[i]]) {
+                double lpr = log10(std::max(values[m_rxn[i]], SmallNumber));
+                double xx = 1.0 / (1.0 + lpr * lpr);
+                m_F[i] = pow(sriWork[2*n], xx) * sriWork[2*n+1];
+            }
+        }
+
+        for (size_t i : m_simple) {
+            m_F[i] = 1.0;
+        }
+        for (size_t i : m_generic) {
+            if (active[m_rxn[i]]) {
+                m_F[i] = m_falloff[i]->F(values[m_rxn[i]], work + m_offset[i]);
+            }
+        }
+
+        for (size_t i = 0; i < m_rxn.size(); i++) {
+            if (active[m_rxn[i]]) {
+                double pr = values[m_rxn[i]];
+                double factor = (m_reactionType[i] == FALLOFF_RXN) ? pr : 1.0;
+                values[m_rxn[i]] = factor * m_F[i] / (1.0 + pr);
+            }
+        }
+    }
+
+    /**
+     * Derivatives of the natural logarithms of the values calculated by
+     * pr_to_falloff(), i.e. of Pr/(1+Pr)*F for falloff reactions and of
+     * 1/(1+Pr)*F for chemically activated reactions.
+     *
+     * @param t  Temperature [K]
+     * @param pr  Reduced pressure for each falloff reaction
+     * @param work  Work array filled by updateTemp() at temperature `t`
+     * @param dlogPr  Output array of the derivatives with respect to ln(Pr)
+     * @param dT  Output array of the derivatives with respect to temperature
+     *     at constant Pr
+     */
+    void getDerivatives(double t, const double* pr, const double* work,
+                        double* dlogPr, double* dT) {
+        const double ln10 = 2.302585092994045684;
+        double recipT = 1.0 / t;
+        // derivatives of ln(F)
+        for (size_t i : m_simple) {
+            dlogPr[m_rxn[i]] = 0.0;
+            dT[m_rxn[i]] = 0.0;
+        }
+
+        const double* troeWork = work + m_worksize;
+        for (size_t n = 0; n < m_troe.size(); n++) {
+            size_t j = m_rxn[m_troe[n]];
+            // log10(F) = Fc / (1 + f1^2), with f1 = u / (nn - 0.14 u),
+            // u = log10(Pr) + cc, and cc and nn depending on Fc only
+            double Fc = troeWork[n];
+            bool clipped = (pr[j] < SmallNumber);
+            double lpr = log10(std::max(pr[j], SmallNumber));
+            double u = lpr - 0.4 - 0.67 * Fc;
+            double nn = 0.75 - 1.27 * Fc;
+            double D = nn - 0.14 * u;
+            double f1 = u / D;
+            double s = 1.0 / (1.0 + f1 * f1);
+            double dlogF_df1 = -2.0 * Fc * f1 * s * s;
+            dlogPr[j] = clipped ? 0.0 : dlogF_df1 * nn / (D * D);
+
+            // dependence on T through Fcent
+            double A = m_troe_A[n];
+            double e3 = exp(-t*m_troe_rT3[n]);
+            double e1 = exp(-t*m_troe_rT1[n]);
+            double Fcent = (1.0 - A) * e3 + A * e1;
+            double dFcent = 0.0;
+            if (e3 != 0.0) {
+                dFcent -= (1.0 - A) * m_troe_rT3[n] * e3;
+            }
+            if (e1 != 0.0) {
+                dFcent -= A * m_troe_rT1[n] * e1;
+            }
+            if (m_troe_T2[n]) {
+                double e2 = exp(-m_troe_T2[n] * recipT);
+                Fcent += e2;
+                dFcent += m_troe_T2[n] * recipT * recipT * e2;
+            }
+            if (Fcent <= SmallNumber) {
+                dT[j] = 0.0;
+                continue;
+            }
+            double df1_dFc = (-0.67 * D + (1.27 - 0.14 * 0.67) * u) / (D * D);
+            double dlogF_dFc = s + dlogF_df1 * df1_dFc;
+            dT[j] = dlogF_dFc * dFcent / Fcent; // d(ln F)/dT
+        }
+
+        const double* sriWork = troeWork + m_troe.size();
+        for (size_t n = 0; n < m_sri.size(); n++) {
+            size_t j = m_rxn[m_sri[n]];
+            // ln(F) = ln(X) / (1 + log10(Pr)^2) + ln(d) + e*ln(T)
+            double lpr = log10(std::max(pr[j], SmallNumber));
+            double xx = 1.0 / (1.0 + lpr * lpr);
+            double X = sriWork[2*n];
+            dlogPr[j] = (pr[j] < SmallNumber) ? 0.0
+                        : -2.0 * lpr * xx * xx * log(X) / ln10;
+            double dX = m_sri_a[n] * m_sri_b[n] * recipT * recipT
+                        * exp(-m_sri_b[n] * recipT);
+            if (m_sri_c[n] != 0.0) {
+                dX -= exp(-t / m_sri_c[n]) / m_sri_c[n];
+            }
+            dT[j] = xx * dX / X + m_sri_e[n] * recipT;
+        }
+
+        if (!m_generic.empty()) {
+            // falloff functions of other types are differentiated
+            // numerically, without modifying the work array
+            double dt = 1e-6 * t;
+            vector_fp work2(work, work + m_worksize);
+            for (size_t i : m_generic) {
+                m_falloff[i]->updateTemp(t + dt, work2.data() + m_offset[i]);
+            }
+            for (size_t i : m_generic) {
+                size_t j = m_rxn[i];
+                double dpr = 1e-6 * pr[j] + SmallNumber;
+                double F0 = m_falloff[i]->F(pr[j], work + m_offset[i]);
+                double F1 = m_falloff[i]->F(pr[j] + dpr, work + m_offset[i]);
+                double F2 = m_falloff[i]->F(pr[j], work2.data() + m_offset[i]);
+                dlogPr[j] = (F1 - F0) / dpr * pr[j] / F0;
+                dT[j] = (F2 - F0) / dt / F0;
+            }
+        }
+
+        // derivatives of the logarithms of the blending functions
+        for (size_t i = 0; i < m_rxn.size(); i++) {
+            size_t j = m_rxn[i];
+            double factor = (m_reactionType[i] == FALLOFF_RXN) ? 1.0 : 0.0;
+            dlogPr[j] += factor - pr[j] / (1.0 + pr[j]);
+        }
     }
 
 protected:
+    //! Add falloff function `i` to the group for its type
+    void addToGroup(size_t i) {
+        const Falloff& f = *m_falloff[i];
+        double params[5];
+        std::string type = f.type();
+        if (type == "Lindemann") {
+            m_simple.push_back(i);
+        } else if (type == "Troe") {
+            m_troe.push_back(i);
+            f.getParameters(params);
+            m_troe_A.push_back(params[0]);
+            m_troe_rT3.push_back(inverse(params[1]));
+            m_troe_rT1.push_back(inverse(params[2]));
+            m_troe_T2.push_back(params[3]);
+        } else if (type == "SRI") {
+            m_sri.push_back(i);
+            f.getParameters(params);
+            m_sri_a.push_back(params[0]);
+            m_sri_b.push_back(params[1]);
+            m_sri_c.push_back(params[2]);
+            m_sri_d.push_back(params[3]);
+            m_sri_e.push_back(params[4]);
+        } else {
+            m_generic.push_back(i);
+            m_offset[i] = m_worksize;
+            m_worksize += m_falloff[i]->workSize();
+        }
+    }
+
+    //! Reciprocal of a Troe temperature parameter, where a value of zero
+    //! means that the corresponding term is omitted
+    static double inverse(double T) {
+        if (std::abs(T) < SmallNumber) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return 1.0 / T;
+    }
+
     std::vector<size_t> m_rxn;
     std::vector<shared_ptr<Falloff> > m_falloff;
     FalloffFactory* m_factory;
     vector_int m_loc;
+
+    //! Offsets into the work array of the falloff functions in #m_generic
     std::vector<vector_fp::difference_type> m_offset;
+
+    //! Size of the work array used by the falloff functions in #m_generic.
+    //! The work arrays of the Troe and SRI groups follow this part.
     size_t m_worksize;
 
     //! Distinguish between falloff and chemically activated reactions
@@ -104,6 +413,21 @@ protected:
 
     //! map of external reaction index to local index
     std::map<size_t, size_t> m_indices;
+
+    //! Falloff function values, indexed by local index
+    vector_fp m_F;
+
+    //! @name Falloff functions grouped by type
+    //! Local indices of the falloff functions of each type, and the
+    //! parameters of the Troe and SRI functions in the same order.
+    //! @{
+    std::vector<size_t> m_simple;
+    std::vector<size_t> m_troe;
+    std::vector<size_t> m_sri;
+    std::vector<size_t> m_generic;
+    vector_fp m_troe_A, m_troe_rT3, m_troe_rT1, m_troe_T2;
+    vector_fp m_sri_a, m_sri_b, m_sri_c, m_sri_d, m_sri_e;
+    //! @}
 };
 }
 
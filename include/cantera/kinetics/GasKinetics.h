@@ -12,11 +12,15 @@
 #include "BulkKinetics.h"
 #include "ThirdBodyCalc.h"
 #include "FalloffMgr.h"
+#include "CompiledKinetics.h"
+#include "TemperatureTable.h"
 #include "Reaction.h"
 
 namespace Cantera
 {
 
+class IdealGasPhase;
+
 /**
  * Kinetics manager for elementary gas-phase chemistry. This kinetics manager
  * implements standard mass-action reaction rate expressions for low-density
@@ -46,6 +50,277 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
     virtual void getFwdRateConstants(doublereal* kfwd);
 
+    //! @}
+    //! @name Species Production Rates
+    //! @{
+
+    using Kinetics::getNetProductionRates;
+    virtual void getNetProductionRates(doublereal* net);
+
+    //! Species net production rates for multiple states.
+    /*!
+     * The states are processed in tiles of several states at a time. Within
+     * a tile, species and reaction quantities are stored with the states as
+     * the fastest-varying index, so that the evaluation of the Arrhenius rate
+     * constants, equilibrium constants, concentration products and
+     * production rates can be vectorized over the states. Quantities that
+     * depend on the thermodynamic model, as well as the pressure-dependent
+     * rates, are evaluated for one state at a time.
+     *
+     * If adaptive chemistry or quasi-steady-state species are enabled, the
+     * active subset and the QSS concentrations depend on each state, and
+     * the states are instead evaluated one at a time with
+     * getNetProductionRates(double*).
+     *
+     * @see Kinetics::getNetProductionRates(size_t, const double*,
+     *      const double*, const double*, double*)
+     */
+    virtual void getNetProductionRates(size_t n, const double* T,
+                                       const double* P, const double* Y,
+                                       double* wdot);
+
+    //! @}
+    //! @name Derivatives of Rates of Progress
+    //! @{
+
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddC();
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddC();
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddC();
+
+    //! Derivatives of the net rates of progress with respect to temperature,
+    //! at constant density and composition.
+    /*!
+     * If the phase is an IdealGasPhase, the derivatives of the Arrhenius
+     * rate constants, the falloff functions and the equilibrium constants
+     * are evaluated analytically, and the P-log and Chebyshev rate constants
+     * are differentiated numerically without modifying the phase. Otherwise,
+     * the rates of progress are differentiated numerically, and the state of
+     * the phase is restored afterwards. The concentrations of QSS species
+     * are held constant.
+     */
+    virtual void getNetRatesOfProgress_ddT(double* drop);
+
+    //! @}
+    //! @name Incremental Updates of Rates of Progress
+    //! @{
+
+    //! Enable or disable incremental updates of the rates of progress.
+    /*!
+     * When enabled, the rates of progress and net production rates of the
+     * most recent state at which all reactions were evaluated are kept as a
+     * reference. If the temperature and the pressure-dependent rate
+     * constants have not changed since then, only the reactions involving
+     * species whose concentrations differ from the reference state, and the
+     * three-body and falloff reactions whose third-body concentrations
+     * differ, are re-evaluated. The net production rates are then obtained
+     * by adding the contributions of these reactions to the reference
+     * values. This is efficient when states differ from a common reference
+     * state in only a few species, e.g. when finite difference Jacobians
+     * are computed by perturbing one species at a time.
+     *
+     * If more than half of the reactions would be re-evaluated, all
+     * reactions are evaluated and the result becomes the new reference.
+     */
+    void setIncrementalROP(bool incremental);
+
+    //! True if incremental updates of the rates of progress are enabled
+    bool incrementalROP() const {
+        return m_incrementalROP;
+    }
+
+    //! @}
+    //! @name Dynamic Adaptive Chemistry
+    //! @{
+
+    //! Enable dynamic adaptive chemistry, where the rates of progress and the
+    //! net production rates are evaluated only for a subset of the reactions
+    //! that is selected for the local state.
+    /*!
+     * The active subset is selected using the directed relation graph with
+     * error propagation (DRGEP) method. The direct interaction coefficient
+     * of species *A* with species *B* is
+     * \f[
+     *     r_{AB} = \frac{|\sum_i \nu_{A,i} \omega_i \delta_{B,i}|}
+     *                   {\max(P_A, C_A)}
+     * \f]
+     * where \f$ \nu_{A,i} \f$ is the net stoichiometric coefficient of *A* in
+     * reaction *i*, \f$ \omega_i \f$ is the net rate of progress, \f$
+     * \delta_{B,i} \f$ is 1 if *B* is a reactant or product of reaction *i*
+     * and 0 otherwise, and \f$ P_A \f$ and \f$ C_A \f$ are the production
+     * and consumption rates of *A*. The overall interaction coefficient of
+     * each species is the largest product of direct interaction coefficients
+     * along any path in the graph starting from one of the target species.
+     * Species with an overall interaction coefficient of at least
+     * `threshold` are active, as are the reactions whose reactants and
+     * products are all active species. The rates of progress of all other
+     * reactions are zero.
+     *
+     * The subset is selected from the rates of progress of all reactions the
+     * first time the rates of progress are evaluated, and again whenever the
+     * state differs from the state at which it was last selected by more
+     * than a relative change of `rtol` in the temperature or pressure, or by
+     * more than `rtol * X_k + atol` in the mole fraction `X_k` of any
+     * species.
+     *
+     * The temperature-dependent rate constants and the equilibrium constants
+     * are still evaluated for all reactions, while the enhanced third-body
+     * concentrations, falloff functions and concentration products are
+     * evaluated only for the active reactions. Incremental updates and
+     * compiled kernels are not used while adaptive chemistry is enabled, and
+     * the multi-state version of getNetProductionRates() evaluates one state
+     * at a time. The derivatives of the rates of progress are those of the
+     * active subset.
+     *
+     * @param targets  Names of the target species
+     * @param threshold  Minimum overall interaction coefficient of active
+     *     species
+     * @param rtol  Relative tolerance on changes in the state
+     * @param atol  Absolute tolerance on changes in the mole fractions
+     */
+    void setAdaptiveChemistry(const std::vector<std::string>& targets,
+                              double threshold=1e-3, double rtol=0.05,
+                              double atol=1e-9);
+
+    //! Disable dynamic adaptive chemistry and evaluate all reactions
+    void disableAdaptiveChemistry();
+
+    //! True if dynamic adaptive chemistry is enabled
+    bool adaptiveChemistry() const {
+        return m_adaptive;
+    }
+
+    //! Indices of the reactions in the current active subset. All reactions
+    //! are active if adaptive chemistry is disabled.
+    std::vector<size_t> activeReactions();
+
+    //! Indices of the species in the current active subset. All species are
+    //! active if adaptive chemistry is disabled.
+    std::vector<size_t> activeSpecies();
+
+    //! Number of times the active subset has been selected since adaptive
+    //! chemistry was enabled
+    size_t nAdaptiveSelections() const {
+        return m_nActiveSelections;
+    }
+
+    //! @}
+    //! @name Quasi-Steady-State Species
+    //! @{
+
+    //! Treat the specified species as quasi-steady-state (QSS) species.
+    /*!
+     * The concentrations of QSS species are not taken from the phase, but
+     * are determined in updateROP() such that the production rate of each
+     * QSS species equals its consumption rate. The resulting nonlinear
+     * system is solved by Jacobi iteration, with one Newton step for the
+     * concentration of each QSS species per iteration, starting from the
+     * concentrations found for the previous state. Only the reactions
+     * involving QSS species are re-evaluated during the iteration. The
+     * reaction orders are assumed to be equal to the stoichiometric
+     * coefficients when computing the Newton steps. A CanteraError is thrown
+     * if the iteration does not converge.
+     *
+     * The net production rates of the QSS species are zero. The Reactor
+     * classes and the StFlow domain remove the QSS species from their state
+     * vectors, holding their mass fractions constant, so the QSS species
+     * must be specified before these objects are initialized. The
+     * enhanced third-body concentrations use the concentrations of the QSS
+     * species in the phase. Incremental updates of the rates of progress and
+     * compiled kernels for the rates of progress are not used while QSS
+     * species are defined. The derivatives of the rates of progress treat
+     * the concentrations of the QSS species as independent variables.
+     *
+     * @param names  Names of the QSS species. An empty list disables the
+     *     QSS treatment.
+     */
+    void setQuasiSteadySpecies(const std::vector<std::string>& names);
+
+    //! Indices of the quasi-steady-state species
+    const std::vector<size_t>& quasiSteadySpecies() const {
+        return m_qss;
+    }
+
+    //! Get the concentrations of the quasi-steady-state species at the
+    //! current state, in the order given by quasiSteadySpecies() [kmol/m^3]
+    void getQuasiSteadyConcentrations(double* conc);
+
+    //! @}
+    //! @name Tabulated Rate Coefficients
+    //! @{
+
+    //! Evaluate the temperature-dependent parts of the rate coefficients by
+    //! interpolation in a table.
+    /*!
+     * The table contains the logarithms of the rate constants of the
+     * elementary and three-body reactions and of the low- and high-pressure
+     * limit rate constants of the falloff reactions, the
+     * temperature-dependent terms of the falloff functions, and, if the
+     * phase is an IdealGasPhase, the logarithms of the equilibrium
+     * constants. These are interpolated with cubic polynomials in the
+     * inverse temperature, on a grid fine enough for the interpolation error
+     * of each quantity to be less than `rtol` (see TemperatureTable), which
+     * for the logarithmic quantities corresponds to a relative error of the
+     * rate and equilibrium constants. The grid is split at the midpoint
+     * temperatures of the species thermo parameterizations. Outside the
+     * temperature range of the table, all quantities are calculated
+     * directly. The pressure-dependent rates of P-log and Chebyshev
+     * reactions are not tabulated. With the default arguments, the table for
+     * GRI-Mech 3.0 has 240 intervals in 5 segments with 734 values per grid
+     * point, or 1.4 MB.
+     *
+     * Tables with identical contents are shared by all GasKinetics objects,
+     * i.e. they are stored only once for kinetics managers created from the
+     * same mechanism. The table is discarded if reactions are added or
+     * modified, and must be created again if the thermodynamic data of the
+     * species are modified.
+     *
+     * @param Tmin  Lowest temperature of the table [K]
+     * @param Tmax  Highest temperature of the table [K]
+     * @param rtol  Tolerance for the interpolation error
+     */
+    void enableRateTables(double Tmin=300.0, double Tmax=3000.0,
+                          double rtol=1e-6);
+
+    //! Stop using tabulated rate coefficients
+    void disableRateTables();
+
+    //! The table used for the rate coefficients, or an empty pointer if
+    //! tabulation is disabled
+    shared_ptr<const TemperatureTable> rateTable() const {
+        return m_rateTable;
+    }
+
+    //! @}
+    //! @name Compiled Kinetics Kernels
+    //! @{
+
+    //! Use kinetics kernels from a shared library to evaluate the rates of
+    //! progress and the net production rates.
+    /*!
+     * The library is created by compiling the source code written by
+     * generateCompiledKinetics() for the reactions of this kinetics manager.
+     * When it is loaded, the library is checked for consistency with this
+     * kinetics manager by comparing the species, and the rates of progress
+     * and net production rates calculated with and without the library at
+     * several states. A CanteraError is thrown if these differ.
+     *
+     * The compiled kernels are used by updateROP() and
+     * getNetProductionRates(double*), in which case incremental updates of
+     * the rates of progress are not used. The library is unloaded if
+     * reactions are added or modified.
+     *
+     * @param path  Path of the shared library
+     */
+    void loadCompiledKinetics(const std::string& path);
+
+    //! Stop using compiled kinetics kernels and unload the library
+    void unloadCompiledKinetics();
+
+    //! True if compiled kinetics kernels are used
+    bool hasCompiledKinetics() const {
+        return bool(m_compiled);
+    }
+
     //! @}
     //! @name Reaction Mechanism Setup Routines
     //! @{
@@ -53,6 +328,9 @@ public:
     virtual bool addReaction(shared_ptr<Reaction> r);
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
     virtual void invalidateCache();
+    virtual void setMultiplier(size_t i, double f);
+    virtual void compact();
+    virtual void getMemoryUsage(std::map<std::string, size_t>& usage) const;
     //@}
 
     void updateROP();
@@ -68,13 +346,76 @@ public:
     virtual void update_rates_C();
 
 protected:
-    //! Reaction index of each falloff reaction
+    //! Determine the internal order of the reactions, and install the rate
+    //! expressions of all reactions in the rate managers in that order.
+    //! Called before rates are evaluated after reactions have been added.
+    void installRates();
+
+    //! Install the rate expressions of the falloff reaction with index `i`
+    //! as the next falloff reaction
+    void installFalloffReaction(size_t i, FalloffReaction& r);
+
+    //! Install the third-body efficiencies of the three-body reaction with
+    //! index `i` as the next three-body reaction
+    void installThreeBodyReaction(size_t i, ThreeBodyReaction& r);
+
+    //! True if the rate managers are set up for the current reactions
+    bool m_rates_ok;
+
+    //! @name Internal reaction order
+    //!
+    //! The rate constants and rates of progress are evaluated with the
+    //! reactions in an internal order, in which they are grouped into
+    //! contiguous blocks by rate type (elementary, three-body, falloff,
+    //! chemically activated, P-log and Chebyshev) and within each block by
+    //! reversibility (reversible first). The rate managers write the rate
+    //! constants to #m_rfn in this order, and the three-body and falloff
+    //! reactions are installed in this order, so that the values of their
+    //! work arrays belong to consecutive positions. The stoichiometric
+    //! managers are copied with the positions as reaction indices. The main
+    //! loops of updateROP() and of the multi-state getNetProductionRates()
+    //! then run over dense ranges of positions, and the rates of progress
+    //! are permuted to the public order at the end of updateROP(). All other
+    //! per-reaction arrays, and all reaction indices of the public interface
+    //! and of the base classes, follow the order in which the reactions were
+    //! added.
+    //! @{
+
+    //! Reaction index of each position in the internal order
+    std::vector<size_t> m_rxnOrder;
+
+    //! Position of each reaction in the internal order
+    std::vector<size_t> m_rxnPosition;
+
+    size_t m_3bStart; //!< Position of the first three-body reaction
+    size_t m_fallStart; //!< Position of the first falloff reaction
+
+    //! Stoichiometric managers, with the positions as reaction indices
+    StoichManagerN m_sortedReactantStoich;
+    StoichManagerN m_sortedRevProductStoich;
+    StoichManagerN m_sortedIrrevProductStoich;
+
+    vector_fp m_sortedPerturb; //!< Reaction rate multipliers
+    vector_fp m_sortedRkcn; //!< Reciprocals of the equilibrium constants
+    vector_fp m_sortedRopf; //!< Forward rates of progress
+    vector_fp m_sortedRopr; //!< Reverse rates of progress
+    vector_fp m_sortedRopnet; //!< Net rates of progress
+    //! @}
+
+    //! Reaction index of each falloff reaction. The falloff reactions are
+    //! installed in the internal order, i.e. the falloff reaction with index
+    //! `n` has the position `m_fallStart + n`, and they are followed by the
+    //! chemically activated reactions.
     std::vector<size_t> m_fallindx;
 
     //! Map of reaction index to falloff reaction index (i.e indices in
     //! #m_falloff_low_rates and #m_falloff_high_rates)
     std::map<size_t, size_t> m_rfallindx;
 
+    //! Number of falloff reactions which are not chemically activated, i.e.
+    //! the index of the first chemically activated reaction in #m_fallindx
+    size_t m_nfalloff;
+
     //! Rate expressions for falloff reactions at the low-pressure limit
     Rate1<Arrhenius> m_falloff_low_rates;
 
@@ -83,6 +424,9 @@ protected:
 
     FalloffMgr m_falloffn;
 
+    //! Enhanced third-body concentrations of the three-body reactions. The
+    //! reactions are installed in the internal order, i.e. the three-body
+    //! reaction with index `n` has the position `m_3bStart + n`.
     ThirdBodyCalc m_3b_concm;
     ThirdBodyCalc m_falloff_concm;
 
@@ -101,14 +445,184 @@ protected:
     vector_fp falloff_work;
     vector_fp concm_3b_values;
     vector_fp concm_falloff_values;
+
+    //! Reduced pressure of each falloff reaction, replaced by its rate
+    //! constant in updateFalloffRates()
+    vector_fp m_falloff_pr;
     //!@}
 
-    void processFalloffReactions();
+    //! @name Reference state for incremental updates
+    //! @{
+    bool m_incrementalROP; //!< True if incremental updates are enabled
+    bool m_ROP_ref_ok; //!< True if the reference state is valid
+
+    //! Reactions whose rates of progress depend on each species
+    std::vector<std::vector<size_t>> m_speciesReactions;
+
+    vector_fp m_conc_ref; //!< Species concentrations
+    vector_fp m_concm_3b_ref; //!< Third-body concentrations
+    vector_fp m_concm_falloff_ref; //!< Falloff third-body concentrations
+    vector_fp m_kf_ref; //!< Forward rate constants
+    vector_fp m_ropf_ref; //!< Forward rates of progress
+    vector_fp m_ropr_ref; //!< Reverse rates of progress
+    vector_fp m_ropnet_ref; //!< Net rates of progress
+    vector_fp m_wdot_ref; //!< Net production rates
+
+    //! Reactions re-evaluated for the current state
+    std::vector<size_t> m_modified;
+    std::vector<char> m_isModified; //!< Flags for reactions in #m_modified
+    vector_fp m_rop_work; //!< Work array of length nReactions()
+    //! @}
+
+    //! @name Dynamic adaptive chemistry
+    //! @{
+    bool m_adaptive; //!< True if adaptive chemistry is enabled
+    bool m_active_ok; //!< True if the active subset is valid
+    std::vector<size_t> m_adaptiveTargets; //!< Indices of the target species
+    double m_adaptiveThreshold; //!< DRGEP threshold for active species
+    double m_adaptiveRtol; //!< Relative tolerance on changes in the state
+    double m_adaptiveAtol; //!< Absolute tolerance on mole fraction changes
+    size_t m_nActiveSelections; //!< Number of selections of the subset
+
+    std::vector<size_t> m_activeReactions; //!< Reactions in the subset
+    std::vector<char> m_isActive; //!< Flags for reactions in the subset
+    //! Flags for the falloff reactions in the subset, by falloff index
+    std::vector<char> m_isActiveFalloff;
+    std::vector<char> m_isActiveSpecies; //!< Flags for species in the subset
+
+    //! Temperature, pressure and mole fractions at which the subset was
+    //! selected
+    double m_adaptiveT, m_adaptiveP;
+    vector_fp m_adaptiveX;
+    vector_fp m_adaptiveX_work;
+
+    //! Reactants and products of each reaction
+    std::vector<std::vector<size_t>> m_reactionSpecies;
+
+    //! Net stoichiometric coefficients, with a row for each species and a
+    //! column for each reaction
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_speciesNetStoich;
+    //! @}
+
+    //! @name Quasi-steady-state species
+    //! @{
+    std::vector<size_t> m_qss; //!< Indices of the QSS species
+    vector_fp m_qss_conc; //!< Concentrations of the QSS species
+
+    //! True if #m_qssReactions and the coefficient arrays below are up to
+    //! date with the QSS species and the reactions
+    bool m_qss_ok;
+
+    //! Reactions involving QSS species
+    std::vector<size_t> m_qssReactions;
+
+    //! Stoichiometric coefficients of the QSS species as reactants and as
+    //! products in the reactions involving them. Entry `n` is for QSS
+    //! species `m_qssCoeffSpecies[n]` (an index into #m_qss) in reaction
+    //! `m_qssCoeffRxn[n]`.
+    std::vector<size_t> m_qssCoeffSpecies;
+    std::vector<size_t> m_qssCoeffRxn;
+    vector_fp m_qssReactantCoeff;
+    vector_fp m_qssProductCoeff;
+
+    vector_fp m_qss_ropf; //!< Work array of length nReactions()
+    vector_fp m_qss_ropr; //!< Work array of length nReactions()
+    //! @}
+
+    //! @name Compiled kinetics kernels
+    //! @{
+    std::unique_ptr<CompiledKinetics> m_compiled; //!< Loaded library
+    vector_fp m_compiled_work; //!< Temperature-dependent work array
+    vector_fp m_compiled_rfn; //!< P-log and Chebyshev rate constants
+    vector_fp m_compiled_rkcn; //!< Reciprocal equilibrium constants
+    double m_compiled_temp; //!< Temperature of #m_compiled_work
+    double m_compiled_pres; //!< Pressure of the P-log and Chebyshev rates
+    double m_compiled_rho; //!< Density of the rates of progress
+    int m_compiled_stateNum; //!< Phase::stateMFNumber() of the rates of progress
+    //! @}
+
+    //! Evaluate the rates of progress using the compiled kernels
+    void updateROP_compiled();
+
+    //! Table of the temperature-dependent rate coefficients
+    shared_ptr<const TemperatureTable> m_rateTable;
+    vector_fp m_table_work; //!< Interpolated values from #m_rateTable
+
+    //! Signs of the rate constants whose logarithms are tabulated
+    vector_fp m_table_sign;
+
+    //! Calculate the quantities stored in #m_rateTable at temperature `T`:
+    //! the logarithms of the magnitudes of the rate constants (see
+    //! #m_table_sign), the falloff work terms, and the logarithms of the
+    //! equilibrium constants if the phase is an IdealGasPhase. The state of
+    //! the phase is modified in the latter case.
+    void evalRateTableValues(double T, double* values);
+
+    //! Set the rate coefficients by interpolation in #m_rateTable. Returns
+    //! `false` if `T` is outside of the table.
+    bool interpolateRateTable(double T);
+
+    //! Save the current rates of progress as the reference state for
+    //! incremental updates
+    void saveROPReference();
+
+    //! Update the rates of progress by re-evaluating only the reactions
+    //! affected by differences from the reference state. Returns `false` if
+    //! too many reactions are affected, in which case the caller must
+    //! evaluate all reactions.
+    bool updateROP_incremental();
+
+    //! Update the rates of progress of the reactions in the active subset,
+    //! selecting a new subset first if required
+    void updateROP_adaptive();
+
+    //! Select the active subset using the rates of progress of all reactions
+    //! at the current state, and set the rates of progress of the inactive
+    //! reactions to zero
+    void selectActiveReactions();
+
+    //! True if the state differs from the state at which the active subset
+    //! was selected by more than the tolerances
+    bool adaptiveStateChanged();
+
+    //! Find the concentrations of the QSS species and store them in
+    //! #m_conc. On entry, #m_ropf and #m_ropr contain the forward and reverse
+    //! rate constants of all reactions evaluated for the current state.
+    void solveQuasiSteadyState();
+
+    //! Apply the falloff functions to the falloff reactions, writing the
+    //! resulting rate constants into the corresponding entries of `ropf`.
+    void processFalloffReactions(double* ropf);
+
+    //! Calculate the rate constants of the falloff reactions, including the
+    //! falloff functions, and store them in #m_falloff_pr in the order of
+    //! #m_fallindx.
+    void updateFalloffRates();
+
+    //! Update the properties that depend on concentrations, as in
+    //! update_rates_C(). If `active` is not null, the enhanced third-body
+    //! concentrations are updated only for the reactions `i` for which
+    //! `(*active)[i]` is non-zero.
+    void updateConcentrations(const std::vector<char>* active);
+
+    //! Version of processFalloffReactions() for the falloff reactions in the
+    //! active subset of adaptive chemistry, given by #m_isActiveFalloff
+    void processFalloffReactions_active(double* ropf);
+
+    //! Set the entries of `dkdM` for the falloff reactions to the derivative
+    //! of the rate constant with respect to the enhanced third-body
+    //! concentration, using the analytic derivatives of the falloff functions
+    //! (see FalloffMgr::getDerivatives).
+    void processFalloffReactions_ddM(double* dkdM);
+
+    //! Derivatives of the rates of progress `fwd * ropf + rev * ropr` with
+    //! respect to the species concentrations.
+    Eigen::SparseMatrix<double> calculateROP_ddC(double fwd, double rev);
 
     void addThreeBodyReaction(ThreeBodyReaction& r);
     void addFalloffReaction(FalloffReaction& r);
-    void addPlogReaction(PlogReaction& r);
-    void addChebyshevReaction(ChebyshevReaction& r);
+
+    virtual void modifyElementaryReaction(size_t i, ElementaryReaction& rNew);
 
     void modifyThreeBodyReaction(size_t i, ThreeBodyReaction& r);
     void modifyFalloffReaction(size_t i, FalloffReaction& r);
@@ -117,6 +631,32 @@ protected:
 
     //! Update the equilibrium constants in molar units.
     void updateKc();
+
+    //! Update the reciprocals of the equilibrium constants from #m_logKc
+    void updateRkcn();
+
+    //! Calculate the natural logarithms of the equilibrium constants in molar
+    //! units for all reactions at the current state of the phase.
+    /*!
+     * The standard Gibbs free energy changes of all reactions are obtained
+     * as a single product of the sparse net stoichiometric matrix with the
+     * standard chemical potentials. For IdealGasPhase, the reference Gibbs
+     * functions held by the phase are used directly, since the pressure
+     * dependence of the standard chemical potentials cancels with that of
+     * the standard concentration.
+     */
+    void calculateLogKc(double* logKc);
+
+    //! Net stoichiometric coefficients, with a row for each reaction and a
+    //! column for each species
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_netStoich;
+
+    //! The phase as an IdealGasPhase, or `nullptr` if it is of another type
+    IdealGasPhase* m_idealGas;
+
+    //! Logarithms of the equilibrium constants in molar units, evaluated at
+    //! the temperature #m_temp
+    vector_fp m_logKc;
 };
 
 }
@@ -163,6 +163,22 @@ public:
     virtual void eval(doublereal t, doublereal* y, doublereal* ydot,
                       doublereal* p);
 
+    //! Evaluate the Jacobian of ydot with respect to the surface coverages
+    /*!
+     *  The Jacobian is assembled from the analytic derivatives of the net
+     *  production rates (InterfaceKinetics::netProductionRates_ddC()),
+     *  including the normalization of the coverages.
+     *
+     *  @param t   Time (seconds)
+     *  @param y   Vector containing the current solution vector
+     *  @param ydot   Value of ydot at `y` (unused)
+     *  @param jac    Output Jacobian in column-major order, where
+     *                `jac[j*neq() + i]` is the derivative of `ydot[i]`
+     *                with respect to `y[j]`
+     */
+    virtual void evalJacobian(doublereal t, doublereal* y, doublereal* ydot,
+                              doublereal* jac);
+
     //! Get the current state of the solution vector
     /*!
      *  @param y   Value of the solution vector to be used.
@@ -93,7 +93,7 @@ public:
     virtual void getEquilibriumConstants(doublereal* kc);
 
     //! values needed to convert from exchange current density to surface
-    //! reaction rate.
+    //! reaction rate. Also sets #m_mu0.
     void updateExchangeCurrentQuantities();
 
     virtual void getDeltaGibbs(doublereal* deltaG);
@@ -178,6 +178,21 @@ public:
        return m_rates.effectiveTemperatureExponent(irxn);
     }
 
+    //! @}
+    //! @name Derivatives of Rates of Progress
+    //!
+    //! The derivatives are taken with respect to the activity concentrations
+    //! of the species. For the species of the surface phase, the activity
+    //! concentration is equal to the surface concentration, and the
+    //! dependence of coverage-dependent and sticking rate constants on the
+    //! coverages (\f$ \theta_k = C_k \sigma_k / n_0 \f$) is included. The
+    //! corrections for nonexistent phases are not included.
+    //! @{
+
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddC();
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddC();
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddC();
+
     //! @}
     //! @name Reaction Mechanism Construction
     //! @{
@@ -202,6 +217,12 @@ public:
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
     //! @}
 
+    //! Force the rate constants and equilibrium constants to be recomputed on
+    //! the next call to updateROP(), e.g. after a change of the phase state
+    //! that is not reflected by the temperature, pressure, coverages, site
+    //! density or electric potentials.
+    virtual void invalidateCache();
+
     //! Internal routine that updates the Rates of Progress of the reactions
     /*!
      *  This is actually the guts of the functionality of the object
@@ -211,10 +232,10 @@ public:
     //! Update properties that depend on temperature
     /*!
      *  Current objects that this function updates:
-     *       m_kdata->m_logtemp
-     *       m_kdata->m_rfn
-     *       m_rates.
-     *       updateKc();
+     *       m_logtemp
+     *       m_rfn_base (if T, the coverages or the site density changed)
+     *       m_mu0, m_rkcn (if T, P or the electric potentials changed)
+     *       m_rfn (if any of the above changed)
      */
     void _update_rates_T();
 
@@ -290,6 +311,7 @@ public:
      *  Irreversible reactions have their equilibrium constant set
      *  to zero. For reactions involving charged species the equilibrium
      *  constant is adjusted according to the electrostatic potential.
+     *  Uses the standard chemical potentials computed by updateMu0().
      */
     void updateKc();
 
@@ -318,6 +340,8 @@ public:
      *  the reaction type is a Butler-Volmer form, convert it to exchange
      *  current density form (amps/m2).
      *
+     *  Uses the quantities computed by updateExchangeCurrentQuantities().
+     *
      * @param kfwd  Vector of forward reaction rate constants, given in either
      *              normal form or in exchange current density form.
      */
@@ -404,8 +428,32 @@ protected:
      */
     Rate1<SurfaceArrhenius> m_rates;
 
+    //! Flag to force recomputation of all rate constants
     bool m_redo_rates;
 
+    //! Flag indicating that the electric potential of a phase has changed
+    //! since the rate constants were last computed
+    bool m_redo_phi;
+
+    //! Forward rate constants before the exchange current density conversion
+    //! and the voltage correction are applied. Depends only on the
+    //! temperature, the coverages and the site density. Length = number of
+    //! reactions.
+    vector_fp m_rfn_base;
+
+    //! Value of SurfPhase::stateMFNumber() when #m_rfn_base was last computed
+    int m_covStateNum;
+
+    //! Site density used to compute #m_rfn_base
+    double m_siteDens;
+
+    //! Site density used to compute #m_mu0 and #m_rkcn
+    double m_siteDensThermo;
+
+    //! Temperature and pressure of each phase used to compute #m_mu0 and
+    //! #m_rkcn. Length = 2 * number of phases.
+    vector_fp m_phaseTP;
+
     //! Vector of irreversible reaction numbers
     /*!
      * vector containing the reaction numbers of irreversible reactions.
@@ -674,6 +722,10 @@ protected:
 
     void applyStickingCorrection(double T, double* kf);
 
+    //! Derivatives of the rates of progress `fwd * ropf + rev * ropr` with
+    //! respect to the species activity concentrations.
+    Eigen::SparseMatrix<double> calculateROP_ddC(double fwd, double rev);
+
     int m_ioFlag;
 
     //! Number of dimensions of reacting phase (2 for InterfaceKinetics, 1 for
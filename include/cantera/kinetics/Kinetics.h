@@ -540,6 +540,106 @@ public:
      */
     virtual void getNetProductionRates(doublereal* wdot);
 
+    /**
+     * Species net production rates [kmol/m^3/s] for multiple states. Each
+     * state is specified by its temperature, pressure and mass fractions.
+     * The state of the phase is the same after the call as before it. Only
+     * available for kinetics managers with a single phase.
+     *
+     * The default implementation sets the state of the phase and calls
+     * getNetProductionRates(double*) for each state in turn. Derived classes
+     * may evaluate several states at once.
+     *
+     * @param n     Number of states
+     * @param T     Temperatures [K]. Length: n.
+     * @param P     Pressures [Pa]. Length: n.
+     * @param Y     Mass fractions, where `Y[j*nTotalSpecies() + k]` is the
+     *              mass fraction of species `k` in state `j`.
+     *              Length: n * nTotalSpecies().
+     * @param wdot  Output array of net production rates, with the same
+     *              layout as `Y`. Length: n * nTotalSpecies().
+     */
+    virtual void getNetProductionRates(size_t n, const double* T,
+                                       const double* P, const double* Y,
+                                       double* wdot);
+
+    //! @}
+    //! @name Derivatives of Rates of Progress and Production Rates
+    //!
+    //! Analytic derivatives of the reaction rates with respect to the
+    //! activity concentrations of the species, for use in constructing
+    //! Jacobian matrices. Rate coefficients which depend on pressure
+    //! (P-log and Chebyshev reactions) are held constant, while the
+    //! dependence on the enhanced third-body concentrations (three-body and
+    //! falloff reactions) is included.
+    //! @{
+
+    /**
+     * Derivatives of the forward rates of progress with respect to the
+     * species activity concentrations, at constant temperature.
+     *
+     * @return Sparse matrix with nReactions() rows and nTotalSpecies()
+     *     columns, where the entry (i, k) is the derivative of the forward
+     *     rate of progress of reaction i with respect to the concentration of
+     *     species k.
+     */
+    virtual Eigen::SparseMatrix<double> fwdRatesOfProgress_ddC() {
+        throw NotImplementedError("Kinetics::fwdRatesOfProgress_ddC");
+    }
+
+    /**
+     * Derivatives of the reverse rates of progress with respect to the
+     * species activity concentrations, at constant temperature.
+     * @see fwdRatesOfProgress_ddC()
+     */
+    virtual Eigen::SparseMatrix<double> revRatesOfProgress_ddC() {
+        throw NotImplementedError("Kinetics::revRatesOfProgress_ddC");
+    }
+
+    /**
+     * Derivatives of the net rates of progress with respect to the species
+     * activity concentrations, at constant temperature.
+     * @see fwdRatesOfProgress_ddC()
+     */
+    virtual Eigen::SparseMatrix<double> netRatesOfProgress_ddC() {
+        throw NotImplementedError("Kinetics::netRatesOfProgress_ddC");
+    }
+
+    /**
+     * Derivatives of the species net production rates with respect to the
+     * species activity concentrations, at constant temperature.
+     *
+     * @return Sparse matrix with nTotalSpecies() rows and columns, where the
+     *     entry (j, k) is the derivative of the net production rate of species
+     *     j with respect to the concentration of species k.
+     */
+    virtual Eigen::SparseMatrix<double> netProductionRates_ddC();
+
+    /**
+     * Derivatives of the net rates of progress with respect to temperature,
+     * at constant density and composition.
+     *
+     * @param drop  Output vector of derivatives. Length: nReactions().
+     */
+    virtual void getNetRatesOfProgress_ddT(double* drop) {
+        throw NotImplementedError("Kinetics::getNetRatesOfProgress_ddT");
+    }
+
+    /**
+     * Derivatives of the species net production rates with respect to
+     * temperature, at constant density and composition.
+     *
+     * @param dwdot  Output vector of derivatives. Length: nTotalSpecies().
+     */
+    virtual void getNetProductionRates_ddT(double* dwdot);
+
+    /**
+     * Net stoichiometric coefficient matrix, with nTotalSpecies() rows and
+     * nReactions() columns. The entry (k, i) is the net stoichiometric
+     * coefficient (products minus reactants) of species k in reaction i.
+     */
+    Eigen::SparseMatrix<double> netStoichCoeffs() const;
+
     //! @}
     //! @name Reaction Mechanism Informational Query Routines
     //! @{
@@ -601,6 +701,9 @@ public:
      * @param i   reaction index
      */
     virtual int reactionType(size_t i) const {
+        if (m_compact) {
+            return m_compactTypes[i];
+        }
         return m_reactions[i]->reaction_type;
     }
 
@@ -621,18 +724,17 @@ public:
      * @param i   reaction index
      */
     std::string reactionString(size_t i) const {
+        if (m_compact) {
+            return m_compactEquations[i];
+        }
         return m_reactions[i]->equation();
     }
 
     //! Returns a string containing the reactants side of the reaction equation.
-    std::string reactantString(size_t i) const {
-        return m_reactions[i]->reactantString();
-    }
+    std::string reactantString(size_t i) const;
 
     //! Returns a string containing the products side of the reaction equation.
-    std::string productString(size_t i) const {
-        return m_reactions[i]->productString();
-    }
+    std::string productString(size_t i) const;
 
     /**
      * Return the forward rate constants
@@ -733,6 +835,31 @@ public:
 
     shared_ptr<const Reaction> reaction(size_t i) const;
 
+    //! Release the Reaction objects once the rate expressions have been set
+    //! up.
+    /*!
+     * The rates and the reaction equations, types and stoichiometric
+     * coefficients remain available after calling this function, but
+     * reaction(), addReaction(), modifyReaction() and checkDuplicates() raise
+     * an exception. The entries of #m_reactions are null afterwards, and
+     * derived classes must not access them if #m_compact is `true`. This reduces the memory used by kinetics managers which
+     * are created once and then only used for computing rates.
+     */
+    virtual void compact();
+
+    //! Returns `true` if compact() has been called
+    bool isCompact() const {
+        return m_compact;
+    }
+
+    //! Add estimates of the memory used by this kinetics manager, in bytes, to
+    //! `usage`. The memory used by the Reaction objects, or by the reaction
+    //! equations after calling compact(), is added to the entry `reactions`,
+    //! and the memory used by the stoichiometry managers to the entry
+    //! `stoichiometry`. Derived classes add the memory used by their rate
+    //! managers to the entry `rates`.
+    virtual void getMemoryUsage(std::map<std::string, size_t>& usage) const;
+
     //! Determine behavior when adding a new reaction that contains species not
     //! defined in any of the phases associated with this kinetics manager. If
     //! set to true, the reaction will silently be ignored. If false, (the
@@ -941,6 +1068,18 @@ protected:
     //! @see skipUndeclaredThirdBodies()
     bool m_skipUndeclaredThirdBodies;
 
+    //! @name Reaction data kept by compact()
+    //! @{
+    bool m_compact; //!< `true` if the Reaction objects have been released
+    std::vector<std::string> m_compactEquations; //!< Reaction equations
+    vector_int m_compactTypes; //!< Reaction types
+
+    //! Reactant and product stoichiometric coefficients, with a row for each
+    //! species and a column for each reaction
+    Eigen::SparseMatrix<double> m_compactReactantStoich;
+    Eigen::SparseMatrix<double> m_compactProductStoich;
+    //! @}
+
     //! reference to Solution
     std::weak_ptr<Solution> m_root;
 };
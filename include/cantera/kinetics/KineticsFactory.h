@@ -128,6 +128,28 @@ unique_ptr<Kinetics> newKinetics(std::vector<ThermoPhase*>& phases,
                                  const std::string& filename,
                                  const std::string& phase_name);
 
+/*!
+ * Create a new kinetics manager with the same reactions as an existing one
+ *
+ * The Reaction objects of `other` are shared with the new kinetics manager,
+ * so no input data is parsed again. The rate coefficients are installed
+ * separately in each kinetics manager. The shared Reaction objects must not
+ * be modified, since neither kinetics manager would use the modified
+ * parameters, while Kinetics::reaction() would return them for both. To
+ * change a reaction, pass a new Reaction object to Kinetics::modifyReaction()
+ * of each kinetics manager which should use it; calling it for only one of
+ * them makes the two kinetics managers differ in this reaction.
+ * Reaction rate multipliers are copied, while other run-time options of
+ * `other` are not.
+ *
+ * @param phases  Vector of phases with the same species as the phases of
+ *     `other`, in the same order
+ * @param other   Kinetics manager for phases created from YAML input, which
+ *     has not been compacted
+ */
+unique_ptr<Kinetics> newKinetics(std::vector<ThermoPhase*>& phases,
+                                 Kinetics& other);
+
 /*!
  * Add reactions to a Kinetics object
  *
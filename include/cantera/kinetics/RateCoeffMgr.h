@@ -9,6 +9,8 @@
 #define CT_RATECOEFF_MGR_H
 
 #include "RxnRates.h"
+#include "cantera/numerics/eigen_sparse.h"
+#include "cantera/base/utilities.h"
 
 namespace Cantera
 {
@@ -73,6 +75,13 @@ public:
         return m_rates.size();
     }
 
+    //! Estimate of the memory used by this rate manager, in bytes, not
+    //! including memory allocated by the rate objects themselves
+    size_t memoryUsage() const {
+        return vectorMemoryUsage(m_rates) + vectorMemoryUsage(m_rxn)
+            + mapMemoryUsage(m_indices);
+    }
+
     //! Return effective preexponent for the specified reaction.
     /*!
      *  Returns effective preexponent, accounting for surface coverage
@@ -119,6 +128,462 @@ protected:
     std::map<size_t, size_t> m_indices;
 };
 
+/**
+ * Rate coefficient manager specialized for Arrhenius rate expressions.
+ *
+ * The parameters are stored as contiguous arrays (structure-of-arrays) rather
+ * than as a vector of Arrhenius objects, so that the loops in update() have
+ * unit stride. The loop computing the exponents is vectorized by the
+ * compiler. The loop evaluating exp() is only vectorized if the compiler may
+ * use a vector math library, which with GCC and glibc requires `-ffast-math`;
+ * otherwise it consists of scalar calls to exp(). If the reactions were
+ * installed with consecutive reaction numbers starting from zero (as is the
+ * case for the rate managers in GasKinetics, which use the internal order of
+ * the reactions), the rate coefficients are written directly to the output
+ * array. Otherwise, they are scattered to the locations of the reaction
+ * numbers in a separate loop.
+ */
+template<>
+class Rate1<Arrhenius>
+{
+public:
+    Rate1() : m_contiguous(true) {}
+    virtual ~Rate1() {}
+
+    /**
+     * Install a rate coefficient calculator.
+     * @param rxnNumber the reaction number
+     * @param rate rate coefficient specification for the reaction
+     */
+    void install(size_t rxnNumber, const Arrhenius& rate) {
+        m_indices[rxnNumber] = m_rxn.size();
+        m_contiguous = m_contiguous && (rxnNumber == m_rxn.size());
+        m_rxn.push_back(rxnNumber);
+        m_A.push_back(rate.preExponentialFactor());
+        m_b.push_back(rate.temperatureExponent());
+        m_E.push_back(rate.activationEnergy_R());
+        m_work.push_back(0.0);
+    }
+
+    //! Replace an existing rate coefficient calculator
+    void replace(size_t rxnNumber, const Arrhenius& rate) {
+        size_t i = m_indices[rxnNumber];
+        m_A[i] = rate.preExponentialFactor();
+        m_b[i] = rate.temperatureExponent();
+        m_E[i] = rate.activationEnergy_R();
+    }
+
+    //! Arrhenius rates have no concentration-dependent parts.
+    void update_C(const doublereal* c) {}
+
+    /**
+     * Write the rate coefficients into array values. Each rate coefficient is
+     * written at the location specified by the reaction number when it was
+     * installed.
+     */
+    void update(doublereal T, doublereal logT, doublereal* values) {
+        doublereal recipT = 1.0/T;
+        size_t n = m_A.size();
+        double* out = m_contiguous ? values : m_work.data();
+        const double* A = m_A.data();
+        const double* b = m_b.data();
+        const double* E = m_E.data();
+        for (size_t i = 0; i < n; i++) {
+            out[i] = b[i]*logT - E[i]*recipT;
+        }
+        for (size_t i = 0; i < n; i++) {
+            out[i] = A[i] * std::exp(out[i]);
+        }
+        if (!m_contiguous) {
+            for (size_t i = 0; i < n; i++) {
+                values[m_rxn[i]] = m_work[i];
+            }
+        }
+    }
+
+    /**
+     * Write the rate coefficients for `n` states into array values, where
+     * `values[i*n + j]` is the rate coefficient of reaction `i` in state `j`.
+     * Only the rows for the installed reactions are modified.
+     *
+     * @param n  Number of states
+     * @param logT  Natural logarithm of the temperature of each state
+     * @param recipT  Inverse of the temperature of each state
+     * @param values  Output array. Length: n * (number of reactions)
+     */
+    void update(size_t n, const double* logT, const double* recipT,
+                double* values) const {
+        for (size_t i = 0; i < m_rxn.size(); i++) {
+            double* k = values + m_rxn[i] * n;
+            double A = m_A[i], b = m_b[i], E = m_E[i];
+            for (size_t j = 0; j < n; j++) {
+                k[j] = A * std::exp(b*logT[j] - E*recipT[j]);
+            }
+        }
+    }
+
+    /**
+     * Write the derivatives of the natural logarithms of the rate
+     * coefficients with respect to temperature into array values, at the
+     * same locations as update().
+     */
+    void update_ddT(double T, double* values) const {
+        double recipT = 1.0/T;
+        for (size_t i = 0; i < m_rxn.size(); i++) {
+            values[m_rxn[i]] = (m_b[i] + m_E[i]*recipT) * recipT;
+        }
+    }
+
+    size_t nReactions() const {
+        return m_rxn.size();
+    }
+
+    //! Estimate of the memory used by this rate manager, in bytes
+    size_t memoryUsage() const {
+        return vectorMemoryUsage(m_A) + vectorMemoryUsage(m_b)
+            + vectorMemoryUsage(m_E) + vectorMemoryUsage(m_work)
+            + vectorMemoryUsage(m_rxn) + mapMemoryUsage(m_indices);
+    }
+
+    //! Return effective preexponent for the specified reaction.
+    double effectivePreExponentialFactor(size_t irxn) {
+        return m_A[irxn];
+    }
+
+    //! Return effective activation energy divided by the gas constant for the
+    //! specified reaction.
+    double effectiveActivationEnergy_R(size_t irxn) {
+        return m_E[irxn];
+    }
+
+    //! Return effective temperature exponent for the specified reaction.
+    double effectiveTemperatureExponent(size_t irxn) {
+        return m_b[irxn];
+    }
+
+protected:
+    vector_fp m_A; //!< Pre-exponential factors
+    vector_fp m_b; //!< Temperature exponents
+    vector_fp m_E; //!< Activation temperatures [K]
+    vector_fp m_work; //!< Work array used when scattering is required
+    std::vector<size_t> m_rxn;
+
+    //! True if reaction numbers are consecutive integers starting at zero
+    bool m_contiguous;
+
+    //! map reaction number to index in m_rxn
+    std::map<size_t, size_t> m_indices;
+};
+
+/**
+ * Rate coefficient manager specialized for coverage-dependent surface
+ * Arrhenius rate expressions.
+ *
+ * The coverage dependencies of all reactions are collected into two sparse
+ * matrices with one row per reaction. The first has one column for the
+ * coverage and one column for the log of the coverage of each surface
+ * species and gives the shift in the natural log of the pre-exponential
+ * factor; the second gives the shift in the activation temperature. The
+ * coverage corrections for all reactions are then obtained in update_C() from
+ * two sparse matrix-vector products, and the Arrhenius parameters are stored
+ * as contiguous arrays as in Rate1<Arrhenius>.
+ */
+template<>
+class Rate1<SurfaceArrhenius>
+{
+public:
+    Rate1() : m_nCov(0), m_matricesOk(true) {}
+    virtual ~Rate1() {}
+
+    /**
+     * Install a rate coefficient calculator.
+     * @param rxnNumber the reaction number
+     * @param rate rate coefficient specification for the reaction
+     */
+    void install(size_t rxnNumber, const SurfaceArrhenius& rate);
+
+    //! Replace an existing rate coefficient calculator
+    void replace(size_t rxnNumber, const SurfaceArrhenius& rate);
+
+    //! Update the coverage-dependent parts of the rate coefficients.
+    //! @param c coverages of the species in the surface phase
+    void update_C(const doublereal* c);
+
+    /**
+     * Write the rate coefficients into array values. Each rate coefficient is
+     * written at the location specified by the reaction number when it was
+     * installed.
+     */
+    void update(doublereal T, doublereal logT, doublereal* values);
+
+    //! Append the derivatives of the natural log of the rate coefficients
+    //! with respect to the coverages to the list of sparse matrix entries
+    //! `jac`. Each entry has the reaction number as its row and the species
+    //! index within the surface phase as its column.
+    /*!
+     * @param T      Temperature [K]
+     * @param theta  Coverages of the species in the surface phase
+     * @param jac    List of sparse matrix entries to append to
+     */
+    void getCoverageDerivatives(double T, const double* theta,
+                                SparseTriplets& jac);
+
+    size_t nReactions() const {
+        return m_rxn.size();
+    }
+
+    //! Return effective preexponent for the specified reaction, accounting
+    //! for the surface coverage dependencies.
+    double effectivePreExponentialFactor(size_t irxn) {
+        return m_A[irxn] * std::exp(m_logAcov[irxn]);
+    }
+
+    //! Return effective activation energy divided by the gas constant for the
+    //! specified reaction, accounting for the surface coverage dependencies.
+    double effectiveActivationEnergy_R(size_t irxn) {
+        return m_E[irxn] + m_Ecov[irxn];
+    }
+
+    //! Return effective temperature exponent for the specified reaction.
+    double effectiveTemperatureExponent(size_t irxn) {
+        return m_b[irxn];
+    }
+
+protected:
+    //! Assemble #m_covA and #m_covE from the coverage dependencies of all
+    //! installed reactions
+    void buildMatrices();
+
+    std::vector<SurfaceArrhenius> m_rates;
+    std::vector<size_t> m_rxn;
+
+    //! map reaction number to index in m_rxn / m_rates
+    std::map<size_t, size_t> m_indices;
+
+    vector_fp m_A; //!< Pre-exponential factors
+    vector_fp m_b; //!< Temperature exponents
+    vector_fp m_E; //!< Activation temperatures [K]
+
+    //! Shift in the natural log of the pre-exponential factor of each
+    //! reaction due to the coverage dependencies
+    vector_fp m_logAcov;
+
+    //! Shift in the activation temperature of each reaction due to the
+    //! coverage dependencies [K]
+    vector_fp m_Ecov;
+
+    //! Coefficients of the coverages (columns `0` to `m_nCov-1`) and of the
+    //! log of the coverages (columns `m_nCov` to `2*m_nCov-1`) in
+    //! #m_logAcov
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_covA;
+
+    //! Coefficients of the coverages in #m_Ecov
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_covE;
+
+    //! Number of surface species referenced by coverage dependencies
+    size_t m_nCov;
+
+    //! Coverages followed by the log of the coverages
+    vector_fp m_covTerms;
+
+    vector_fp m_work; //!< Exponents of the rate coefficients
+
+    //! False if reactions have been installed or replaced since the coverage
+    //! dependency matrices were last assembled
+    bool m_matricesOk;
+};
+
+/**
+ * Rate coefficient manager specialized for pressure-dependent Arrhenius (P-log)
+ * rate expressions.
+ *
+ * Reactions which use the same set of reference pressures share one pressure
+ * grid, so the search for the interval bracketing the current pressure is
+ * done once per distinct grid rather than once per reaction. The Arrhenius
+ * expressions of all reactions are stored as contiguous arrays, and when the
+ * pressure changes, the expressions needed at the two bracketing reference
+ * pressures are collected into separate contiguous arrays that are evaluated
+ * in a single loop by update().
+ */
+template<>
+class Rate1<Plog>
+{
+public:
+    Rate1() : m_logP(-1000.0) {}
+    virtual ~Rate1() {}
+
+    /**
+     * Install a rate coefficient calculator.
+     * @param rxnNumber the reaction number
+     * @param rate rate coefficient specification for the reaction
+     */
+    void install(size_t rxnNumber, const Plog& rate);
+
+    //! Replace an existing rate coefficient calculator
+    void replace(size_t rxnNumber, const Plog& rate);
+
+    //! Update the pressure-dependent parts of the rate coefficients.
+    //! @param c natural log of the pressure in Pa
+    void update_C(const doublereal* c);
+
+    /**
+     * Write the rate coefficients into array values. Each rate coefficient is
+     * written at the location specified by the reaction number when it was
+     * installed.
+     */
+    void update(doublereal T, doublereal logT, doublereal* values);
+
+    size_t nReactions() const {
+        return m_rxn.size();
+    }
+
+    //! Estimate of the memory used by this rate manager, in bytes, not
+    //! including memory allocated by the Plog objects themselves
+    size_t memoryUsage() const;
+
+protected:
+    //! Add the flattened representation of `rate` for the `i`-th installed
+    //! reaction
+    void addRate(size_t i, const Plog& rate);
+
+    //! Collect the Arrhenius expressions at the current bracketing pressures
+    void updateActive();
+
+    std::vector<Plog> m_rates;
+    std::vector<size_t> m_rxn;
+
+    //! map reaction number to index in m_rxn / m_rates
+    std::map<size_t, size_t> m_indices;
+
+    //! @name Pressure grids
+    //! @{
+    //! Sorted natural logarithms of the reference pressures of each grid
+    std::vector<vector_fp> m_gridLogP;
+
+    //! Index of the lower bracketing reference pressure for each grid
+    std::vector<size_t> m_gridLow;
+
+    //! Index of the upper bracketing reference pressure for each grid. This
+    //! is equal to the lower index if the pressure is outside the grid.
+    std::vector<size_t> m_gridHigh;
+
+    //! Interpolation weight of the upper reference pressure for each grid
+    vector_fp m_gridFrac;
+
+    //! Index of the grid used by each reaction
+    std::vector<size_t> m_grid;
+    //! @}
+
+    //! @name Arrhenius expressions
+    //! The expressions for reference pressure `j` of reaction `i` are entries
+    //! `m_levels[m_levelStart[i] + j]` through
+    //! `m_levels[m_levelStart[i] + j + 1] - 1` of #m_logA, #m_A, #m_b and #m_E.
+    //! @{
+    std::vector<size_t> m_levelStart;
+    std::vector<size_t> m_levels;
+    vector_fp m_logA, m_A, m_b, m_E;
+    //! @}
+
+    //! @name Expressions at the current bracketing pressures
+    //! Reaction `i` uses active expressions `m_activeStart[2*i]` to
+    //! `m_activeStart[2*i+1] - 1` at the lower pressure and
+    //! `m_activeStart[2*i+1]` to `m_activeStart[2*i+2] - 1` at the upper
+    //! pressure.
+    //! @{
+    std::vector<size_t> m_activeStart;
+    vector_fp m_activeLogA, m_activeA, m_activeB, m_activeE;
+    vector_fp m_work; //!< Exponents of the active expressions
+    //! @}
+
+    double m_logP; //!< log(p) at the current state
+};
+
+
+/**
+ * Rate coefficient manager specialized for Chebyshev rate expressions.
+ *
+ * Reactions are grouped by their temperature and pressure ranges and by the
+ * dimensions of their coefficient matrices. All reactions within a group use
+ * the same Chebyshev polynomials of the reduced temperature and reduced
+ * pressure, so these are evaluated once per group. The coefficients of a
+ * group are stored as one dense matrix, with `nT` rows for each reaction and
+ * `nP` columns. update_C() then multiplies this matrix by the vector of
+ * pressure polynomials, and update() multiplies the result (reshaped to one
+ * row per reaction) by the vector of temperature polynomials.
+ */
+template<>
+class Rate1<ChebyshevRate>
+{
+public:
+    Rate1() {}
+    virtual ~Rate1() {}
+
+    /**
+     * Install a rate coefficient calculator.
+     * @param rxnNumber the reaction number
+     * @param rate rate coefficient specification for the reaction
+     */
+    void install(size_t rxnNumber, const ChebyshevRate& rate);
+
+    //! Replace an existing rate coefficient calculator
+    void replace(size_t rxnNumber, const ChebyshevRate& rate);
+
+    //! Update the pressure-dependent parts of the rate coefficients.
+    //! @param c base-10 logarithm of the pressure in Pa
+    void update_C(const doublereal* c);
+
+    /**
+     * Write the rate coefficients into array values. Each rate coefficient is
+     * written at the location specified by the reaction number when it was
+     * installed.
+     */
+    void update(doublereal T, doublereal logT, doublereal* values);
+
+    size_t nReactions() const {
+        return m_rates.size();
+    }
+
+    //! Estimate of the memory used by this rate manager, in bytes, not
+    //! including memory allocated by the ChebyshevRate objects themselves
+    size_t memoryUsage() const;
+
+protected:
+    //! Reactions with identical ranges and coefficient matrix dimensions
+    struct Group {
+        double Tmin, Tmax, Pmin, Pmax;
+        size_t nT, nP;
+        double TrNum, TrDen; //!< terms appearing in the reduced temperature
+        double PrNum, PrDen; //!< terms appearing in the reduced pressure
+
+        //! Reaction numbers of the reactions in this group
+        std::vector<size_t> rxn;
+
+        //! Coefficients, where `coeffs[(nT*i + t)*nP + p]` is the
+        //! coefficient for temperature index `t` and pressure index `p` of
+        //! reaction `i` within the group
+        vector_fp coeffs;
+
+        //! Products of the coefficients and the pressure polynomials.
+        //! Length `nT` times the number of reactions in the group.
+        vector_fp dotProd;
+
+        vector_fp logk; //!< log10 of the rate coefficient of each reaction
+    };
+
+    //! Add `rate` for reaction number `rxnNumber` to the matching group
+    void addRate(size_t rxnNumber, const ChebyshevRate& rate);
+
+    std::vector<ChebyshevRate> m_rates;
+    std::vector<size_t> m_rxn;
+
+    //! map reaction number to index in m_rxn / m_rates
+    std::map<size_t, size_t> m_indices;
+
+    std::vector<Group> m_groups;
+
+    vector_fp m_poly; //!< Work array for Chebyshev polynomial values
+};
+
 }
 
 #endif
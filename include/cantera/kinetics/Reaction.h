@@ -41,6 +41,11 @@ public:
     //! valid.
     virtual void validate();
 
+    //! Estimate of the memory used by the species names, stoichiometric
+    //! coefficients, reaction orders and input data of this reaction, in
+    //! bytes
+    size_t memoryUsage() const;
+
     //! Type of the reaction. The valid types are listed in the file,
     //! reaction_defs.h, with constants ending in `RXN`.
     int reaction_type;
@@ -19,6 +19,7 @@ namespace Cantera
 {
 
 class Array2D;
+template<class R> class Rate1;
 
 //! Arrhenius reaction rate type depends only on temperature
 /**
@@ -193,6 +194,8 @@ public:
     }
 
 protected:
+    friend class Rate1<SurfaceArrhenius>;
+
     doublereal m_b, m_E, m_A;
     doublereal m_acov, m_ecov, m_mcov;
     std::vector<size_t> m_sp, m_msp;
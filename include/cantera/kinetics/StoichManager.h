@@ -10,6 +10,8 @@
 
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/ctexceptions.h"
+#include "cantera/base/utilities.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -56,35 +58,17 @@ namespace Cantera
  * this matrix for elementary reactions involving three or fewer product
  * molecules (or reactant molecules).
  *
- * To take advantage of this structure, reactions are divided into four groups.
- * These classes are designed to take advantage of this sparse structure when
- * computing quantities that can be written as matrix multiplies.
+ * To take advantage of this structure, class StoichManagerN stores the
+ * reactions with up to three molecules and unit reaction orders in flat
+ * arrays grouped by the number of molecules, and handles all other reactions
+ * with instances of class C_AnyN.
  *
- * They are designed to explicitly unroll loops over species or reactions for
- * operations on reactions that require knowing the reaction stoichiometry.
- *
- * This module consists of class StoichManager, and classes C1, C2, and C3.
- * Classes C1, C2, and C3 handle operations involving one, two, or three
- * species, respectively, in a reaction. Instances are instantiated with a
- * reaction number, and n species numbers (n = 1 for C1, etc.). All three
- * classes have the same interface.
- *
- * These classes are designed for use by StoichManager, and the operations
- * implemented are those needed to efficiently compute quantities such as
- * rates of progress, species production rates, reaction thermochemistry, etc.
- * The compiler will inline these methods into the body of the corresponding
- * StoichManager method, and so there is no performance penalty (unless
- * inlining is turned off).
- *
- * To describe the methods, consider class C3 and suppose an instance is
- * created with reaction number irxn and species numbers k0, k1, and k2.
+ * To describe the operations, suppose reaction irxn has the molecules k0, k1,
+ * and k2 on one side.
  *
  *  - multiply(in, out) : out[irxn] is multiplied by
  *    in[k0] * in[k1] * in[k2]
  *
- *  - power(in, out) : out[irxn] is multiplied by
- *     (in[k0]^order0) * (in[k1]^order1) * (in[k2]^order2)
- *
  *  - incrementReaction(in, out) : out[irxn] is incremented by
  *    in[k0] + in[k1] + in[k2]
  *
@@ -120,190 +104,6 @@ namespace Cantera
  * identical species are treated as involving separate species.
  */
 
-/**
- * Handles one species in a reaction.
- * See @ref Stoichiometry
- * @ingroup Stoichiometry
- * @internal
- */
-class C1
-{
-public:
-    C1(size_t rxn = 0, size_t ic0 = 0) :
-        m_rxn(rxn),
-        m_ic0(ic0) {
-    }
-
-    size_t data(std::vector<size_t>& ic) {
-        ic.resize(1);
-        ic[0] = m_ic0;
-        return m_rxn;
-    }
-
-    void incrementSpecies(const doublereal* R, doublereal* S) const {
-        S[m_ic0] += R[m_rxn];
-    }
-
-    void decrementSpecies(const doublereal* R, doublereal* S) const {
-        S[m_ic0] -= R[m_rxn];
-    }
-
-    void multiply(const doublereal* S, doublereal* R) const {
-        R[m_rxn] *= S[m_ic0];
-    }
-
-    void incrementReaction(const doublereal* S, doublereal* R) const {
-        R[m_rxn] += S[m_ic0];
-    }
-
-    void decrementReaction(const doublereal* S, doublereal* R) const {
-        R[m_rxn] -= S[m_ic0];
-    }
-
-    size_t rxnNumber() const {
-        return m_rxn;
-    }
-    size_t speciesIndex(size_t n) const {
-        return m_ic0;
-    }
-    size_t nSpecies() {
-        return 1;
-    }
-
-private:
-    //! Reaction number
-    size_t m_rxn;
-    //! Species number
-    size_t m_ic0;
-};
-
-/**
- * Handles two species in a single reaction.
- * See @ref Stoichiometry
- * @ingroup Stoichiometry
- */
-class C2
-{
-public:
-    C2(size_t rxn = 0, size_t ic0 = 0, size_t ic1 = 0)
-        : m_rxn(rxn), m_ic0(ic0), m_ic1(ic1) {}
-
-    size_t data(std::vector<size_t>& ic) {
-        ic.resize(2);
-        ic[0] = m_ic0;
-        ic[1] = m_ic1;
-        return m_rxn;
-    }
-
-    void incrementSpecies(const doublereal* R, doublereal* S) const {
-        S[m_ic0] += R[m_rxn];
-        S[m_ic1] += R[m_rxn];
-    }
-
-    void decrementSpecies(const doublereal* R, doublereal* S) const {
-        S[m_ic0] -= R[m_rxn];
-        S[m_ic1] -= R[m_rxn];
-    }
-
-    void multiply(const doublereal* S, doublereal* R) const {
-        if (S[m_ic0] < 0 && S[m_ic1] < 0) {
-            R[m_rxn] = 0;
-        } else {
-            R[m_rxn] *= S[m_ic0] * S[m_ic1];
-        }
-    }
-
-    void incrementReaction(const doublereal* S, doublereal* R) const {
-        R[m_rxn] += S[m_ic0] + S[m_ic1];
-    }
-
-    void decrementReaction(const doublereal* S, doublereal* R) const {
-        R[m_rxn] -= (S[m_ic0] + S[m_ic1]);
-    }
-
-    size_t rxnNumber() const {
-        return m_rxn;
-    }
-    size_t speciesIndex(size_t n) const {
-        return (n == 0 ? m_ic0 : m_ic1);
-    }
-    size_t nSpecies() {
-        return 2;
-    }
-
-private:
-    //! Reaction index -> index into the ROP vector
-    size_t m_rxn;
-
-    //! Species index -> index into the species vector for the two species.
-    size_t m_ic0, m_ic1;
-};
-
-/**
- * Handles three species in a reaction.
- * See @ref Stoichiometry
- * @ingroup Stoichiometry
- */
-class C3
-{
-public:
-    C3(size_t rxn = 0, size_t ic0 = 0, size_t ic1 = 0, size_t ic2 = 0)
-        : m_rxn(rxn), m_ic0(ic0), m_ic1(ic1), m_ic2(ic2) {}
-
-    size_t data(std::vector<size_t>& ic) {
-        ic.resize(3);
-        ic[0] = m_ic0;
-        ic[1] = m_ic1;
-        ic[2] = m_ic2;
-        return m_rxn;
-    }
-
-    void incrementSpecies(const doublereal* R, doublereal* S) const {
-        S[m_ic0] += R[m_rxn];
-        S[m_ic1] += R[m_rxn];
-        S[m_ic2] += R[m_rxn];
-    }
-
-    void decrementSpecies(const doublereal* R, doublereal* S) const {
-        S[m_ic0] -= R[m_rxn];
-        S[m_ic1] -= R[m_rxn];
-        S[m_ic2] -= R[m_rxn];
-    }
-
-    void multiply(const doublereal* S, doublereal* R) const {
-        if ((S[m_ic0] < 0 && (S[m_ic1] < 0 || S[m_ic2] < 0)) ||
-            (S[m_ic1] < 0 && S[m_ic2] < 0)) {
-            R[m_rxn] = 0;
-        } else {
-            R[m_rxn] *= S[m_ic0] * S[m_ic1] * S[m_ic2];
-        }
-    }
-
-    void incrementReaction(const doublereal* S, doublereal* R) const {
-        R[m_rxn] += S[m_ic0] + S[m_ic1] + S[m_ic2];
-    }
-
-    void decrementReaction(const doublereal* S, doublereal* R) const {
-        R[m_rxn] -= (S[m_ic0] + S[m_ic1] + S[m_ic2]);
-    }
-
-    size_t rxnNumber() const {
-        return m_rxn;
-    }
-    size_t speciesIndex(size_t n) const {
-        return (n == 0 ? m_ic0 : (n == 1 ? m_ic1 : m_ic2));
-    }
-    size_t nSpecies() {
-        return 3;
-    }
-
-private:
-    size_t m_rxn;
-    size_t m_ic0;
-    size_t m_ic1;
-    size_t m_ic2;
-};
-
 /**
  * Handles any number of species in a reaction, including fractional
  * stoichiometric coefficients, and arbitrary reaction orders.
@@ -340,6 +140,11 @@ public:
         return m_rxn;
     }
 
+    //! Change the index of the reaction handled by this object
+    void setReactionIndex(size_t rxn) {
+        m_rxn = rxn;
+    }
+
     doublereal order(size_t n) const {
         return m_order[n];
     }
@@ -394,6 +199,82 @@ public:
         }
     }
 
+    void multiply(const double* input, double* output, size_t n) const {
+        multiplyStates(input, output + m_rxn * n, n);
+    }
+
+    //! Multiply the rates `r` of this reaction for `n` states by the
+    //! concentration products, where `input[k*n + j]` is the concentration of
+    //! species `k` in state `j`.
+    void multiplyStates(const double* input, double* r, size_t n) const {
+        for (size_t i = 0; i < m_n; i++) {
+            double order = m_order[i];
+            if (order != 0.0) {
+                const double* c = input + m_ic[i] * n;
+                for (size_t j = 0; j < n; j++) {
+                    r[j] = (c[j] > 0.0) ? r[j] * std::pow(c[j], order) : 0.0;
+                }
+            }
+        }
+    }
+
+    //! Add `scale` times the rates `r` of this reaction for `n` states to the
+    //! species values `output[k*n + j]`.
+    void scatterStates(const double* r, double* output, double scale,
+                       size_t n) const {
+        for (size_t i = 0; i < m_n; i++) {
+            double f = scale * m_stoich[i];
+            if (f != 0.0) {
+                double* s = output + m_ic[i] * n;
+                for (size_t j = 0; j < n; j++) {
+                    s[j] += f * r[j];
+                }
+            }
+        }
+    }
+
+    void getDerivatives(const double* input, const double* rates,
+                        SparseTriplets& jac) const {
+        for (size_t n = 0; n < m_n; n++) {
+            if (m_order[n] == 0.0) {
+                continue;
+            }
+            double deriv = rates[m_rxn];
+            for (size_t m = 0; m < m_n; m++) {
+                double order = m_order[m];
+                double c = input[m_ic[m]];
+                if (m == n) {
+                    if (c > 0.0) {
+                        deriv *= order * std::pow(c, order - 1.0);
+                    } else if (order != 1.0) {
+                        deriv = 0.0;
+                    }
+                } else if (order != 0.0) {
+                    // consistent with multiply(), which clips the rate to
+                    // zero for non-positive concentrations
+                    deriv *= (c > 0.0) ? std::pow(c, order) : 0.0;
+                }
+            }
+            if (deriv != 0.0) {
+                jac.emplace_back(m_rxn, m_ic[n], deriv);
+            }
+        }
+    }
+
+    void getStoichCoeffs(SparseTriplets& coeffs, double scale) const {
+        for (size_t n = 0; n < m_n; n++) {
+            if (m_stoich[n] != 0.0) {
+                coeffs.emplace_back(m_ic[n], m_rxn, scale * m_stoich[n]);
+            }
+        }
+    }
+
+    //! Estimate of the memory used by this object, in bytes
+    size_t memoryUsage() const {
+        return vectorMemoryUsage(m_ic) + vectorMemoryUsage(m_order)
+            + vectorMemoryUsage(m_stoich);
+    }
+
 private:
     //! Length of the m_ic vector
     /*!
@@ -507,14 +388,16 @@ inline static void _decrementReactions(InputIter begin,
  * - \f$ R = R + N^T S \f$ (incrementReaction)
  * - \f$ R = R - N^T S \f$ (decrementReaction)
  *
- * The actual implementation, however, does not compute these quantities by
- * matrix multiplication. A faster algorithm is used that makes use of the fact
- * that the \b integer-valued N matrix is very sparse, and the non-zero terms
- * are small positive integers.
- * \f[
- * S_k = R_{i1} + \dots + R_{iM}
- * \f]
- * where M is the number of molecules, and $\f i(m) \f$ is the
+ * Reactions with integral stoichiometric coefficients equal to the reaction
+ * orders and at most three molecules are stored in flat arrays of reaction and
+ * species indices, i.e. in compressed sparse row format with one row per
+ * reaction. Each molecule is stored as a separate entry (a species with a
+ * stoichiometric coefficient of two appears twice), and the species indices
+ * within each row are sorted. The rows are grouped by the number of
+ * molecules, so that each kernel runs over rows of a fixed length. All other
+ * reactions, e.g. those with fractional coefficients or reaction orders, are
+ * handled by instances of class C_AnyN.
+ *
  * See @ref Stoichiometry
  * @ingroup Stoichiometry
  */
@@ -534,7 +417,7 @@ public:
      * DGG - the problem is that the number of reactions and species are not
      * known initially.
      */
-    StoichManagerN() {
+    StoichManagerN() : m_ready(false) {
     }
 
     /**
@@ -573,6 +456,7 @@ public:
      */
     void add(size_t rxn, const std::vector<size_t>& k, const vector_fp& order,
              const vector_fp& stoich) {
+        m_ready = false;
         if (order.size() != k.size()) {
            throw CanteraError("StoichManagerN::add()", "size of order and species arrays differ");
         }
@@ -586,13 +470,18 @@ public:
                 break;
             }
         }
+        if (rxn >= m_group.size()) {
+            m_group.resize(rxn + 1, 0);
+            m_offset.resize(rxn + 1, npos);
+        }
         if (frac || k.size() > 3) {
+            m_group[rxn] = 4;
+            m_offset[rxn] = m_cn_list.size();
             m_cn_list.emplace_back(rxn, k, order, stoich);
         } else {
             // Try to express the reaction with unity stoichiometric
             // coefficients (by repeating species when necessary) so that the
-            // simpler 'multiply' function can be used to compute the rate
-            // instead of 'power'.
+            // rate can be computed as a simple product of concentrations.
             std::vector<size_t> kRep;
             for (size_t n = 0; n < k.size(); n++) {
                 for (size_t i = 0; i < stoich[n]; i++) {
@@ -600,62 +489,517 @@ public:
                 }
             }
 
-            switch (kRep.size()) {
-            case 1:
-                m_c1_list.emplace_back(rxn, kRep[0]);
-                break;
-            case 2:
-                m_c2_list.emplace_back(rxn, kRep[0], kRep[1]);
-                break;
-            case 3:
-                m_c3_list.emplace_back(rxn, kRep[0], kRep[1], kRep[2]);
-                break;
-            default:
+            size_t w = kRep.size();
+            if (w >= 1 && w <= 3) {
+                std::sort(kRep.begin(), kRep.end());
+                m_group[rxn] = w;
+                m_offset[rxn] = m_rows[w-1].size();
+                m_rows[w-1].push_back(rxn);
+                m_rows[w-1].insert(m_rows[w-1].end(), kRep.begin(), kRep.end());
+            } else {
+                m_group[rxn] = 4;
+                m_offset[rxn] = m_cn_list.size();
                 m_cn_list.emplace_back(rxn, k, order, stoich);
             }
         }
     }
 
+    //! Return a copy of this manager in which reaction `rxn` has the index
+    //! `position[rxn]`.
+    /*!
+     * The reactions are stored in the copy in order of their new indices,
+     * so that its kernels access arrays in the new reaction order with
+     * increasing indices. finalize() must be called for the copy before its
+     * multi-state methods are used.
+     */
+    StoichManagerN permuted(const std::vector<size_t>& position) const {
+        std::vector<size_t> rxns;
+        for (size_t rxn = 0; rxn < m_group.size(); rxn++) {
+            if (m_group[rxn]) {
+                rxns.push_back(rxn);
+            }
+        }
+        std::sort(rxns.begin(), rxns.end(), [&](size_t a, size_t b) {
+            return position[a] < position[b];
+        });
+        StoichManagerN out;
+        for (size_t rxn : rxns) {
+            size_t p = position[rxn];
+            int w = m_group[rxn];
+            if (p >= out.m_group.size()) {
+                out.m_group.resize(p + 1, 0);
+                out.m_offset.resize(p + 1, npos);
+            }
+            out.m_group[p] = w;
+            if (w <= 3) {
+                const size_t* row = &m_rows[w-1][m_offset[rxn]];
+                std::vector<size_t>& rows = out.m_rows[w-1];
+                out.m_offset[p] = rows.size();
+                rows.push_back(p);
+                rows.insert(rows.end(), row + 1, row + 1 + w);
+            } else {
+                out.m_offset[p] = out.m_cn_list.size();
+                out.m_cn_list.push_back(m_cn_list[m_offset[rxn]]);
+                out.m_cn_list.back().setReactionIndex(p);
+            }
+        }
+        return out;
+    }
+
+    //! Prepare the arrays used by the multi-state methods. Must be called
+    //! after the last reaction has been added, and before any of the
+    //! multi-state methods is used.
+    /*!
+     * The stoichiometric coefficients are stored a second time in compressed
+     * sparse column format, i.e. the transpose of the row format used for the
+     * concentration products, with the reactions involving each species
+     * stored contiguously in order of the reaction index. The production
+     * rates of each species can then be gathered from the rates of its
+     * reactions, with each output written only once.
+     *
+     * @param nSpecies  Number of species
+     */
+    void finalize(size_t nSpecies) {
+        SparseTriplets coeffs;
+        getStoichCoeffs(coeffs);
+        std::sort(coeffs.begin(), coeffs.end(),
+            [](const Eigen::Triplet<double>& a, const Eigen::Triplet<double>& b) {
+                return a.row() < b.row()
+                    || (a.row() == b.row() && a.col() < b.col());
+            });
+        m_colStart.assign(nSpecies + 1, 0);
+        m_colRxn.clear();
+        m_colCoeff.clear();
+        for (const auto& t : coeffs) {
+            size_t k = t.row();
+            if (k >= nSpecies) {
+                throw CanteraError("StoichManagerN::finalize", "Species "
+                    "index {} is out of range ({})", k, nSpecies);
+            }
+            // merge repeated molecules of the same species
+            if (m_colStart[k+1] && m_colRxn.back() == size_t(t.col())) {
+                m_colCoeff.back() += t.value();
+            } else {
+                m_colRxn.push_back(t.col());
+                m_colCoeff.push_back(t.value());
+                m_colStart[k+1]++;
+            }
+        }
+        for (size_t k = 0; k < nSpecies; k++) {
+            m_colStart[k+1] += m_colStart[k];
+        }
+        m_ready = true;
+    }
+
     void multiply(const doublereal* input, doublereal* output) const {
-        _multiply(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _multiply(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _multiply(m_c3_list.begin(), m_c3_list.end(), input, output);
+        multiplyRows<1>(input, output);
+        multiplyRows<2>(input, output);
+        multiplyRows<3>(input, output);
         _multiply(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
     void incrementSpecies(const doublereal* input, doublereal* output) const {
-        _incrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _incrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _incrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
+        scatterRows<1>(input, output, 1.0);
+        scatterRows<2>(input, output, 1.0);
+        scatterRows<3>(input, output, 1.0);
         _incrementSpecies(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
     void decrementSpecies(const doublereal* input, doublereal* output) const {
-        _decrementSpecies(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _decrementSpecies(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _decrementSpecies(m_c3_list.begin(), m_c3_list.end(), input, output);
+        scatterRows<1>(input, output, -1.0);
+        scatterRows<2>(input, output, -1.0);
+        scatterRows<3>(input, output, -1.0);
         _decrementSpecies(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
+    //! @name Multi-state versions
+    //!
+    //! These methods operate on arrays holding values for `n` states at a
+    //! time. Species arrays are stored as `input[k*n + j]` and reaction
+    //! arrays as `output[i*n + j]` for species `k`, reaction `i` and state
+    //! `j`, so that the innermost loops run over contiguous states.
+    //! @{
+
+    void multiply(const double* input, double* output, size_t n) const {
+        multiplyRows<1>(input, output, n);
+        multiplyRows<2>(input, output, n);
+        multiplyRows<3>(input, output, n);
+        for (const auto& c : m_cn_list) {
+            c.multiply(input, output, n);
+        }
+    }
+
+    //! Requires finalize()
+    void incrementSpecies(const double* input, double* output, size_t n) const {
+        gatherColumns(input, output, 1.0, n);
+    }
+
+    //! Requires finalize()
+    void decrementSpecies(const double* input, double* output, size_t n) const {
+        gatherColumns(input, output, -1.0, n);
+    }
+    //! @}
+
+    //! @name Versions for a single reaction and multiple states
+    //!
+    //! These methods operate on the values `r[j]` of reaction `rxn` for `n`
+    //! states, and species arrays stored as `input[k*n + j]`. They do nothing
+    //! if reaction `rxn` is not handled by this manager. Calling them for
+    //! each reaction in turn allows the concentration products and the
+    //! production rates to be evaluated in a single pass over the reactions,
+    //! with the rates of progress of one reaction kept in a short work array.
+    //! @{
+
+    void multiply(size_t rxn, const double* input, double* r, size_t n) const {
+        switch (rxn < m_group.size() ? m_group[rxn] : 0) {
+        case 1:
+            multiplyRow<1>(&m_rows[0][m_offset[rxn]], input, r, n);
+            break;
+        case 2:
+            multiplyRow<2>(&m_rows[1][m_offset[rxn]], input, r, n);
+            break;
+        case 3:
+            multiplyRow<3>(&m_rows[2][m_offset[rxn]], input, r, n);
+            break;
+        case 4:
+            m_cn_list[m_offset[rxn]].multiplyStates(input, r, n);
+        }
+    }
+
+    void incrementSpecies(size_t rxn, const double* r, double* output,
+                          size_t n) const {
+        scatter(rxn, r, output, 1.0, n);
+    }
+
+    void decrementSpecies(size_t rxn, const double* r, double* output,
+                          size_t n) const {
+        scatter(rxn, r, output, -1.0, n);
+    }
+    //! @}
+
+    //! @name Versions for a subset of reactions
+    //!
+    //! These methods only evaluate the reactions whose indices are listed in
+    //! `rxns`. Reactions in the list which are not handled by this manager
+    //! are skipped. The results for each reaction are identical to those of
+    //! the versions evaluating all reactions.
+    //! @{
+
+    void multiply(const double* input, double* output,
+                  const std::vector<size_t>& rxns) const {
+        for (size_t i : rxns) {
+            switch (i < m_group.size() ? m_group[i] : 0) {
+            case 1:
+                multiplyRow<1>(&m_rows[0][m_offset[i]], input, output);
+                break;
+            case 2:
+                multiplyRow<2>(&m_rows[1][m_offset[i]], input, output);
+                break;
+            case 3:
+                multiplyRow<3>(&m_rows[2][m_offset[i]], input, output);
+                break;
+            case 4:
+                m_cn_list[m_offset[i]].multiply(input, output);
+            }
+        }
+    }
+
+    void incrementSpecies(const double* input, double* output,
+                          const std::vector<size_t>& rxns) const {
+        scatter(input, output, 1.0, rxns);
+    }
+
+    void decrementSpecies(const double* input, double* output,
+                          const std::vector<size_t>& rxns) const {
+        scatter(input, output, -1.0, rxns);
+    }
+    //! @}
+
     void incrementReactions(const doublereal* input, doublereal* output) const {
-        _incrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _incrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _incrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output);
+        gatherRows<1>(input, output, 1.0);
+        gatherRows<2>(input, output, 1.0);
+        gatherRows<3>(input, output, 1.0);
         _incrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
     void decrementReactions(const doublereal* input, doublereal* output) const {
-        _decrementReactions(m_c1_list.begin(), m_c1_list.end(), input, output);
-        _decrementReactions(m_c2_list.begin(), m_c2_list.end(), input, output);
-        _decrementReactions(m_c3_list.begin(), m_c3_list.end(), input, output);
+        gatherRows<1>(input, output, -1.0);
+        gatherRows<2>(input, output, -1.0);
+        gatherRows<3>(input, output, -1.0);
         _decrementReactions(m_cn_list.begin(), m_cn_list.end(), input, output);
     }
 
+    //! Append the derivatives of the concentration products computed by
+    //! multiply() to the list of sparse matrix entries `jac`.
+    /*!
+     * Each entry has the reaction index as its row and the species index as
+     * its column, and the value of the derivative of
+     * `rates[i] * prod_k(input[k]^order_k)` with respect to `input[k]`.
+     * Duplicate entries are summed when the matrix is assembled.
+     *
+     * @param input   Species concentrations. Length: number of species.
+     * @param rates   Multipliers for each reaction (for example, rate
+     *     constants). Length: number of reactions.
+     * @param jac     List of sparse matrix entries to append to.
+     */
+    void getDerivatives(const double* input, const double* rates,
+                        SparseTriplets& jac) const {
+        for (size_t w = 1; w <= 3; w++) {
+            const std::vector<size_t>& rows = m_rows[w-1];
+            for (size_t i = 0; i < rows.size(); i += w + 1) {
+                size_t rxn = rows[i];
+                const size_t* k = &rows[i+1];
+                int nNegative = 0;
+                for (size_t n = 0; n < w; n++) {
+                    nNegative += (input[k[n]] < 0);
+                }
+                if (nNegative > 1) {
+                    continue; // rate is clipped to zero in multiply()
+                }
+                for (size_t n = 0; n < w; n++) {
+                    double deriv = rates[rxn];
+                    for (size_t m = 0; m < w; m++) {
+                        if (m != n) {
+                            deriv *= input[k[m]];
+                        }
+                    }
+                    jac.emplace_back(rxn, k[n], deriv);
+                }
+            }
+        }
+        for (const auto& c : m_cn_list) {
+            c.getDerivatives(input, rates, jac);
+        }
+    }
+
+    //! Append the stoichiometric coefficients handled by this manager,
+    //! multiplied by `scale`, to the list of sparse matrix entries `coeffs`.
+    //! Each entry has the species index as its row and the reaction index as
+    //! its column.
+    void getStoichCoeffs(SparseTriplets& coeffs, double scale=1.0) const {
+        for (size_t w = 1; w <= 3; w++) {
+            const std::vector<size_t>& rows = m_rows[w-1];
+            for (size_t i = 0; i < rows.size(); i += w + 1) {
+                for (size_t n = 1; n <= w; n++) {
+                    coeffs.emplace_back(rows[i+n], rows[i], scale);
+                }
+            }
+        }
+        for (const auto& c : m_cn_list) {
+            c.getStoichCoeffs(coeffs, scale);
+        }
+    }
+
+    //! Estimate of the memory used by this manager, in bytes
+    size_t memoryUsage() const {
+        size_t usage = vectorMemoryUsage(m_group) + vectorMemoryUsage(m_offset)
+            + vectorMemoryUsage(m_colStart) + vectorMemoryUsage(m_colRxn)
+            + vectorMemoryUsage(m_colCoeff) + vectorMemoryUsage(m_cn_list);
+        for (const auto& rows : m_rows) {
+            usage += vectorMemoryUsage(rows);
+        }
+        for (const auto& c : m_cn_list) {
+            usage += c.memoryUsage();
+        }
+        return usage;
+    }
+
 private:
-    std::vector<C1> m_c1_list;
-    std::vector<C2> m_c2_list;
-    std::vector<C3> m_c3_list;
+    //! Multiply the rate for each reaction with `N` molecules by the product
+    //! of the concentrations. The rate is set to zero if more than one of the
+    //! concentrations is negative.
+    template<size_t N>
+    void multiplyRows(const double* S, double* R) const {
+        const size_t* row = m_rows[N-1].data();
+        const size_t* end = row + m_rows[N-1].size();
+        for (; row != end; row += N + 1) {
+            multiplyRow<N>(row, S, R);
+        }
+    }
+
+    template<size_t N>
+    static void multiplyRow(const size_t* row, const double* S, double* R) {
+        const size_t* k = row + 1;
+        if (clipped<N>(S, k)) {
+            R[row[0]] = 0.0;
+        } else {
+            double prod = S[k[0]];
+            for (size_t m = 1; m < N; m++) {
+                prod *= S[k[m]];
+            }
+            R[row[0]] *= prod;
+        }
+    }
+
+    template<size_t N>
+    void multiplyRows(const double* S, double* R, size_t n) const {
+        const size_t* row = m_rows[N-1].data();
+        const size_t* end = row + m_rows[N-1].size();
+        for (; row != end; row += N + 1) {
+            multiplyRow<N>(row, S, R + row[0] * n, n);
+        }
+    }
+
+    //! Multiply the values `r` of the reaction in `row` for `n` states by the
+    //! concentration products
+    template<size_t N>
+    static void multiplyRow(const size_t* row, const double* S, double* r,
+                            size_t n) {
+        const size_t* k = row + 1;
+        for (size_t j = 0; j < n; j++) {
+            double c[N];
+            double prod = 1.0;
+            for (size_t m = 0; m < N; m++) {
+                c[m] = S[k[m] * n + j];
+                prod *= c[m];
+            }
+            r[j] = clipped<N>(c) ? 0.0 : r[j] * prod;
+        }
+    }
+
+    //! True if more than one of the `N` concentrations `S[k[m]]` is negative
+    template<size_t N>
+    static bool clipped(const double* S, const size_t* k) {
+        if (N == 2) {
+            return S[k[0]] < 0 && S[k[1]] < 0;
+        } else if (N == 3) {
+            return (S[k[0]] < 0 && (S[k[1]] < 0 || S[k[2]] < 0)) ||
+                   (S[k[1]] < 0 && S[k[2]] < 0);
+        }
+        return false;
+    }
+
+    template<size_t N>
+    static bool clipped(const double* c) {
+        size_t k[3] = {0, 1, 2};
+        return clipped<N>(c, k);
+    }
+
+    //! Add `scale` times the rate of each reaction with `N` molecules to the
+    //! species production rates
+    template<size_t N>
+    void scatterRows(const double* R, double* S, double scale) const {
+        const size_t* row = m_rows[N-1].data();
+        const size_t* end = row + m_rows[N-1].size();
+        for (; row != end; row += N + 1) {
+            const size_t* k = row + 1;
+            double r = scale * R[row[0]];
+            for (size_t m = 0; m < N; m++) {
+                S[k[m]] += r;
+            }
+        }
+    }
+
+    //! Add `scale` times the values `R[i*n + j]` of the reactions involving
+    //! each species to the species values `S[k*n + j]`
+    void gatherColumns(const double* R, double* S, double scale,
+                       size_t n) const {
+        if (!m_ready) {
+            throw CanteraError("StoichManagerN::gatherColumns",
+                               "finalize() has not been called.");
+        }
+        size_t nSpecies = m_colStart.size() - 1;
+        for (size_t k = 0; k < nSpecies; k++) {
+            double* s = S + k * n;
+            for (size_t e = m_colStart[k]; e < m_colStart[k+1]; e++) {
+                const double* r = R + m_colRxn[e] * n;
+                double f = scale * m_colCoeff[e];
+                for (size_t j = 0; j < n; j++) {
+                    s[j] += f * r[j];
+                }
+            }
+        }
+    }
+
+    //! Add `scale` times the values `r` of reaction `rxn` for `n` states to
+    //! the species values `S[k*n + j]`
+    void scatter(size_t rxn, const double* r, double* S, double scale,
+                 size_t n) const {
+        size_t w = rxn < m_group.size() ? m_group[rxn] : 0;
+        if (w >= 1 && w <= 3) {
+            const size_t* k = &m_rows[w-1][m_offset[rxn] + 1];
+            for (size_t m = 0; m < w; m++) {
+                double* s = S + k[m] * n;
+                for (size_t j = 0; j < n; j++) {
+                    s[j] += scale * r[j];
+                }
+            }
+        } else if (w == 4) {
+            m_cn_list[m_offset[rxn]].scatterStates(r, S, scale, n);
+        }
+    }
+
+    void scatter(const double* R, double* S, double scale,
+                 const std::vector<size_t>& rxns) const {
+        for (size_t i : rxns) {
+            size_t w = i < m_group.size() ? m_group[i] : 0;
+            if (w >= 1 && w <= 3) {
+                const size_t* row = &m_rows[w-1][m_offset[i]];
+                double r = scale * R[row[0]];
+                for (size_t m = 1; m <= w; m++) {
+                    S[row[m]] += r;
+                }
+            } else if (w == 4) {
+                if (scale > 0) {
+                    m_cn_list[m_offset[i]].incrementSpecies(R, S);
+                } else {
+                    m_cn_list[m_offset[i]].decrementSpecies(R, S);
+                }
+            }
+        }
+    }
+
+    //! Add `scale` times the sum of the species properties of the molecules
+    //! in each reaction with `N` molecules to the reaction property
+    template<size_t N>
+    void gatherRows(const double* S, double* R, double scale) const {
+        const size_t* row = m_rows[N-1].data();
+        const size_t* end = row + m_rows[N-1].size();
+        for (; row != end; row += N + 1) {
+            const size_t* k = row + 1;
+            double sum = 0.0;
+            for (size_t m = 0; m < N; m++) {
+                sum += S[k[m]];
+            }
+            R[row[0]] += scale * sum;
+        }
+    }
+
+    //! @name Compressed representation of reactions with mass-action rates
+    //!
+    //! Reactions with one, two and three molecules are stored in separate
+    //! groups, so that all rows within a group have the same length. Each row
+    //! of `m_rows[w-1]` occupies `w + 1` consecutive entries: the reaction
+    //! index, followed by the (sorted) species indices of the `w` molecules.
+    //! Keeping the reaction index next to the species indices means each
+    //! row is read from a single contiguous stream.
+    std::vector<size_t> m_rows[3];
+
+    //! Reactions with general stoichiometric coefficients or reaction orders
     std::vector<C_AnyN> m_cn_list;
+
+    //! Location of each reaction, indexed by reaction number. For a reaction
+    //! with `w` molecules stored in #m_rows, `m_group[i]` is `w` and
+    //! `m_offset[i]` is the position of its row in `m_rows[w-1]`. For a
+    //! reaction in #m_cn_list, `m_group[i]` is 4 and `m_offset[i]` is its
+    //! position in that list. `m_group[i]` is 0 for reactions which are not
+    //! handled by this manager.
+    std::vector<int> m_group;
+    std::vector<size_t> m_offset;
+
+    //! @name Compressed sparse column representation
+    //!
+    //! Entries `m_colStart[k]` to `m_colStart[k+1] - 1` of #m_colRxn and
+    //! #m_colCoeff are the reactions involving species `k` and the
+    //! corresponding stoichiometric coefficients. Set up by finalize().
+    //! @{
+    std::vector<size_t> m_colStart;
+    std::vector<size_t> m_colRxn;
+    vector_fp m_colCoeff;
+    //! @}
+
+    //! True if finalize() has been called since the last reaction was added
+    bool m_ready;
 };
 
 }
@@ -0,0 +1,161 @@
+/**
+ * @file TemperatureTable.h
+ * Tabulation of temperature-dependent quantities (see
+ * \link Cantera::TemperatureTable TemperatureTable\endlink).
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_TEMPERATURETABLE_H
+#define CT_TEMPERATURETABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace Cantera
+{
+
+//! A table of functions of temperature, which are evaluated by cubic
+//! interpolation on a uniform grid in the inverse temperature.
+/*!
+ * The values of all functions at one grid point are stored contiguously, so
+ * that an evaluation reads four consecutive rows of the table. The number of
+ * grid intervals is doubled until the error of interpolating each function
+ * at the midpoints of all intervals satisfies
+ * \f[
+ *     |f_{interp} - f| \le \epsilon_r |f| + \epsilon_a
+ * \f]
+ * where the relative tolerance \f$ \epsilon_r \f$ is the same for all
+ * functions and the absolute tolerance \f$ \epsilon_a \f$ is specified for
+ * each function.
+ *
+ * Temperatures where the functions or their derivatives may be
+ * discontinuous, e.g. the midpoint temperatures of NASA polynomials, can be
+ * given as breakpoints. The table then consists of segments between the
+ * breakpoints, each with its own grid, and interpolation does not use grid
+ * points from other segments.
+ *
+ * Tables are immutable once created. Identical tables, e.g. those created by
+ * several kinetics managers for the same mechanism, can be shared using
+ * share().
+ * @ingroup chemkinetics
+ */
+class TemperatureTable
+{
+public:
+    //! Create a table
+    /*!
+     * @param Tmin  Lowest temperature of the table [K]
+     * @param Tmax  Highest temperature of the table [K]
+     * @param nValues  Number of tabulated functions
+     * @param f  Function which writes the values of the tabulated functions
+     *     at the temperature given as the first argument into the array
+     *     given as the second argument
+     * @param rtol  Relative tolerance for the interpolation error
+     * @param atol  Absolute tolerance for the interpolation error of each
+     *     function. Length `nValues`.
+     * @param breakpoints  Temperatures separating the segments of the table.
+     *     Values outside of (`Tmin`, `Tmax`) are ignored.
+     * @param maxIntervals  Largest number of grid intervals in each segment.
+     *     A CanteraError is thrown if the tolerance is not satisfied with
+     *     this many intervals.
+     */
+    TemperatureTable(double Tmin, double Tmax, size_t nValues,
+                     const std::function<void(double, double*)>& f,
+                     double rtol, const vector_fp& atol,
+                     const vector_fp& breakpoints={},
+                     size_t maxIntervals=16384);
+
+    //! Interpolate the tabulated functions at temperature `T`. Returns
+    //! `false` without modifying `values` if `T` is outside the table.
+    bool interpolate(double T, double* values) const {
+        if (T < m_bounds.front() || T > m_bounds.back()) {
+            return false;
+        }
+        size_t seg = 0;
+        if (m_bounds.size() > 2) {
+            seg = std::upper_bound(m_bounds.begin() + 1, m_bounds.end() - 1, T)
+                  - (m_bounds.begin() + 1);
+        }
+        double s = (1.0 / T - m_x0[seg]) * m_rdx[seg];
+        size_t j = std::min(static_cast<size_t>(std::max(s - 1.0, 0.0)),
+                            m_nIntervals[seg] - 3);
+        interpolateRows(&m_data[(m_offset[seg] + j) * m_nValues], s - j,
+                        values);
+        return true;
+    }
+
+    double minTemp() const {
+        return m_bounds.front();
+    }
+
+    double maxTemp() const {
+        return m_bounds.back();
+    }
+
+    //! Number of tabulated functions
+    size_t nValues() const {
+        return m_nValues;
+    }
+
+    //! Number of segments separated by breakpoints
+    size_t nSegments() const {
+        return m_x0.size();
+    }
+
+    //! Total number of grid intervals in all segments
+    size_t nIntervals() const;
+
+    //! True if both tables have the same segments and contents
+    bool operator==(const TemperatureTable& other) const;
+
+    //! Return a table with the same contents as `table` which is used by
+    //! other objects, if one exists, or otherwise `table` itself. The tables
+    //! passed to this function are kept in a registry as long as they are in
+    //! use.
+    static shared_ptr<const TemperatureTable> share(
+        shared_ptr<const TemperatureTable> table);
+
+protected:
+    //! Evaluate the cubic polynomial through the four rows starting at `d0`
+    //! at position `t` relative to the first row, in units of the grid
+    //! spacing.
+    void interpolateRows(const double* d0, double t, double* values) const {
+        double w0 = -(t - 1) * (t - 2) * (t - 3) / 6;
+        double w1 = t * (t - 2) * (t - 3) / 2;
+        double w2 = -t * (t - 1) * (t - 3) / 2;
+        double w3 = t * (t - 1) * (t - 2) / 6;
+        const double* d1 = d0 + m_nValues;
+        const double* d2 = d1 + m_nValues;
+        const double* d3 = d2 + m_nValues;
+        for (size_t n = 0; n < m_nValues; n++) {
+            values[n] = w0 * d0[n] + w1 * d1[n] + w2 * d2[n] + w3 * d3[n];
+        }
+    }
+
+    size_t m_nValues;
+
+    //! Temperatures bounding the segments, in increasing order
+    vector_fp m_bounds;
+
+    //! @name Grid of each segment
+    //! @{
+    vector_fp m_x0; //!< Inverse temperature of the first grid point
+    vector_fp m_rdx; //!< Reciprocal of the grid spacing
+    std::vector<size_t> m_nIntervals; //!< Number of grid intervals
+    std::vector<size_t> m_offset; //!< Row of the first grid point
+    //! @}
+
+    //! Values of the functions, with a row for each grid point
+    vector_fp m_data;
+
+    //! Checksum of #m_data, used to find identical tables
+    size_t m_checksum;
+};
+
+}
+
+#endif
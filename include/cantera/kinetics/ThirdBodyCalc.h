@@ -9,6 +9,8 @@
 #define CT_THIRDBODYCALC_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/base/utilities.h"
+#include "cantera/numerics/eigen_sparse.h"
 #include <cassert>
 
 namespace Cantera
@@ -16,52 +18,169 @@ namespace Cantera
 
 //! Calculate and apply third-body effects on reaction rates, including non-
 //! unity third-body efficiencies.
+/*!
+ * The enhanced third-body concentration of each reaction is
+ * \f[
+ *     M_i = \epsilon_{d,i} C_{tot} + \sum_k (\epsilon_{ik} - \epsilon_{d,i}) C_k
+ * \f]
+ * where \f$ \epsilon_{d,i} \f$ is the default efficiency. The matrix of
+ * efficiency differences is stored in compressed sparse row format, with one
+ * row per reaction, so that all \f$ M_i \f$ are evaluated as a single
+ * sparse matrix-vector product.
+ */
 class ThirdBodyCalc
 {
 public:
+    ThirdBodyCalc() : m_rowStart(1, 0) {}
+
     void install(size_t rxnNumber, const std::map<size_t, double>& enhanced,
                  double dflt=1.0) {
         m_reaction_index.push_back(rxnNumber);
         m_default.push_back(dflt);
 
-        m_species.emplace_back();
-        m_eff.emplace_back();
         for (const auto& eff : enhanced) {
             assert(eff.first != npos);
-            m_species.back().push_back(eff.first);
-            m_eff.back().push_back(eff.second - dflt);
+            m_species.push_back(eff.first);
+            m_eff.push_back(eff.second - dflt);
         }
+        m_rowStart.push_back(m_species.size());
     }
 
-    void update(const vector_fp& conc, double ctot, double* work) {
-        for (size_t i = 0; i < m_species.size(); i++) {
+    void update(const vector_fp& conc, double ctot, double* work) const {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
             double sum = 0.0;
-            for (size_t j = 0; j < m_species[i].size(); j++) {
-                sum += m_eff[i][j] * conc[m_species[i][j]];
+            for (size_t j = m_rowStart[i]; j < m_rowStart[i+1]; j++) {
+                sum += m_eff[j] * conc[m_species[j]];
             }
             work[i] = m_default[i] * ctot + sum;
         }
     }
 
-    void multiply(double* output, const double* work) {
+    //! Calculate the enhanced third-body concentrations of the reactions
+    //! `i` for which `active[i]` is non-zero, where `i` is the reaction
+    //! number given to install(). Other entries of `work` are not modified.
+    void update(const vector_fp& conc, double ctot, double* work,
+                const std::vector<char>& active) const {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            if (!active[m_reaction_index[i]]) {
+                continue;
+            }
+            double sum = 0.0;
+            for (size_t j = m_rowStart[i]; j < m_rowStart[i+1]; j++) {
+                sum += m_eff[j] * conc[m_species[j]];
+            }
+            work[i] = m_default[i] * ctot + sum;
+        }
+    }
+
+    //! Calculate the enhanced third-body concentrations for `n` states.
+    /*!
+     * @param conc  Species concentrations, where `conc[k*n + j]` is the
+     *     concentration of species `k` in state `j`
+     * @param ctot  Total concentration of each state. Length: `n`.
+     * @param work  Output array, where `work[i*n + j]` is the third-body
+     *     concentration of the `i`-th installed reaction in state `j`.
+     *     Length: `n * workSize()`.
+     * @param n  Number of states
+     */
+    void update(const double* conc, const double* ctot, double* work,
+                size_t n) const {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            double* M = work + i * n;
+            for (size_t j = 0; j < n; j++) {
+                M[j] = m_default[i] * ctot[j];
+            }
+            for (size_t m = m_rowStart[i]; m < m_rowStart[i+1]; m++) {
+                const double* c = conc + m_species[m] * n;
+                double eff = m_eff[m];
+                for (size_t j = 0; j < n; j++) {
+                    M[j] += eff * c[j];
+                }
+            }
+        }
+    }
+
+    void multiply(double* output, const double* work) const {
         for (size_t i = 0; i < m_reaction_index.size(); i++) {
             output[m_reaction_index[i]] *= work[i];
         }
     }
 
-    size_t workSize() {
+    //! Multiply the rates of `n` states by the third-body concentrations
+    //! calculated by the multi-state version of update(). The rate of
+    //! reaction `i` in state `j` is `output[i*n + j]`.
+    void multiply(double* output, const double* work, size_t n) const {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            double* r = output + m_reaction_index[i] * n;
+            const double* M = work + i * n;
+            for (size_t j = 0; j < n; j++) {
+                r[j] *= M[j];
+            }
+        }
+    }
+
+    //! Append the derivatives of `rates[i] * M_i` with respect to the species
+    //! concentrations to the list of sparse matrix entries `jac`, where `M_i`
+    //! is the enhanced third-body concentration of reaction `i`.
+    /*!
+     * Entries have the reaction index as row and the species index as
+     * column. The default efficiency applies to all `nSpecies` species, since
+     * the total concentration is the sum of the species concentrations.
+     *
+     * @param rates  Multipliers indexed by the reaction number given to
+     *     install(). Only the entries for installed reactions are read.
+     * @param nSpecies  Number of species in the mechanism
+     * @param jac  List of sparse matrix entries to append to
+     */
+    void getDerivatives(const double* rates, size_t nSpecies,
+                        SparseTriplets& jac) const {
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            size_t irxn = m_reaction_index[i];
+            double r = rates[irxn];
+            if (r == 0.0) {
+                continue;
+            }
+            if (m_default[i] != 0.0) {
+                for (size_t k = 0; k < nSpecies; k++) {
+                    jac.emplace_back(irxn, k, m_default[i] * r);
+                }
+            }
+            for (size_t j = m_rowStart[i]; j < m_rowStart[i+1]; j++) {
+                jac.emplace_back(irxn, m_species[j], m_eff[j] * r);
+            }
+        }
+    }
+
+    //! Reaction numbers of the installed reactions, in the order used for
+    //! the work array
+    const std::vector<size_t>& reactionIndices() const {
+        return m_reaction_index;
+    }
+
+    size_t workSize() const {
         return m_reaction_index.size();
     }
 
+    //! Estimate of the memory used by this object, in bytes
+    size_t memoryUsage() const {
+        return vectorMemoryUsage(m_reaction_index) + vectorMemoryUsage(m_rowStart)
+            + vectorMemoryUsage(m_species) + vectorMemoryUsage(m_eff)
+            + vectorMemoryUsage(m_default);
+    }
+
 protected:
     //! Indices of third-body reactions within the full reaction array
     std::vector<size_t> m_reaction_index;
 
-    //! m_species[i][j] is the index of the j-th species in reaction i.
-    std::vector<std::vector<size_t> > m_species;
+    //! The non-default efficiencies of reaction i are stored in positions
+    //! m_rowStart[i] to m_rowStart[i+1]-1 of m_species and m_eff
+    std::vector<size_t> m_rowStart;
+
+    //! Species indices of the non-default efficiencies
+    std::vector<size_t> m_species;
 
-    //! m_eff[i][j] is the efficiency of the j-th species in reaction i.
-    std::vector<vector_fp> m_eff;
+    //! Differences between the species efficiencies and the default efficiency
+    vector_fp m_eff;
 
     //! The default efficiency for each reaction
     vector_fp m_default;
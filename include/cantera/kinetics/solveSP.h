@@ -288,11 +288,15 @@ private:
 
     //! Main routine that calculates the current residual and Jacobian
     /*!
+     *  The Jacobian is assembled from the analytic derivatives of the net
+     *  production rates (InterfaceKinetics::netProductionRates_ddC()), except
+     *  when the bulk phase compositions are calculated, in which case it is
+     *  evaluated by finite differences using resjac_eval_fd().
+     *
      *  @param jac     Jacobian to be evaluated.
      *  @param resid   output Vector of residuals, length = m_neq
      *  @param CSolnSP  Vector of species concentrations, unknowns in the
-     *                  problem, length = m_neq. These are tweaked in order
-     *                  to derive the columns of the Jacobian.
+     *                  problem, length = m_neq.
      *  @param CSolnSPOld Old Vector of species concentrations, unknowns in the
      *                  problem, length = m_neq
      *  @param do_time Calculate a time dependent residual
@@ -303,6 +307,22 @@ private:
                      const doublereal* CSolnSPOld, const bool do_time,
                      const doublereal deltaT);
 
+    //! Calculate the Jacobian by finite differences
+    /*!
+     *  @param jac     Jacobian to be evaluated.
+     *  @param resid   Vector of residuals at CSolnSP, length = m_neq
+     *  @param CSolnSP  Vector of species concentrations, unknowns in the
+     *                  problem, length = m_neq. These are tweaked in order
+     *                  to derive the columns of the Jacobian.
+     *  @param CSolnSPOld Old Vector of species concentrations, unknowns in the
+     *                  problem, length = m_neq
+     *  @param do_time Calculate a time dependent residual
+     *  @param deltaT  Delta time for time dependent problem.
+     */
+    void resjac_eval_fd(DenseMatrix& jac, const doublereal* resid,
+                        doublereal* CSolnSP, const doublereal* CSolnSPOld,
+                        const bool do_time, const doublereal deltaT);
+
     //! Pointer to the manager of the implicit surface chemistry problem
     /*!
      *  This object actually calls the current object. Thus, we are providing a
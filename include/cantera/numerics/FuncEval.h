@@ -49,6 +49,28 @@ public:
      */
     int eval_nothrow(double t, double* y, double* ydot);
 
+    //! Evaluate the Jacobian of the right-hand-side function. Called by the
+    //! integrator if the problem type includes JAC.
+    /*!
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[in] ydot right-hand side evaluated at `t` and `y`, length neq()
+     * @param[out] jac Jacobian matrix in column-major order, where
+     *     `jac[j*neq() + i]` is the derivative of `ydot[i]` with respect to
+     *     `y[j]`. Length neq() * neq().
+     */
+    virtual void evalJacobian(double t, double* y, double* ydot, double* jac) {
+        throw NotImplementedError("FuncEval::evalJacobian");
+    }
+
+    //! Evaluate the Jacobian using return code to indicate status.
+    /*!
+     * @see eval_nothrow()
+     * @returns 0 for a successful evaluation; 1 after a potentially-
+     *      recoverable error; -1 after an unrecoverable error.
+     */
+    int evalJacobian_nothrow(double t, double* y, double* ydot, double* jac);
+
     //! Fill in the vector *y* with the current state of the system
     virtual void getState(double* y) {
         throw NotImplementedError("FuncEval::getState");
@@ -89,6 +111,10 @@ public:
     vector_fp m_paramScales;
 
 protected:
+    //! Store or print the exception currently being handled, which was thrown
+    //! by `method`. Returns 1 for a CanteraError and -1 otherwise.
+    int handleError(const std::string& method);
+
     // If true, errors are accumulated in m_errors. Otherwise, they are printed
     bool m_suppress_errors;
 
@@ -0,0 +1,22 @@
+//! @file eigen_sparse.h Wrapper for either system-installed or local headers
+//!     for the sparse matrix module of Eigen
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_EIGEN_SPARSE_H
+#define CT_EIGEN_SPARSE_H
+
+#include "cantera/base/ct_defs.h"
+#if CT_USE_SYSTEM_EIGEN
+#include <Eigen/Sparse>
+#else
+#include "cantera/ext/Eigen/Sparse"
+#endif
+
+namespace Cantera {
+    //! List of (row, column, value) entries used to assemble a sparse matrix
+    typedef std::vector<Eigen::Triplet<double>> SparseTriplets;
+}
+
+#endif
@@ -75,10 +75,16 @@ public:
         m_thermo = &th;
     }
 
-    //! Set the kinetics manager. The kinetics manager must
-    void setKinetics(Kinetics& kin) {
-        m_kin = &kin;
-    }
+    //! Set the kinetics manager.
+    /*!
+     * If the kinetics manager is a GasKinetics object with quasi-steady-state
+     * species (see GasKinetics::setQuasiSteadySpecies), the mass fractions of
+     * these species are removed from the solution vector and are held at
+     * zero. The QSS species must therefore be specified before this method is
+     * called, and this method must be called before the domain is used to
+     * construct a Sim1D object if the set of QSS species changes.
+     */
+    void setKinetics(Kinetics& kin);
 
     //! set the transport manager
     void setTransport(Transport& trans);
@@ -285,6 +291,24 @@ public:
         return m_kExcessRight;
     }
 
+    //! Number of species whose mass fractions are components of the solution
+    //! vector. This excludes quasi-steady-state species. @see setKinetics
+    size_t nStateSpecies() const {
+        return m_stateSpecies.size();
+    }
+
+    //! Index in the phase of the species with the mass fraction stored in
+    //! solution component `c_offset_Y + n`
+    size_t stateSpecies(size_t n) const {
+        return m_stateSpecies[n];
+    }
+
+    //! Index of the solution component for the mass fraction of species *k*,
+    //! or npos for quasi-steady-state species
+    size_t speciesComponent(size_t k) const {
+        return (m_stateIndex[k] == npos) ? npos : c_offset_Y + m_stateIndex[k];
+    }
+
 protected:
     doublereal wdot(size_t k, size_t j) const {
         return m_wdot(k,j);
@@ -351,16 +375,16 @@ protected:
         return x[index(c_offset_L, j)];
     }
 
+    //! Mass fraction of species *k* at point *j*. Quasi-steady-state species,
+    //! which are not part of the solution vector, have zero mass fraction.
     doublereal Y(const doublereal* x, size_t k, size_t j) const {
-        return x[index(c_offset_Y + k, j)];
-    }
-
-    doublereal& Y(doublereal* x, size_t k, size_t j) {
-        return x[index(c_offset_Y + k, j)];
+        size_t n = m_stateIndex[k];
+        return (n == npos) ? 0.0 : x[index(c_offset_Y + n, j)];
     }
 
     doublereal Y_prev(size_t k, size_t j) const {
-        return prevSoln(c_offset_Y + k, j);
+        size_t n = m_stateIndex[k];
+        return (n == npos) ? 0.0 : prevSoln(c_offset_Y + n, j);
     }
 
     doublereal X(const doublereal* x, size_t k, size_t j) const {
@@ -440,6 +464,17 @@ protected:
 
     size_t m_nsp;
 
+    //! Indices of the species in the solution vector. @see stateSpecies()
+    std::vector<size_t> m_stateSpecies;
+
+    //! Position of each species in #m_stateSpecies, or npos for
+    //! quasi-steady-state species
+    std::vector<size_t> m_stateIndex;
+
+    //! Mass fractions of all species at one point, used when some species are
+    //! not part of the solution vector
+    vector_fp m_ywork;
+
     IdealGasPhase* m_thermo;
     Kinetics* m_kin;
     Transport* m_trans;
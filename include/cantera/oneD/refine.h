@@ -48,6 +48,11 @@ public:
         m_active[comp] = state;
     }
 
+    //! True if component `comp` is used in the refinement criteria
+    bool active(size_t comp) const {
+        return m_active[comp];
+    }
+
     //! Set the maximum number of points allowed in the domain
     void setMaxPoints(int npmax) {
         m_npmax = npmax;
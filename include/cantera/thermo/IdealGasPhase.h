@@ -552,6 +552,9 @@ public:
     virtual void getIntEnergy_RT_ref(doublereal* urt) const;
     virtual void getCp_R_ref(doublereal* cprt) const;
     virtual void getStandardVolumes_ref(doublereal* vol) const;
+    virtual void getReferenceProperties(size_t nT, const double* T,
+                                        double* cp_R, double* h_RT,
+                                        double* s_R, double* g_RT);
 
     //@}
     /// @name NonVirtual Internal methods to Return References to Reference State Thermo
@@ -603,6 +606,14 @@ public:
     virtual void setToEquilState(const doublereal* lambda_RT);
 
 protected:
+    //! Solves for the temperatures of all states together when all species
+    //! use NASA polynomials, since the enthalpy and internal energy of an
+    //! ideal gas don't depend on the pressure or density. See
+    //! MultiSpeciesThermo::solveNasaTemperatures().
+    virtual std::vector<size_t> getTemperatures_HPorUV(
+        size_t n, const double* h, const double* p, const double* Y,
+        double* T, double tol, bool doUV);
+
     //! Reference state pressure
     /*!
      *  Value of the reference state pressure in Pascals.
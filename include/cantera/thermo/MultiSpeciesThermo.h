@@ -97,6 +97,63 @@ public:
     virtual void update(doublereal T, doublereal* cp_R,
                         doublereal* h_RT, doublereal* s_R) const;
 
+    //! Compute the reference-state properties for all species at several
+    //! temperatures.
+    /*!
+     * The values for species `k` at temperature `T[i]` are stored at index
+     * `i * nsp + k` of the output arrays, where `nsp` is the number of
+     * species, i.e. the largest index of an installed species plus one. For
+     * each parameterization type, the temperature polynomial is computed once
+     * for each temperature and then used for all species of that type.
+     *
+     * @param nT      Number of temperatures
+     * @param T       Temperatures (Kelvin). Length `nT`.
+     * @param cp_R    Dimensionless heat capacities. Length `nT * nsp`.
+     * @param h_RT    Dimensionless enthalpies. Length `nT * nsp`.
+     * @param s_R     Dimensionless entropies. Length `nT * nsp`.
+     */
+    virtual void update(size_t nT, const double* T, double* cp_R,
+                        double* h_RT, double* s_R) const;
+
+    //! True if all species use NasaPoly2 parameterizations, which is
+    //! required by solveNasaTemperatures().
+    bool allNasaPoly() const {
+        return m_nasa_start == 0 && m_nasa_tmid.size() == m_installed.size();
+    }
+
+    //! Find the temperatures at which mixtures of the species have the given
+    //! enthalpies.
+    /*!
+     * For each mixture `j`, the temperature \f$ T_j \f$ satisfying
+     * \f[
+     *     \sum_k w_{jk} \frac{\hat h^0_k(T_j)}{R} - c_j T_j = H_j
+     * \f]
+     * is found using Newton's method, where the derivative is computed from
+     * the same polynomials. The polynomials of all species with the same
+     * midpoint temperature are first combined into a single polynomial for
+     * each mixture, and the iterations are then carried out for blocks of
+     * mixtures in loops which the compiler can vectorize. The combined
+     * coefficients are computed once and reused until the parameterizations
+     * are changed. The initial guesses and the iterates are limited to the
+     * range between minTemp() and maxTemp(). Only possible if allNasaPoly()
+     * is true.
+     *
+     * @param n     Number of mixtures
+     * @param w     Weights of the species, where `w[j * nsp + k]` is the
+     *              weight of species `k` in mixture `j`
+     * @param c     Coefficients of the linear term. Length `n`.
+     * @param H     Target values. Length `n`.
+     * @param T     Initial guesses on input and solutions on output (K).
+     *              Length `n`.
+     * @param rtol  Relative tolerance for the temperature or the target value
+     * @returns the indices of the mixtures where the iteration did not
+     *     converge, for which the initial guess is left in `T`
+     */
+    std::vector<size_t> solveNasaTemperatures(size_t n, const double* w,
+                                              const double* c,
+                                              const double* H, double* T,
+                                              double rtol) const;
+
     //! Minimum temperature.
     /*!
      * If no argument is supplied, this method returns the minimum temperature
@@ -188,19 +245,40 @@ public:
     //! Check if data for all species (0 through nSpecies-1) has been installed.
     bool ready(size_t nSpecies);
 
-private:
     //! Provide the SpeciesThermoInterpType object
     /*!
+     * Parameters of the returned object should only be changed using
+     * modifySpecies() or modifyOneHf298(), since the coefficients of some
+     * parameterizations are also stored in packed form.
+     *
      * @param k  species index
-     * @return pointer to the SpeciesThermoInterpType object.
+     * @return pointer to the SpeciesThermoInterpType object, or `nullptr` if
+     *     no parameterization is installed for species `k`.
      */
     SpeciesThermoInterpType* provideSTIT(size_t k);
     const SpeciesThermoInterpType* provideSTIT(size_t k) const;
 
+    //! Estimate of the memory used by this object, in bytes. Each species
+    //! thermo object is counted as an object holding its coefficients.
+    size_t memoryUsage() const;
+
 protected:
     //! Mark species *k* as having its thermodynamic data installed
     void markInstalled(size_t k);
 
+    //! Copy the coefficients of the NasaPoly2 object `m_sp[NASA2][n]` to the
+    //! packed coefficient arrays
+    void packNasaPoly(size_t n);
+
+    //! Group the species by midpoint temperature and compute the coefficients
+    //! of the enthalpy polynomials used by solveNasaTemperatures()
+    void updateNasaGroups() const;
+
+    //! Compute the reference-state properties of all species using NasaPoly2
+    //! parameterizations from the packed coefficient arrays
+    void updateNasaPoly(double T, double* cp_R, double* h_RT,
+                        double* s_R) const;
+
     typedef std::pair<size_t, shared_ptr<SpeciesThermoInterpType> > index_STIT;
     typedef std::map<int, std::vector<index_STIT> > STIT_map;
     typedef std::map<int, vector_fp> tpoly_map;
@@ -230,6 +308,43 @@ protected:
 
     //! indicates if data for species has been installed
     std::vector<bool> m_installed;
+
+    //! @name Packed NASA polynomial coefficients
+    //! Coefficients of the species using NasaPoly2 parameterizations, with a
+    //! separate array for each coefficient so that the properties of all of
+    //! these species are computed in a single loop which the compiler can
+    //! vectorize. Entry `n` of each array is for `m_sp[NASA2][n]`.
+    //! @{
+
+    //! Temperatures separating the low and high temperature regions
+    vector_fp m_nasa_tmid;
+
+    //! Coefficients `a0` to `a6` of the low temperature polynomials
+    std::vector<vector_fp> m_nasa_low;
+
+    //! Coefficients `a0` to `a6` of the high temperature polynomials
+    std::vector<vector_fp> m_nasa_high;
+
+    //! Index of the species `m_sp[NASA2][0]` if the species indices of all
+    //! entries are consecutive, in which case the properties are written
+    //! directly to the output arrays, or `npos` otherwise.
+    size_t m_nasa_start;
+
+    //! Distinct midpoint temperatures in increasing order
+    mutable vector_fp m_nasa_group_tmid;
+
+    //! Index in #m_nasa_group_tmid of the midpoint temperature of each entry
+    mutable std::vector<size_t> m_nasa_group;
+
+    //! Coefficients of `T^0` to `T^5` in `T*h_RT` for the low and high
+    //! temperature regions, at `12*n` to `12*n+5` and `12*n+6` to `12*n+11`
+    //! for entry `n`
+    mutable vector_fp m_nasa_hcoeffs;
+
+    //! True if #m_nasa_group_tmid, #m_nasa_group and #m_nasa_hcoeffs are up to
+    //! date. Reset by packNasaPoly().
+    mutable bool m_nasa_groups_ok;
+    //! @}
 };
 
 }
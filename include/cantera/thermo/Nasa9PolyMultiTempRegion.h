@@ -119,14 +119,14 @@ public:
                                   doublereal* const coeffs) const;
 
 protected:
+    //! Index of the temperature region containing temperature `T`
+    size_t region(double T) const;
+
     //! Lower boundaries of each temperature regions
     vector_fp m_lowerTempBounds;
 
     //! Individual temperature region objects
     std::vector<std::unique_ptr<Nasa9Poly1>> m_regionPts;
-
-    //! current region
-    mutable int m_currRegion;
 };
 
 }
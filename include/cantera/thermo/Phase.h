@@ -365,6 +365,8 @@ public:
     void restoreState(const vector_fp& state);
 
     //! Restore the state of the phase from a previously saved state vector.
+    //! If the saved state is identical to the current state, the phase is
+    //! not modified, and stateMFNumber() is not incremented.
     //!     @param lenstate   Length of the state vector
     //!     @param state      Vector of state conditions.
     virtual void restoreState(size_t lenstate, const doublereal* state);
@@ -846,6 +848,30 @@ public:
 
     //!@} end group adding species and elements
 
+    //! Release the Species objects and other data which are only needed to
+    //! set up the phase.
+    /*!
+     * The properties of the phase can still be computed after calling this
+     * function, but species(), findIsomers(), addSpecies() and
+     * modifySpecies() raise an exception. This reduces the memory used by
+     * phases which are created once and then only used for computing
+     * properties.
+     */
+    virtual void compact();
+
+    //! Returns `true` if compact() has been called
+    bool isCompact() const {
+        return m_compact;
+    }
+
+    //! Add estimates of the memory used by the input data of this phase, in
+    //! bytes, to `usage`.
+    /*!
+     * The memory used by the Species objects is added to the entry
+     * `species`. Derived classes add entries for other input data.
+     */
+    virtual void getMemoryUsage(std::map<std::string, size_t>& usage) const;
+
     //!  Returns a bool indicating whether the object is ready for use
     /*!
      *  @returns true if the object is ready for calculation, false otherwise.
@@ -960,12 +986,23 @@ protected:
     //! Flag determining whether case sensitive species names are enforced
     bool m_caseSensitiveSpecies;
 
+    //! Flag indicating that the Species objects have been released by
+    //! compact()
+    bool m_compact;
+
 private:
     //! Find lowercase species name in m_speciesIndices when case sensitive
     //! species names are not enforced and a user specifies a non-canonical
     //! species name. Raise exception if lowercase name is not unique.
     size_t findSpeciesLower(const std::string& nameStr) const;
 
+    //! Determine the offsets into the state vector from nativeState()
+    void initStateOffsets() const;
+
+    //! Check whether the state vector `state` is identical to the current
+    //! state. Requires the offsets set by initStateOffsets().
+    bool stateMatches(const double* state) const;
+
     XML_Node* m_xml; //!< XML node containing the XML info for this phase
 
     //! ID of the phase. This is the value of the ID attribute of the XML
@@ -1007,6 +1044,17 @@ private:
     //! this int is incremented.
     int m_stateNum;
 
+    //! @name Offsets into the state vector
+    //! Offsets of the native state properties used by saveState() and
+    //! restoreState(), determined from nativeState() on first use. Set to
+    //! `npos` until then.
+    //! @{
+    mutable size_t m_stateOffsetT; //!< Temperature
+    mutable size_t m_stateOffsetDP; //!< Density or pressure
+    mutable size_t m_stateOffsetComp; //!< Composition; `npos` if pure
+    mutable bool m_stateMoleFractions; //!< Composition is mole fractions
+    //! @}
+
     //! Vector of the species names
     std::vector<std::string> m_speciesNames;
 
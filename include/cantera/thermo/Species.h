@@ -35,6 +35,11 @@ public:
     Species& operator=(const Species& other) = delete;
     ~Species();
 
+    //! Estimate of the memory used by this Species object and its input data,
+    //! in bytes. The thermo and transport parameterizations, which are shared
+    //! with the objects using this species, are not included.
+    size_t memoryUsage() const;
+
     //! The name of the species
     std::string name;
 
@@ -149,6 +149,21 @@ unique_ptr<ThermoPhase> newPhase(AnyMap& phaseNode,
  */
 ThermoPhase* newPhase(const std::string& infile, std::string id="");
 
+//! Create a new ThermoPhase object with the same definition as an existing one
+/*!
+ * The new phase uses the same Species objects as `other`, including their
+ * reference state parameterizations, so no input data is parsed again. The
+ * state of `other` is copied to the new phase. Each phase keeps its own
+ * coefficient arrays derived from the parameterizations, so the Species
+ * objects should not be modified, e.g. using ThermoPhase::modifyOneHf298SS(),
+ * while both phases are in use.
+ *
+ * @param other  A phase created from YAML input which has not been compacted.
+ *     Phases defined in terms of other phases (LatticeSolidPhase and
+ *     IonsFromNeutralVPSSTP) are not supported, and raise an exception.
+ */
+unique_ptr<ThermoPhase> newPhase(const ThermoPhase& other);
+
 //! Import a phase information into an empty ThermoPhase object
 /*!
  * Here we read an XML description of the thermodynamic information for a phase.
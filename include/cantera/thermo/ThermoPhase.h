@@ -732,6 +732,31 @@ public:
         throw NotImplementedError("ThermoPhase::getStandardVolumes_ref");
     }
 
+    //! Get the nondimensional heat capacities, enthalpies, entropies and
+    //! Gibbs functions of the species reference states at several
+    //! temperatures.
+    /*!
+     * The values for species `k` at temperature `T[i]` are stored at index
+     * `i * m_kk + k` of the output arrays. The state of the phase is not
+     * changed. The default implementation sets the temperature of the phase
+     * to each of the values in turn, while derived classes may compute the
+     * properties for all temperatures directly.
+     *
+     * @param nT    Number of temperatures
+     * @param T     Temperatures [K]. Length: nT.
+     * @param cp_R  Output array of nondimensional reference state heat
+     *              capacities. Length: nT * m_kk.
+     * @param h_RT  Output array of nondimensional reference state
+     *              enthalpies. Length: nT * m_kk.
+     * @param s_R   Output array of nondimensional reference state
+     *              entropies. Length: nT * m_kk.
+     * @param g_RT  Output array of nondimensional reference state Gibbs
+     *              functions. Length: nT * m_kk.
+     */
+    virtual void getReferenceProperties(size_t nT, const double* T,
+                                        double* cp_R, double* h_RT,
+                                        double* s_R, double* g_RT);
+
     // The methods below are not virtual, and should not be overloaded.
 
     //@}
@@ -918,6 +943,77 @@ public:
      */
     virtual void setState_UV(double u, double v, double tol=1e-9);
 
+    //! Set the temperature so that the specific enthalpy or internal energy
+    //! has the given value.
+    /*!
+     * The pressure (for enthalpy) or the density (for internal energy) and the
+     * composition are held constant. This is the solver used by the default
+     * implementations of setState_HP() and setState_UV(). Newton's method is
+     * used with cp or cv, which are evaluated at the same temperature as the
+     * enthalpy or internal energy, and the steps are limited to remain within
+     * the bracket of the solution found so far. The iteration starts from the
+     * current temperature, so only a few iterations are needed if it is close
+     * to the solution, e.g. when the state changes by a small amount between
+     * successive calls.
+     *
+     * @param h     Specific enthalpy or internal energy (J/kg)
+     * @param tol   Relative tolerance for the temperature or the energy
+     * @param doUV  True to solve for the internal energy at constant
+     *              density, false to solve for the enthalpy at constant
+     *              pressure
+     * @returns the number of iterations
+     */
+    int setTemperature_HorU(double h, double tol=1e-9, bool doUV=false);
+
+    //! Find the temperatures of many states given their specific enthalpies,
+    //! pressures and compositions.
+    /*!
+     * This is the calculation done by setState_HP() for each state, without
+     * changing the state of the phase. The mass fractions of species `k` in
+     * state `j` are given by `Y[j * m_kk + k]`. Derived classes may solve
+     * for all of the states together, e.g. IdealGasPhase when all species
+     * use NASA polynomials.
+     *
+     * @param n    Number of states
+     * @param h    Specific enthalpies (J/kg). Length `n`.
+     * @param P    Pressures (Pa). Length `n`.
+     * @param Y    Mass fractions. Length `n * m_kk`.
+     * @param T    Initial guesses for the temperatures on input, and the
+     *             temperatures (K) on output. Length `n`.
+     * @param tol  Relative tolerance for the temperature or the enthalpy
+     * @returns the indices of the states where the iteration did not
+     *     converge, for which the initial guess is returned in `T`. These
+     *     states can be solved individually using setState_HP().
+     */
+    std::vector<size_t> getTemperatures_HP(size_t n, const double* h,
+                                           const double* P, const double* Y,
+                                           double* T, double tol=1e-9) {
+        return getTemperatures_HPorUV(n, h, P, Y, T, tol, false);
+    }
+
+    //! Find the temperatures of many states given their specific internal
+    //! energies, specific volumes and compositions.
+    /*!
+     * This is the calculation done by setState_UV() for each state. See
+     * getTemperatures_HP() for details.
+     *
+     * @param n    Number of states
+     * @param u    Specific internal energies (J/kg). Length `n`.
+     * @param v    Specific volumes (m^3/kg). Length `n`.
+     * @param Y    Mass fractions. Length `n * m_kk`.
+     * @param T    Initial guesses for the temperatures on input, and the
+     *             temperatures (K) on output. Length `n`.
+     * @param tol  Relative tolerance for the temperature or the internal
+     *             energy
+     * @returns the indices of the states where the iteration did not
+     *     converge
+     */
+    std::vector<size_t> getTemperatures_UV(size_t n, const double* u,
+                                           const double* v, const double* Y,
+                                           double* T, double tol=1e-9) {
+        return getTemperatures_HPorUV(n, u, v, Y, T, tol, true);
+    }
+
     //! Set the specific entropy (J/kg/K) and pressure (Pa).
     /*!
      * This function fixes the internal state of the phase so that the specific
@@ -1711,6 +1807,16 @@ public:
     const AnyMap& input() const;
     AnyMap& input();
 
+    //! Release the Species objects and the input data of the phase
+    //! description. See Phase::compact().
+    virtual void compact();
+
+    //! Add estimates of the memory used by this phase, in bytes, to `usage`.
+    //! The memory used by the phase description is added to the entry
+    //! `phase-input`, and the memory used by the species reference-state
+    //! parameterizations to the entry `species-thermo`.
+    virtual void getMemoryUsage(std::map<std::string, size_t>& usage) const;
+
     //! Set equation of state parameter values from XML entries.
     /*!
      * This method is called by function importPhase() when processing a phase
@@ -1861,6 +1967,25 @@ protected:
     virtual void getCsvReportData(std::vector<std::string>& names,
                                   std::vector<vector_fp>& data) const;
 
+    //! Carry out the work of getTemperatures_HP() and getTemperatures_UV().
+    /*!
+     * The default implementation calls setState_HP() or setState_UV() for
+     * each state, starting from the initial guess for its temperature.
+     *
+     * @param n     Number of states
+     * @param h     Specific enthalpies or internal energies (J/kg)
+     * @param p     Pressures (Pa) or specific volumes (m^3/kg)
+     * @param Y     Mass fractions. Length `n * m_kk`.
+     * @param T     Initial guesses on input and temperatures on output (K)
+     * @param tol   Relative tolerance of the calculation
+     * @param doUV  True if solving for UV, false for HP.
+     * @returns the indices of the states where the iteration did not
+     *     converge
+     */
+    virtual std::vector<size_t> getTemperatures_HPorUV(
+        size_t n, const double* h, const double* p, const double* Y,
+        double* T, double tol, bool doUV);
+
     //! Pointer to the calculation manager for species reference-state
     //! thermodynamic properties
     /*!
@@ -234,6 +234,9 @@ public:
     virtual void getEntropy_R_ref(doublereal* er) const;
     virtual void getCp_R_ref(doublereal* cprt) const;
     virtual void getStandardVolumes_ref(doublereal* vol) const;
+    virtual void getReferenceProperties(size_t nT, const double* T,
+                                        double* cp_R, double* h_RT,
+                                        double* s_R, double* g_RT);
     //@}
 
     //! @name Initialization Methods - For Internal use
@@ -117,6 +117,16 @@ public:
 
     virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
 
+    //! Use the fits of the collision integrals and of the species properties
+    //! computed by `other` instead of computing them when init() is next
+    //! called.
+    /*!
+     * `other` must be a transport manager of the same type, initialized for a
+     * phase with the same species and temperature limits. The fits are copied
+     * by this method, so `other` is not used afterwards.
+     */
+    void useFitsFrom(const GasTransport& other);
+
 protected:
     GasTransport(ThermoPhase* thermo=0);
 
@@ -501,6 +511,24 @@ protected:
 
     //! Level of verbose printing during initialization
     int m_log_level;
+
+    //! Fits copied from another transport manager by useFitsFrom()
+    struct CopiedFits {
+        size_t nsp;
+        int mode;
+        std::vector<vector_int> poly;
+        std::vector<vector_fp> omega22_poly;
+        std::vector<vector_fp> astar_poly;
+        std::vector<vector_fp> bstar_poly;
+        std::vector<vector_fp> cstar_poly;
+        std::vector<vector_fp> visccoeffs;
+        std::vector<vector_fp> condcoeffs;
+        std::vector<vector_fp> diffcoeffs;
+    };
+
+    //! Fits used by the next call to init() instead of computing them
+    //! @see useFitsFrom()
+    unique_ptr<CopiedFits> m_copiedFits;
 };
 
 } // namespace Cantera
@@ -75,6 +75,18 @@ public:
      */
     virtual Transport* newTransport(thermo_t* thermo, int log_level=0);
 
+    //! Build a new transport manager of the same type as an existing one
+    /*!
+     * For gas transport models, the fits computed by `other` are copied
+     * instead of fitting the transport properties again. No data is shared
+     * with `other` afterwards.
+     *
+     * @param other   Transport manager to be copied
+     * @param thermo  ThermoPhase object with the same species and temperature
+     *     limits as the phase of `other`
+     */
+    virtual Transport* newTransport(const Transport& other, thermo_t* thermo);
+
 private:
     //! Static instance of the factor -> This is the only instance of this
     //! object allowed
@@ -109,6 +121,9 @@ Transport* newTransportMgr(const std::string& transportModel = "",
  */
 Transport* newDefaultTransportMgr(thermo_t* thermo, int loglevel = 0);
 
+//! @copydoc TransportFactory::newTransport(const Transport&, thermo_t*)
+Transport* newTransportMgr(const Transport& other, thermo_t* thermo);
+
 } // End of namespace Cantera
 
 #endif
@@ -80,6 +80,39 @@ public:
         return m_chem;
     }
 
+    //! Enable dynamic adaptive chemistry for the homogeneous reactions, so
+    //! that only the reactions which are important at the current state of
+    //! the reactor are evaluated. The kinetics manager must be a GasKinetics
+    //! object. Since the active reactions are selected by the kinetics
+    //! manager, this also affects other reactors sharing the same kinetics
+    //! manager, which should be avoided.
+    //! @see GasKinetics::setAdaptiveChemistry
+    void setAdaptiveChemistry(const std::vector<std::string>& targets,
+                              double threshold=1e-3, double rtol=0.05,
+                              double atol=1e-9);
+
+    //! Disable dynamic adaptive chemistry
+    void disableAdaptiveChemistry();
+
+    //! Number of homogeneous phase species whose mass fractions are
+    //! components of the state vector.
+    /*!
+     * If the kinetics manager is a GasKinetics object with quasi-steady-state
+     * species (see GasKinetics::setQuasiSteadySpecies), these species are not
+     * part of the state vector, and their mass fractions are held at the
+     * values they have when the reactor is initialized. The QSS species must
+     * therefore be specified before the reactor network is initialized.
+     */
+    size_t nStateSpecies() const {
+        return m_stateSpecies.empty() ? m_nsp : m_stateSpecies.size();
+    }
+
+    //! Index in the homogeneous phase of the species with index *n* among
+    //! the species in the state vector
+    size_t stateSpecies(size_t n) const {
+        return m_stateSpecies.empty() ? n : m_stateSpecies[n];
+    }
+
     virtual void setEnergy(int eflag = 1) {
         if (eflag > 0) {
             m_energy = true;
@@ -205,6 +238,19 @@ protected:
     //! Get initial conditions for SurfPhase objects attached to this reactor
     virtual void getSurfaceInitialConditions(double* y);
 
+    //! Get the mass fractions of the species in the state vector, in the
+    //! order given by stateSpecies()
+    void getStateMassFractions(double* y);
+
+    //! Set the mass fractions of the phase (without normalization) from the
+    //! values *y* for the species in the state vector. The mass fractions of
+    //! quasi-steady-state species are held constant.
+    void setStateMassFractions(const double* y);
+
+    //! Copy the rates of change of the mass fractions of all species in
+    //! #m_dYdt to *ydot* for the species in the state vector
+    void getStateSpeciesRates(double* ydot) const;
+
     //! Pointer to the homogeneous Kinetics object that handles the reactions
     Kinetics* m_kin;
 
@@ -217,6 +263,15 @@ protected:
     vector_fp m_sdot;
 
     vector_fp m_wdot; //!< Species net molar production rates
+    vector_fp m_dYdt; //!< Rates of change of the species mass fractions
+
+    //! Indices of the homogeneous phase species in the state vector. Set by
+    //! initialize().
+    std::vector<size_t> m_stateSpecies;
+
+    //! Mass fractions of all species, including the fixed values for the
+    //! quasi-steady-state species
+    vector_fp m_Ywork;
     vector_fp m_uk; //!< Species molar internal energies
     bool m_chem;
     bool m_energy;
@@ -783,6 +783,9 @@ cdef extern from "cantera/oneD/StFlow.h":
         void setFreeFlow()
         void setAxisymmetricFlow()
         string flowType()
+        size_t nStateSpecies()
+        size_t stateSpecies(size_t)
+        size_t speciesComponent(size_t)
 
 
 cdef extern from "cantera/oneD/IonFlow.h":
@@ -411,9 +411,9 @@ class FlameBase(Sim1D):
         `self.gas`, to the temperature and composition at the point with index
         *point*.
         """
-        k0 = self.flame.component_index(self.gas.species_name(0))
-        Y = [self.solution(k, point)
-             for k in range(k0, k0 + self.gas.n_species)]
+        Y = np.zeros(self.gas.n_species)
+        for k in self.flame.state_species:
+            Y[k] = self.solution(self.flame.species_component(k), point)
         self.gas.set_unnormalized_mass_fractions(Y)
         self.gas.TP = self.value(self.flame, 'T', point), self.P
 
@@ -838,7 +838,7 @@ class FreeFlame(FlameBase):
         else:
             self.fixed_temperature = Tmid
 
-        for n in range(self.gas.n_species):
+        for n in self.flame.state_species:
             self.set_profile(self.gas.species_name(n),
                              locs, [Y0[n], Y0[n], Yeq[n], Yeq[n]])
 
@@ -1043,7 +1043,7 @@ class BurnerFlame(FlameBase):
         locs = [0.0, 0.2, 1.0]
         self.set_profile('velocity', locs, [u0, u1, u1])
         self.set_profile('T', locs, [T0, Teq, Teq])
-        for n in range(self.gas.n_species):
+        for n in self.flame.state_species:
             self.set_profile(self.gas.species_name(n),
                              locs, [Y0[n], Yeq[n], Yeq[n]])
 
@@ -1095,8 +1095,9 @@ class BurnerFlame(FlameBase):
             # The eventual solution for a blown off flame is the non-reacting
             # solution, so just set the state to this now
             self.set_flat_profile(self.flame, 'T', self.T[0])
-            for k,spec in enumerate(self.gas.species_names):
-                self.set_flat_profile(self.flame, spec, self.burner.Y[k])
+            for k in self.flame.state_species:
+                self.set_flat_profile(self.flame, self.gas.species_name(k),
+                                      self.burner.Y[k])
 
             self.set_steady_callback(original_callback)
             super().solve(loglevel, False, False)
@@ -1237,8 +1238,8 @@ class CounterflowDiffusionFlame(FlameBase):
         self.set_profile('velocity', [0.0, 1.0], [u0f, -u0o])
         self.set_profile('spread_rate', [0.0, x0/dz, 1.0], [0.0, a, 0.0])
         self.set_profile('T', zrel, T)
-        for k,spec in enumerate(self.gas.species_names):
-            self.set_profile(spec, zrel, Y[:,k])
+        for k in self.flame.state_species:
+            self.set_profile(self.gas.species_name(k), zrel, Y[:,k])
 
     def extinct(self):
         return max(self.T) - max(self.fuel_inlet.T, self.oxidizer_inlet.T) < 10
@@ -1413,8 +1414,10 @@ class CounterflowDiffusionFlame(FlameBase):
         >>> f.mixture_fraction('Bilger')
         """
 
-        Yf = [self.solution(k, 0) for k in self.gas.species_names]
-        Yo = [self.solution(k, self.flame.n_points-1) for k in self.gas.species_names]
+        self.set_gas_state(0)
+        Yf = self.gas.Y
+        self.set_gas_state(self.flame.n_points-1)
+        Yo = self.gas.Y
 
         vals = np.empty(self.flame.n_points)
         for i in range(self.flame.n_points):
@@ -1492,13 +1495,13 @@ class ImpingingJet(FlameBase):
             Yeq = self.gas.Y
             locs = np.array([0.0, 0.3, 0.7, 1.0])
             self.set_profile('T', locs, [T0, Teq, Teq, self.surface.T])
-            for k in range(self.gas.n_species):
+            for k in self.flame.state_species:
                 self.set_profile(self.gas.species_name(k), locs,
                                  [Y0[k], Yeq[k], Yeq[k], Yeq[k]])
         else:
             locs = np.array([0.0, 1.0])
             self.set_profile('T', locs, [T0, self.surface.T])
-            for k in range(self.gas.n_species):
+            for k in self.flame.state_species:
                 self.set_profile(self.gas.species_name(k), locs,
                                  [Y0[k], Y0[k]])
 
@@ -1586,7 +1589,7 @@ class CounterflowPremixedFlame(FlameBase):
 
         locs = np.array([0.0, 0.4, 0.6, 1.0])
         self.set_profile('T', locs, [Tu, Tu, Teq, Tb])
-        for k in range(self.gas.n_species):
+        for k in self.flame.state_species:
             self.set_profile(self.gas.species_name(k), locs,
                              [Yu[k], Yu[k], Yeq[k], Yb[k]])
 
@@ -1665,7 +1668,7 @@ class CounterflowTwinPremixedFlame(FlameBase):
 
         locs = np.array([0.0, 0.4, 0.6, 1.0])
         self.set_profile('T', locs, [Tu, Tu, Tb, Tb])
-        for k in range(self.gas.n_species):
+        for k in self.flame.state_species:
             self.set_profile(self.gas.species_name(k), locs,
                              [Yu[k], Yu[k], Yb[k], Yb[k]])
 
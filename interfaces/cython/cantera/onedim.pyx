@@ -64,6 +64,12 @@ cdef class Domain1D:
         """Index of the component with name 'name'"""
         return self.domain.componentIndex(stringify(name))
 
+    def _species_components(self):
+        """Indices of the components which are species mass fractions"""
+        species = set(self.gas.species_names)
+        return [n for n, name in enumerate(self.component_names)
+                if name in species]
+
     def set_bounds(self, *, default=None, Y=None, **kwargs):
         """
         Set the lower and upper bounds on the solution.
@@ -81,8 +87,7 @@ cdef class Domain1D:
                 self.domain.setBounds(n, default[0], default[1])
 
         if Y is not None:
-            k0 = self.component_index(self.gas.species_name(0))
-            for n in range(k0, k0 + self.gas.n_species):
+            for n in self._species_components():
                 self.domain.setBounds(n, Y[0], Y[1])
 
         for name,(lower,upper) in kwargs.items():
@@ -115,8 +120,7 @@ cdef class Domain1D:
                 self.domain.setSteadyTolerances(r, a, n)
 
         if Y is not None:
-            k0 = self.component_index(self.gas.species_name(0))
-            for n in range(k0, k0 + self.gas.n_species):
+            for n in self._species_components():
                 self.domain.setSteadyTolerances(Y[0], Y[1], n)
 
         for name, (rtol, atol) in kwargs.items():
@@ -150,8 +154,7 @@ cdef class Domain1D:
                 self.domain.setTransientTolerances(r, a, n)
 
         if Y is not None:
-            k0 = self.component_index(self.gas.species_name(0))
-            for n in range(k0, k0 + self.gas.n_species):
+            for n in self._species_components():
                 self.domain.setTransientTolerances(Y[0], Y[1], n)
 
         for name, (rtol, atol) in kwargs.items():
@@ -510,6 +513,26 @@ cdef class _FlowBase(Domain1D):
     def __dealloc__(self):
         del self.flow
 
+    property state_species:
+        """
+        Indices of the species whose mass fractions are part of the solution.
+        Quasi-steady-state species of the kinetics manager are not included.
+        """
+        def __get__(self):
+            return [self.flow.stateSpecies(n)
+                    for n in range(self.flow.nStateSpecies())]
+
+    def species_component(self, k):
+        """
+        Index of the solution component for the mass fraction of species *k*,
+        which can be specified by name or index, or `None` for
+        quasi-steady-state species, which are not part of the solution.
+        """
+        if isinstance(k, (str, bytes)):
+            k = self.gas.species_index(k)
+        cdef size_t n = self.flow.speciesComponent(k)
+        return None if n == CxxNpos else n
+
     property settings:
         def __get__(self):
             out = super().settings
@@ -694,7 +717,8 @@ cdef class IonFlow(_FlowBase):
     def set_default_tolerances(self):
         super().set_default_tolerances()
         chargetol = {}
-        for S in self.gas.species():
+        for k in self.state_species:
+            S = self.gas.species(k)
             if S.composition == {'E': 1.0}:
                 chargetol[S.name] = (1e-5, 1e-20)
             elif S.charge != 0:
@@ -1036,8 +1060,8 @@ cdef class Sim1D:
                     self.set_profile(key, xi, val)
 
             # restore species profiles
-            for i, spc in enumerate(self.gas.species_names):
-                self.set_profile(spc, xi, Y[:, i])
+            for k in dom.state_species:
+                self.set_profile(self.gas.species_name(k), xi, Y[:, k])
 
             # restore pressure
             self.P = P
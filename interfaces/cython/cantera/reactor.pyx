@@ -288,6 +288,9 @@ cdef class Reactor(ReactorBase):
 
         `ConstPressureReactor` and `IdealGasConstPressureReactor`:
         `n_species` + 2 (mass, enthalpy or temperature).
+
+        Quasi-steady-state species of the kinetics manager are not counted in
+        `n_species`.
         """
         def __get__(self):
             return self.reactor.neq()
@@ -1280,6 +1283,9 @@ cdef class ReactorNet:
         `ConstPressureReactor` and `IdealGasConstPressureReactor`:
         `n_species` + 2 (mass, enthalpy or temperature).
 
+        Quasi-steady-state species of the kinetics manager are not counted in
+        `n_species`.
+
         `Wall`: number of surface species
         """
         def __get__(self):
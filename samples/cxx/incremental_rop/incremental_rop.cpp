@@ -0,0 +1,88 @@
+// Benchmark for incremental updates of the rates of progress in GasKinetics.
+//
+// The net production rates are evaluated for a sequence of states in which
+// the concentration of one species at a time is perturbed, as when a
+// Jacobian matrix is computed by finite differences. The time per perturbed
+// species is compared for full and incremental evaluation, including the
+// time taken to set the thermodynamic state.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Solution.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+#include <chrono>
+
+using namespace Cantera;
+
+//! Return the time per perturbed species in microseconds, as the minimum over
+//! several repetitions of `nIter` sweeps over all species. The net production
+//! rates for each perturbation are returned in `wdot`.
+double timeColumns(const std::string& infile, bool incremental, size_t nIter,
+                   vector_fp& wdot)
+{
+    auto sol = newSolution(infile, "", "None");
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    ThermoPhase& thermo = *sol->thermo();
+    kin.setIncrementalROP(incremental);
+    size_t kk = thermo.nSpecies();
+
+    vector_fp X(kk, 1e-4);
+    X[thermo.speciesIndex("O2")] = 0.18;
+    X[thermo.speciesIndex("N2")] = 0.6;
+    thermo.setState_TPX(1400.0, OneAtm, X.data());
+    vector_fp conc0(kk), conc(kk);
+    thermo.getConcentrations(conc0.data());
+    wdot.assign(kk * kk, 0.0);
+
+    double tmin = 1e300;
+    for (int rep = 0; rep < 7; rep++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t n = 0; n < nIter; n++) {
+            thermo.setConcentrations(conc0.data());
+            kin.getNetProductionRates(wdot.data());
+            for (size_t k = 0; k < kk; k++) {
+                conc = conc0;
+                conc[k] *= 1.0 + 1e-6;
+                thermo.setConcentrations(conc.data());
+                kin.getNetProductionRates(&wdot[k * kk]);
+            }
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        tmin = std::min(tmin, std::chrono::duration<double, std::micro>(
+            t1 - t0).count() / (nIter * kk));
+    }
+    return tmin;
+}
+
+void compare(const std::string& infile, size_t nIter)
+{
+    vector_fp wFull, wIncr;
+    double tFull = timeColumns(infile, false, nIter, wFull);
+    double tIncr = timeColumns(infile, true, nIter, wIncr);
+    double diff = 0.0, scale = 0.0;
+    for (size_t i = 0; i < wFull.size(); i++) {
+        diff = std::max(diff, std::abs(wIncr[i] - wFull[i]));
+        scale = std::max(scale, std::abs(wFull[i]));
+    }
+    writelog("{}: time per perturbed species\n", infile);
+    writelog("  full evaluation        {:8.3f} us\n", tFull);
+    writelog("  incremental evaluation {:8.3f} us (difference {:.1e})\n",
+             tIncr, diff / scale);
+}
+
+int main()
+{
+    try {
+        compare("gri30.yaml", 200);
+        compare("nDodecane_Reitz.yaml", 20);
+        appdelete();
+        return 0;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return 1;
+    }
+}
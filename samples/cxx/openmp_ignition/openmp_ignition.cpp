@@ -24,9 +24,11 @@ void run()
     std::vector<std::unique_ptr<ReactorNet>> nets;
 
     // Create and link the Cantera objects for each thread. This step should be
-    // done in serial
+    // done in serial. The input file is only read once, and the Solution
+    // objects for the other threads share the species and reaction data.
+    auto gas = newSolution("gri30.yaml", "gri30", "None");
     for (int i = 0; i < nThreads; i++) {
-        auto sol = newSolution("gri30.yaml", "gri30", "None");
+        auto sol = (i == 0) ? gas : gas->clone();
         sols.emplace_back(sol);
         reactors.emplace_back(new IdealGasConstPressureReactor());
         nets.emplace_back(new ReactorNet());
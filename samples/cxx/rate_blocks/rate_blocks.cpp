@@ -0,0 +1,109 @@
+// Benchmark for the internal reaction order of GasKinetics.
+//
+// GasKinetics evaluates the rates of progress with the reactions grouped into
+// contiguous blocks by rate type and reversibility, independent of the order
+// in which the reactions were added. The net production rates are evaluated
+// for the reactions of a mechanism in the order of the input file, and for
+// the same reactions added in a random order, in which reactions of all types
+// are interleaved. Times are given for states at alternating temperatures,
+// where all rate constants are re-evaluated, and for states differing only in
+// composition. The times for both orders should be the same.
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Solution.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+using namespace Cantera;
+
+//! Return the time per evaluation of the net production rates in
+//! microseconds, as the minimum over several repetitions of `nIter`
+//! evaluations. If `changeT` is true, the temperature alternates between
+//! evaluations; otherwise, the concentration of the first species does.
+double timeIt(ThermoPhase& thermo, Kinetics& kin, bool changeT, size_t nIter,
+              vector_fp& wdot)
+{
+    size_t kk = thermo.nSpecies();
+    vector_fp X(kk, 1.0 / kk);
+    thermo.setState_TPX(1400.0, OneAtm, X.data());
+    vector_fp conc0(kk), conc1(kk);
+    thermo.getConcentrations(conc0.data());
+    conc1 = conc0;
+    conc1[0] *= 1.001;
+    double rho = thermo.density();
+    wdot.resize(kk);
+
+    double tmin = 1e300;
+    for (int rep = 0; rep < 7; rep++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t n = 0; n < nIter; n++) {
+            if (changeT) {
+                thermo.setState_TR((n % 2) ? 1401.0 : 1400.0, rho);
+            } else {
+                thermo.setConcentrations((n % 2) ? conc1.data() : conc0.data());
+            }
+            kin.getNetProductionRates(wdot.data());
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        tmin = std::min(tmin, std::chrono::duration<double, std::micro>(
+            t1 - t0).count() / nIter);
+    }
+    return tmin;
+}
+
+void compare(const std::string& infile, size_t nIter)
+{
+    auto sol = newSolution(infile, "", "None");
+    ThermoPhase& thermo = *sol->thermo();
+    Kinetics& kin = *sol->kinetics();
+    size_t nr = kin.nReactions();
+
+    // the same reactions, added in a random order
+    std::vector<size_t> order(nr);
+    for (size_t i = 0; i < nr; i++) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(1234));
+    GasKinetics shuffled(&thermo);
+    shuffled.init();
+    for (size_t i : order) {
+        shuffled.addReaction(kin.reaction(i));
+    }
+
+    writelog("{}: {} species, {} reactions\n", infile, thermo.nSpecies(), nr);
+    for (bool changeT : {true, false}) {
+        vector_fp w1, w2;
+        double t1 = timeIt(thermo, kin, changeT, nIter, w1);
+        double t2 = timeIt(thermo, shuffled, changeT, nIter, w2);
+        double diff = 0.0, scale = 0.0;
+        for (size_t k = 0; k < w1.size(); k++) {
+            diff = std::max(diff, std::abs(w2[k] - w1[k]));
+            scale = std::max(scale, std::abs(w1[k]));
+        }
+        writelog("  {:<20s} input order {:8.3f} us, random order {:8.3f} us "
+                 "(difference {:.1e})\n",
+                 changeT ? "changing T:" : "changing X:", t1, t2,
+                 diff / scale);
+    }
+}
+
+int main()
+{
+    try {
+        compare("gri30.yaml", 20000);
+        compare("nDodecane_Reitz.yaml", 10000);
+        appdelete();
+        return 0;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return 1;
+    }
+}
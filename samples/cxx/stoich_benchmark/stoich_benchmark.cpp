@@ -0,0 +1,308 @@
+// Microbenchmark for the stoichiometric kernels used to compute rates of
+// progress and species production rates from rate constants and
+// concentrations, using the reactions of real mechanisms (GRI-Mech 3.0 and
+// the n-dodecane mechanism of Wang et al.) and of a synthetic mechanism with
+// 2500 species and 10000 reactions, whose stoichiometric matrices do not fit
+// in the L2 cache.
+//
+// For a single state, the scatter of the rates of progress over the rows of
+// each reaction is compared with a gather over the compressed sparse column
+// (transposed) representation, and the separate evaluation of the rates of
+// progress and the production rates (as in Kinetics::getNetProductionRates)
+// is compared with a fused pass over the reactions. For a tile of states,
+// three variants of the evaluation of the concentration products and net
+// production rates are compared:
+//   - separate passes for the concentration products and for the production
+//     rates, with a row-wise scatter
+//   - the same, with a column-wise gather for the production rates
+//   - a fused pass over the reactions, computing the net rate of progress of
+//     each reaction and adding it to the production rates immediately
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/Solution.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/StoichManager.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+#include <chrono>
+#include <random>
+
+using namespace Cantera;
+
+//! Stoichiometry of a mechanism, as in class Kinetics
+struct Stoich
+{
+    StoichManagerN reactants, revProducts, irrevProducts;
+    std::vector<char> reversible;
+};
+
+//! Return the time per call of `f` in microseconds, as the minimum over
+//! several repetitions of `nIter` calls
+template <class F>
+double timeIt(F f, size_t nIter)
+{
+    double tmin = 1e300;
+    for (int rep = 0; rep < 7; rep++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t n = 0; n < nIter; n++) {
+            f();
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        tmin = std::min(tmin,
+            std::chrono::duration<double, std::micro>(t1 - t0).count() / nIter);
+    }
+    return tmin;
+}
+
+double maxDifference(const vector_fp& a, const vector_fp& b)
+{
+    double diff = 0.0, scale = 0.0;
+    for (size_t i = 0; i < a.size(); i++) {
+        diff = std::max(diff, std::abs(a[i] - b[i]));
+        scale = std::max(scale, std::abs(b[i]));
+    }
+    return diff / scale;
+}
+
+//! Add reaction `i` with the given reactants and products to `st`
+void addReaction(Stoich& st, size_t i, const std::vector<size_t>& rk,
+                 const vector_fp& rs, const vector_fp& ro,
+                 const std::vector<size_t>& pk, const vector_fp& ps,
+                 bool reversible)
+{
+    st.reactants.add(i, rk, ro, rs);
+    st.reversible.push_back(reversible);
+    if (reversible) {
+        st.revProducts.add(i, pk, ps, ps);
+    } else {
+        st.irrevProducts.add(i, pk, ps, ps);
+    }
+}
+
+void finalize(Stoich& st, size_t kk)
+{
+    st.reactants.finalize(kk);
+    st.revProducts.finalize(kk);
+    st.irrevProducts.finalize(kk);
+}
+
+//! Stoichiometry of the reactions of the mechanism in `infile`
+Stoich fromMechanism(const std::string& infile, size_t& kk, size_t& nr)
+{
+    auto sol = newSolution(infile, "", "None");
+    auto kin = sol->kinetics();
+    nr = kin->nReactions();
+    kk = kin->nTotalSpecies();
+    Stoich st;
+    for (size_t i = 0; i < nr; i++) {
+        std::vector<size_t> rk, pk;
+        vector_fp rs, ps;
+        for (size_t k = 0; k < kk; k++) {
+            if (kin->reactantStoichCoeff(k, i)) {
+                rk.push_back(k);
+                rs.push_back(kin->reactantStoichCoeff(k, i));
+            }
+            if (kin->productStoichCoeff(k, i)) {
+                pk.push_back(k);
+                ps.push_back(kin->productStoichCoeff(k, i));
+            }
+        }
+        addReaction(st, i, rk, rs, rs, pk, ps, kin->isReversible(i));
+    }
+    finalize(st, kk);
+    return st;
+}
+
+//! Stoichiometry of a synthetic mechanism with `kk` species and `nr`
+//! reactions. Each reaction has one to three reactants and products, drawn
+//! from all species without any locality, so that the species arrays are
+//! accessed in a cache-unfriendly pattern. About 80% of the reactions are
+//! reversible, and 2% have non-integral reaction orders.
+Stoich synthetic(size_t kk, size_t nr)
+{
+    std::mt19937 gen(4321);
+    std::uniform_int_distribution<size_t> species(0, kk - 1);
+    std::uniform_int_distribution<size_t> width(1, 3);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    Stoich st;
+    for (size_t i = 0; i < nr; i++) {
+        std::vector<size_t> rk, pk;
+        for (size_t m = width(gen); m > 0; m--) {
+            rk.push_back(species(gen));
+        }
+        for (size_t m = width(gen); m > 0; m--) {
+            pk.push_back(species(gen));
+        }
+        vector_fp rs(rk.size(), 1.0), ro(rk.size(), 1.0), ps(pk.size(), 1.0);
+        if (unit(gen) < 0.02) {
+            ro[0] = 0.5 + unit(gen);
+        }
+        addReaction(st, i, rk, rs, ro, pk, ps, unit(gen) < 0.8);
+    }
+    finalize(st, kk);
+    return st;
+}
+
+void compare(const std::string& label, Stoich& st, size_t kk, size_t nr,
+             size_t nIter)
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> dist(0.5, 2.0);
+
+    // Single state
+    vector_fp conc(kk), kf(nr), kr(nr), rop(nr), w1(kk), w2(kk);
+    for (size_t k = 0; k < kk; k++) {
+        conc[k] = 1e-3 * dist(gen);
+    }
+    for (size_t i = 0; i < nr; i++) {
+        kf[i] = dist(gen);
+        kr[i] = st.reversible[i] ? dist(gen) : 0.0;
+    }
+    for (size_t i = 0; i < nr; i++) {
+        rop[i] = kf[i] - kr[i];
+    }
+    double tRows = timeIt([&]() {
+        std::fill(w1.begin(), w1.end(), 0.0);
+        st.revProducts.incrementSpecies(rop.data(), w1.data());
+        st.irrevProducts.incrementSpecies(rop.data(), w1.data());
+        st.reactants.decrementSpecies(rop.data(), w1.data());
+    }, nIter);
+    double tColumns = timeIt([&]() {
+        std::fill(w2.begin(), w2.end(), 0.0);
+        st.revProducts.incrementSpecies(rop.data(), w2.data(), 1);
+        st.irrevProducts.incrementSpecies(rop.data(), w2.data(), 1);
+        st.reactants.decrementSpecies(rop.data(), w2.data(), 1);
+    }, nIter);
+    writelog("{}: {} species, {} reactions\n", label, kk, nr);
+    writelog("  1 state, production rates:   rows {:8.3f} us, "
+             "columns {:8.3f} us (difference {:.1e})\n",
+             tRows, tColumns, maxDifference(w2, w1));
+
+    // Single state, rates of progress and production rates, with the rates
+    // of progress stored as in Kinetics::updateROP
+    vector_fp ropf(nr), ropr(nr), ropnet(nr), w3(kk), w4(kk);
+    double tSeparate = timeIt([&]() {
+        ropf = kf;
+        ropr = kr;
+        st.reactants.multiply(conc.data(), ropf.data());
+        st.revProducts.multiply(conc.data(), ropr.data());
+        for (size_t i = 0; i < nr; i++) {
+            ropnet[i] = ropf[i] - ropr[i];
+        }
+        std::fill(w3.begin(), w3.end(), 0.0);
+        st.revProducts.incrementSpecies(ropnet.data(), w3.data());
+        st.irrevProducts.incrementSpecies(ropnet.data(), w3.data());
+        st.reactants.decrementSpecies(ropnet.data(), w3.data());
+    }, nIter);
+    double tFused = timeIt([&]() {
+        std::fill(w4.begin(), w4.end(), 0.0);
+        for (size_t i = 0; i < nr; i++) {
+            ropf[i] = kf[i];
+            ropr[i] = kr[i];
+            st.reactants.multiply(i, conc.data(), &ropf[i], 1);
+            if (st.reversible[i]) {
+                st.revProducts.multiply(i, conc.data(), &ropr[i], 1);
+                ropnet[i] = ropf[i] - ropr[i];
+                st.revProducts.incrementSpecies(i, &ropnet[i], w4.data(), 1);
+            } else {
+                ropnet[i] = ropf[i] - ropr[i];
+                st.irrevProducts.incrementSpecies(i, &ropnet[i], w4.data(), 1);
+            }
+            st.reactants.decrementSpecies(i, &ropnet[i], w4.data(), 1);
+        }
+    }, nIter);
+    writelog("  1 state, rates of progress and production rates:\n");
+    writelog("    separate          {:8.3f} us\n", tSeparate);
+    writelog("    fused             {:8.3f} us (difference {:.1e})\n",
+             tFused, maxDifference(w4, w3));
+
+    // Tile of states
+    const size_t ns = 32;
+    vector_fp cs(kk * ns), kfs(nr * ns), krs(nr * ns), f(nr * ns), r(nr * ns);
+    vector_fp wRows(kk * ns), wColumns(kk * ns), wFused(kk * ns);
+    vector_fp rop1(ns), rop2(ns);
+    for (auto& c : cs) {
+        c = 1e-3 * dist(gen);
+    }
+    for (size_t i = 0; i < nr; i++) {
+        for (size_t j = 0; j < ns; j++) {
+            kfs[i*ns + j] = dist(gen);
+            krs[i*ns + j] = st.reversible[i] ? dist(gen) : 0.0;
+        }
+    }
+    auto products = [&]() {
+        f = kfs;
+        r = krs;
+        st.reactants.multiply(cs.data(), f.data(), ns);
+        st.revProducts.multiply(cs.data(), r.data(), ns);
+        for (size_t i = 0; i < nr * ns; i++) {
+            f[i] -= r[i];
+        }
+    };
+    size_t nIterTile = nIter / ns;
+    double tTileRows = timeIt([&]() {
+        products();
+        std::fill(wRows.begin(), wRows.end(), 0.0);
+        for (size_t i = 0; i < nr; i++) {
+            st.revProducts.incrementSpecies(i, &f[i*ns], wRows.data(), ns);
+            st.irrevProducts.incrementSpecies(i, &f[i*ns], wRows.data(), ns);
+            st.reactants.decrementSpecies(i, &f[i*ns], wRows.data(), ns);
+        }
+    }, nIterTile);
+    double tTileColumns = timeIt([&]() {
+        products();
+        std::fill(wColumns.begin(), wColumns.end(), 0.0);
+        st.revProducts.incrementSpecies(f.data(), wColumns.data(), ns);
+        st.irrevProducts.incrementSpecies(f.data(), wColumns.data(), ns);
+        st.reactants.decrementSpecies(f.data(), wColumns.data(), ns);
+    }, nIterTile);
+    double tTileFused = timeIt([&]() {
+        std::fill(wFused.begin(), wFused.end(), 0.0);
+        for (size_t i = 0; i < nr; i++) {
+            std::copy(&kfs[i*ns], &kfs[i*ns] + ns, rop1.begin());
+            st.reactants.multiply(i, cs.data(), rop1.data(), ns);
+            if (st.reversible[i]) {
+                std::copy(&krs[i*ns], &krs[i*ns] + ns, rop2.begin());
+                st.revProducts.multiply(i, cs.data(), rop2.data(), ns);
+                for (size_t j = 0; j < ns; j++) {
+                    rop1[j] -= rop2[j];
+                }
+                st.revProducts.incrementSpecies(i, rop1.data(), wFused.data(),
+                                                ns);
+            } else {
+                st.irrevProducts.incrementSpecies(i, rop1.data(),
+                                                  wFused.data(), ns);
+            }
+            st.reactants.decrementSpecies(i, rop1.data(), wFused.data(), ns);
+        }
+    }, nIterTile);
+    writelog("  {} states, rates of progress and production rates:\n", ns);
+    writelog("    separate, rows    {:8.3f} us per state\n", tTileRows / ns);
+    writelog("    separate, columns {:8.3f} us per state "
+             "(difference {:.1e})\n", tTileColumns / ns,
+             maxDifference(wColumns, wRows));
+    writelog("    fused             {:8.3f} us per state "
+             "(difference {:.1e})\n", tTileFused / ns,
+             maxDifference(wFused, wRows));
+}
+
+int main()
+{
+    try {
+        size_t kk, nr;
+        for (std::string infile : {"gri30.yaml", "nDodecane_Reitz.yaml"}) {
+            Stoich st = fromMechanism(infile, kk, nr);
+            compare(infile, st, kk, nr, infile == "gri30.yaml" ? 50000 : 25000);
+        }
+        Stoich st = synthetic(2500, 10000);
+        compare("synthetic", st, 2500, 10000, 2000);
+        appdelete();
+        return 0;
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        appdelete();
+        return 1;
+    }
+}
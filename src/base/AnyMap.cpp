@@ -1212,6 +1212,75 @@ AnyMap AnyMap::fromYamlFile(const std::string& name,
     return cache_item.first;
 }
 
+namespace {
+size_t stringMemoryUsage(const std::string& s)
+{
+    return sizeof(std::string) + s.capacity();
+}
+
+size_t valueMemoryUsage(const AnyValue& value)
+{
+    // Size of the type-erased holder and the contained object
+    size_t usage = sizeof(AnyValue) + 2 * sizeof(void*);
+    if (value.is<std::string>()) {
+        usage += stringMemoryUsage(value.asString());
+    } else if (value.is<AnyMap>()) {
+        usage += value.as<AnyMap>().memoryUsage();
+    } else if (value.is<std::vector<AnyValue>>()) {
+        for (const auto& item : value.asVector<AnyValue>()) {
+            usage += valueMemoryUsage(item);
+        }
+    } else if (value.is<std::vector<AnyMap>>()) {
+        for (const auto& item : value.asVector<AnyMap>()) {
+            usage += item.memoryUsage();
+        }
+    } else if (value.is<vector_fp>()) {
+        usage += value.asVector<double>().capacity() * sizeof(double);
+    } else if (value.is<std::vector<long int>>()) {
+        usage += value.asVector<long int>().capacity() * sizeof(long int);
+    } else if (value.is<std::vector<std::string>>()) {
+        for (const auto& item : value.asVector<std::string>()) {
+            usage += stringMemoryUsage(item);
+        }
+    } else if (value.is<std::vector<vector_fp>>()) {
+        for (const auto& item : value.asVector<vector_fp>()) {
+            usage += sizeof(vector_fp) + item.capacity() * sizeof(double);
+        }
+    } else {
+        usage += sizeof(double);
+    }
+    return usage;
+}
+}
+
+size_t AnyMap::memoryUsage() const
+{
+    // Each entry is a separately-allocated node of the hash table, plus one
+    // pointer in the bucket array
+    size_t usage = sizeof(AnyMap) + m_data.bucket_count() * sizeof(void*);
+    for (const auto& item : m_data) {
+        usage += 2 * sizeof(void*) + item.first.capacity()
+                 + valueMemoryUsage(item.second);
+    }
+    return usage;
+}
+
+void AnyMap::clearCache()
+{
+    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+    s_cache.clear();
+}
+
+size_t AnyMap::cacheMemoryUsage()
+{
+    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+    size_t usage = 0;
+    for (const auto& item : s_cache) {
+        usage += stringMemoryUsage(item.first) + item.second.first.memoryUsage();
+    }
+    return usage;
+}
+
 AnyMap::Iterator begin(const AnyValue& v) {
     return v.as<AnyMap>().begin();
 }
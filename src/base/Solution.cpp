@@ -13,6 +13,7 @@
 #include "cantera/kinetics/KineticsFactory.h"
 #include "cantera/transport/TransportBase.h"
 #include "cantera/transport/TransportFactory.h"
+#include "cantera/base/AnyMap.h"
 
 namespace Cantera
 {
@@ -58,6 +59,52 @@ void Solution::setTransport(shared_ptr<Transport> transport) {
     }
 }
 
+shared_ptr<Solution> Solution::clone() const {
+    if (!m_thermo) {
+        throw CanteraError("Solution::clone",
+                           "Requires associated 'ThermoPhase'");
+    }
+    if (m_kinetics && m_kinetics->nPhases() > 1) {
+        throw CanteraError("Solution::clone",
+            "Solutions with adjacent phases cannot be cloned.");
+    }
+    auto sol = create();
+    sol->setThermo(shared_ptr<ThermoPhase>(newPhase(*m_thermo)));
+    if (m_kinetics) {
+        std::vector<ThermoPhase*> phases{sol->thermo().get()};
+        sol->setKinetics(newKinetics(phases, *m_kinetics));
+    }
+    if (m_transport) {
+        sol->setTransport(shared_ptr<Transport>(
+            newTransportMgr(*m_transport, sol->thermo().get())));
+    }
+    return sol;
+}
+
+void Solution::compact(bool clearInputCache) {
+    if (m_thermo) {
+        m_thermo->compact();
+    }
+    if (m_kinetics) {
+        m_kinetics->compact();
+    }
+    if (clearInputCache) {
+        AnyMap::clearCache();
+    }
+}
+
+std::map<std::string, size_t> Solution::memoryUsage() const {
+    std::map<std::string, size_t> usage;
+    if (m_thermo) {
+        m_thermo->getMemoryUsage(usage);
+    }
+    if (m_kinetics) {
+        m_kinetics->getMemoryUsage(usage);
+    }
+    usage["input-cache"] = AnyMap::cacheMemoryUsage();
+    return usage;
+}
+
 shared_ptr<Solution> newSolution(const std::string& infile,
                                  const std::string& name,
                                  const std::string& transport,
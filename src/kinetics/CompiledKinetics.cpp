@@ -0,0 +1,484 @@
+//! @file CompiledKinetics.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/CompiledKinetics.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/base/stringUtils.h"
+
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+
+//! Version of the interface between the generated code and CompiledKinetics
+const int compiledKineticsVersion = 1;
+
+//! Format a floating point number so that it is read back exactly
+string literal(double x)
+{
+    return fmt::format("{:.17g}", x);
+}
+
+//! Expression for the enhanced third-body concentration
+string thirdBodyExpr(Kinetics& kin, const ThirdBody& tbody)
+{
+    string expr;
+    if (tbody.default_efficiency == 1.0) {
+        expr = "ctot";
+    } else if (tbody.default_efficiency != 0.0) {
+        expr = literal(tbody.default_efficiency) + " * ctot";
+    }
+    for (const auto& eff : tbody.efficiencies) {
+        size_t k = kin.kineticsSpeciesIndex(eff.first);
+        double e = eff.second - tbody.default_efficiency;
+        if (k == npos || e == 0.0) {
+            continue; // undeclared third bodies are skipped, as in GasKinetics
+        }
+        if (expr.empty()) {
+            expr = fmt::format("{} * c[{}]", literal(e), k);
+        } else {
+            expr += fmt::format(" {} {} * c[{}]", (e < 0) ? "-" : "+",
+                                literal(std::abs(e)), k);
+        }
+    }
+    return expr.empty() ? "0.0" : expr;
+}
+
+//! Expression for the product of the concentrations raised to their reaction
+//! orders, with the same clipping of negative concentrations as in class
+//! StoichManagerN. Returns an empty string if there are no species.
+string concProductExpr(const vector<size_t>& k, const vector_fp& order,
+                       const vector_fp& stoich)
+{
+    bool frac = false;
+    for (size_t n = 0; n < k.size(); n++) {
+        if (fmod(stoich[n], 1.0) || stoich[n] != order[n]) {
+            frac = true;
+        }
+    }
+    vector<string> terms;
+    if (!frac && k.size() <= 3) {
+        for (size_t n = 0; n < k.size(); n++) {
+            for (size_t i = 0; i < stoich[n]; i++) {
+                terms.push_back(fmt::format("c[{}]", k[n]));
+            }
+        }
+        if (terms.size() >= 1 && terms.size() <= 3) {
+            if (terms.size() == 1) {
+                return terms[0];
+            }
+            return fmt::format("prod{}({})", terms.size(),
+                               fmt::join(terms, ", "));
+        }
+        terms.clear();
+    }
+    for (size_t n = 0; n < k.size(); n++) {
+        if (order[n] != 0.0) {
+            terms.push_back(fmt::format("cpow(c[{}], {})", k[n],
+                                        literal(order[n])));
+        }
+    }
+    return fmt::format("{}", fmt::join(terms, " * "));
+}
+
+} // end unnamed namespace
+
+void generateCompiledKinetics(Kinetics& kin, std::ostream& out)
+{
+    size_t nsp = kin.nTotalSpecies();
+    size_t nr = kin.nReactions();
+
+    // Temperature-dependent quantities stored in the work array. Arrhenius
+    // expressions come first, followed by the Troe and SRI parameters.
+    vector_fp A, b, E;
+    vector<size_t> arrhenius(nr, npos); // high-pressure / only rate
+    vector<size_t> arrheniusLow(nr, npos);
+    auto addArrhenius = [&](const Arrhenius& rate) {
+        A.push_back(rate.preExponentialFactor());
+        b.push_back(rate.temperatureExponent());
+        E.push_back(rate.activationEnergy_R());
+        return A.size() - 1;
+    };
+    vector<size_t> troe, sri;
+    for (size_t i = 0; i < nr; i++) {
+        auto r = kin.reaction(i);
+        switch (r->reaction_type) {
+        case ELEMENTARY_RXN:
+        case THREE_BODY_RXN:
+            arrhenius[i] = addArrhenius(
+                dynamic_cast<ElementaryReaction&>(*r).rate);
+            break;
+        case FALLOFF_RXN:
+        case CHEMACT_RXN: {
+            auto& rf = dynamic_cast<FalloffReaction&>(*r);
+            arrhenius[i] = addArrhenius(rf.high_rate);
+            arrheniusLow[i] = addArrhenius(rf.low_rate);
+            string type = rf.falloff->type();
+            if (type == "Troe") {
+                troe.push_back(i);
+            } else if (type == "SRI") {
+                sri.push_back(i);
+            } else if (type != "Lindemann") {
+                throw CanteraError("generateCompiledKinetics", "Unsupported "
+                    "falloff function type '{}' for reaction {}: {}", type,
+                    i, r->equation());
+            }
+            break;
+        }
+        case PLOG_RXN:
+        case CHEBYSHEV_RXN:
+            break;
+        default:
+            throw CanteraError("generateCompiledKinetics", "Unsupported "
+                "reaction type {} for reaction {}: {}", r->reaction_type, i,
+                r->equation());
+        }
+    }
+    size_t troeStart = A.size();
+    size_t sriStart = troeStart + troe.size();
+    size_t workSize = sriStart + 2 * sri.size();
+
+    string names;
+    for (size_t k = 0; k < nsp; k++) {
+        string name = kin.kineticsSpeciesName(k);
+        if (name.find_first_of(" \"\\") != npos) {
+            throw CanteraError("generateCompiledKinetics",
+                "Unsupported character in species name '{}'", name);
+        }
+        names += (k ? " " : "") + name;
+    }
+
+    out << "// Kinetics kernels for a mechanism with " << nsp
+        << " species and " << nr << " reactions.\n"
+           "// Generated by Cantera " CANTERA_VERSION ". Do not edit.\n\n"
+           "#include <algorithm>\n"
+           "#include <cmath>\n"
+           "#include <cstddef>\n\n"
+           "#ifdef _WIN32\n"
+           "#define CT_EXPORT extern \"C\" __declspec(dllexport)\n"
+           "#else\n"
+           "#define CT_EXPORT extern \"C\" __attribute__((visibility(\"default\")))\n"
+           "#endif\n\n"
+           "namespace {\n\n";
+
+    out << "constexpr size_t nArrhenius = " << A.size() << ";\n";
+    auto writeArray = [&](const string& name, const vector_fp& x) {
+        out << "constexpr double " << name << "[] = {";
+        for (size_t i = 0; i < x.size(); i++) {
+            out << (i % 4 ? " " : "\n    ") << literal(x[i]) << ",";
+        }
+        out << (x.empty() ? "0.0" : "\n") << "};\n"; // avoid empty arrays
+    };
+    writeArray("arrhenius_A", A);
+    writeArray("arrhenius_b", b);
+    writeArray("arrhenius_E", E);
+
+    out << "\n"
+        "inline double prod2(double a, double b) {\n"
+        "    return (a < 0 && b < 0) ? 0.0 : a * b;\n"
+        "}\n\n"
+        "inline double prod3(double a, double b, double c) {\n"
+        "    return ((a < 0 && (b < 0 || c < 0)) || (b < 0 && c < 0)) ?\n"
+        "           0.0 : a * b * c;\n"
+        "}\n\n"
+        "inline double cpow(double c, double order) {\n"
+        "    return (c > 0.0) ? std::pow(c, order) : 0.0;\n"
+        "}\n\n"
+        "inline double troe(double pr, double logFcent) {\n"
+        "    double lpr = std::log10(std::max(pr, 1e-300));\n"
+        "    double cc = -0.4 - 0.67 * logFcent;\n"
+        "    double nn = 0.75 - 1.27 * logFcent;\n"
+        "    double f1 = (lpr + cc) / (nn - 0.14 * (lpr + cc));\n"
+        "    return std::pow(10.0, logFcent / (1.0 + f1 * f1));\n"
+        "}\n\n"
+        "inline double sri(double pr, const double* work) {\n"
+        "    double lpr = std::log10(std::max(pr, 1e-300));\n"
+        "    return std::pow(work[0], 1.0 / (1.0 + lpr * lpr)) * work[1];\n"
+        "}\n\n"
+        "} // end unnamed namespace\n\n";
+
+    out << "CT_EXPORT int ct_kinetics_version() { return "
+        << compiledKineticsVersion << "; }\n"
+        "CT_EXPORT size_t ct_kinetics_nSpecies() { return " << nsp << "; }\n"
+        "CT_EXPORT size_t ct_kinetics_nReactions() { return " << nr << "; }\n"
+        "CT_EXPORT size_t ct_kinetics_workSize() { return " << workSize
+        << "; }\n"
+        "CT_EXPORT const char* ct_kinetics_speciesNames()\n{\n"
+        "    return \"" << names << "\";\n}\n\n";
+
+    // Temperature-dependent part
+    out << "CT_EXPORT void ct_kinetics_updateTemp(double T, double logT, "
+           "double* work)\n{\n"
+           "    double recipT = 1.0 / T;\n"
+           "    for (size_t i = 0; i < nArrhenius; i++) {\n"
+           "        work[i] = arrhenius_A[i] * std::exp(arrhenius_b[i] * logT"
+           " - arrhenius_E[i] * recipT);\n"
+           "    }\n";
+    for (size_t n = 0; n < troe.size(); n++) {
+        auto& rf = dynamic_cast<FalloffReaction&>(*kin.reaction(troe[n]));
+        double params[4];
+        rf.falloff->getParameters(params);
+        double a = params[0];
+        double T3 = params[1];
+        double T1 = params[2];
+        double T2 = params[3];
+        string Fcent;
+        if (std::abs(T3) >= SmallNumber) {
+            Fcent = fmt::format("{} * std::exp(-T / {})", literal(1.0 - a),
+                                literal(T3));
+        }
+        if (std::abs(T1) >= SmallNumber) {
+            Fcent += fmt::format("{}{} * std::exp(-T / {})",
+                                 Fcent.empty() ? "" : " + ", literal(a),
+                                 literal(T1));
+        }
+        if (T2) {
+            Fcent += fmt::format("{}std::exp(-{} * recipT)",
+                                 Fcent.empty() ? "" : " + ", literal(T2));
+        }
+        out << fmt::format("    // Troe: {}\n", rf.equation());
+        out << fmt::format("    work[{}] = std::log10(std::max({}, 1e-300));\n",
+                           troeStart + n, Fcent.empty() ? "0.0" : Fcent);
+    }
+    for (size_t n = 0; n < sri.size(); n++) {
+        auto& rf = dynamic_cast<FalloffReaction&>(*kin.reaction(sri[n]));
+        double params[5];
+        rf.falloff->getParameters(params);
+        string X = fmt::format("{} * std::exp(-{} * recipT)",
+                               literal(params[0]), literal(params[1]));
+        if (params[2] != 0.0) {
+            X += fmt::format(" + std::exp(-T / {})", literal(params[2]));
+        }
+        out << fmt::format("    // SRI: {}\n", rf.equation());
+        out << fmt::format("    work[{}] = {};\n", sriStart + 2*n, X);
+        out << fmt::format("    work[{}] = {} * std::exp({} * logT);\n",
+                           sriStart + 2*n + 1, literal(params[3]),
+                           literal(params[4]));
+    }
+    out << "}\n\n";
+
+    // Rates of progress
+    out << "CT_EXPORT void ct_kinetics_updateROP(const double* work, "
+           "const double* c,\n"
+           "    double ctot, const double* kf, const double* rkcn, "
+           "const double* perturb,\n"
+           "    double* ropf, double* ropr, double* ropnet)\n{\n"
+           "    double k, pr;\n";
+    vector<map<size_t, double>> netStoich(nsp);
+    size_t nTroe = 0, nSri = 0;
+    for (size_t i = 0; i < nr; i++) {
+        auto r = kin.reaction(i);
+        out << fmt::format("\n    // {}: {}\n", i, r->equation());
+        switch (r->reaction_type) {
+        case ELEMENTARY_RXN:
+            out << fmt::format("    k = work[{}];\n", arrhenius[i]);
+            break;
+        case THREE_BODY_RXN:
+            out << fmt::format("    k = work[{}] * ({});\n", arrhenius[i],
+                thirdBodyExpr(kin,
+                    dynamic_cast<ThreeBodyReaction&>(*r).third_body));
+            break;
+        case FALLOFF_RXN:
+        case CHEMACT_RXN: {
+            auto& rf = dynamic_cast<FalloffReaction&>(*r);
+            out << fmt::format("    pr = ({}) * work[{}] / (work[{}] + 1e-300);\n",
+                thirdBodyExpr(kin, rf.third_body), arrheniusLow[i],
+                arrhenius[i]);
+            string F;
+            string type = rf.falloff->type();
+            if (type == "Troe") {
+                F = fmt::format(" * troe(pr, work[{}])", troeStart + nTroe++);
+            } else if (type == "SRI") {
+                F = fmt::format(" * sri(pr, work + {})", sriStart + 2 * nSri++);
+            }
+            if (r->reaction_type == FALLOFF_RXN) {
+                out << fmt::format("    k = work[{}] * pr / (1.0 + pr){};\n",
+                                   arrhenius[i], F);
+            } else {
+                out << fmt::format("    k = work[{}] / (1.0 + pr){};\n",
+                                   arrheniusLow[i], F);
+            }
+            break;
+        }
+        default:
+            out << fmt::format("    k = kf[{}];\n", i);
+        }
+        out << fmt::format("    k *= perturb[{}];\n", i);
+
+        // reactant and product concentration products, following
+        // Kinetics::addReaction
+        vector<size_t> rk, pk;
+        vector_fp rstoich, pstoich;
+        for (const auto& sp : r->reactants) {
+            rk.push_back(kin.kineticsSpeciesIndex(sp.first));
+            rstoich.push_back(sp.second);
+            netStoich[rk.back()][i] -= sp.second;
+        }
+        for (const auto& sp : r->products) {
+            pk.push_back(kin.kineticsSpeciesIndex(sp.first));
+            pstoich.push_back(sp.second);
+            netStoich[pk.back()][i] += sp.second;
+        }
+        vector_fp rorder = rstoich;
+        for (const auto& sp : r->orders) {
+            size_t k = kin.kineticsSpeciesIndex(sp.first);
+            auto rloc = std::find(rk.begin(), rk.end(), k);
+            if (rloc != rk.end()) {
+                rorder[rloc - rk.begin()] = sp.second;
+            } else {
+                rk.push_back(k);
+                rstoich.push_back(0.0);
+                rorder.push_back(sp.second);
+            }
+        }
+        string rprod = concProductExpr(rk, rorder, rstoich);
+        out << fmt::format("    ropf[{}] = k{};\n", i,
+                           rprod.empty() ? "" : " * " + rprod);
+        if (r->reversible) {
+            string pprod = concProductExpr(pk, pstoich, pstoich);
+            out << fmt::format("    ropr[{}] = k * rkcn[{}]{};\n", i, i,
+                               pprod.empty() ? "" : " * " + pprod);
+        } else {
+            out << fmt::format("    ropr[{}] = 0.0;\n", i);
+        }
+        out << fmt::format("    ropnet[{0}] = ropf[{0}] - ropr[{0}];\n", i);
+    }
+    out << "}\n\n";
+
+    // Net production rates, computed species by species
+    out << "CT_EXPORT void ct_kinetics_getNetProductionRates("
+           "const double* ropnet, double* wdot)\n{\n";
+    for (size_t k = 0; k < nsp; k++) {
+        string expr;
+        size_t nTerms = 0;
+        for (const auto& s : netStoich[k]) {
+            double nu = s.second;
+            if (nu == 0.0) {
+                continue;
+            }
+            string sign = (nu < 0) ? " - " : " + ";
+            if (expr.empty()) {
+                sign = (nu < 0) ? "-" : "";
+            } else if (++nTerms % 4 == 0) {
+                sign = (nu < 0) ? "\n        - " : "\n        + ";
+            }
+            if (std::abs(nu) == 1.0) {
+                expr += fmt::format("{}ropnet[{}]", sign, s.first);
+            } else {
+                expr += fmt::format("{}{} * ropnet[{}]", sign,
+                                    literal(std::abs(nu)), s.first);
+            }
+        }
+        out << fmt::format("    // {}\n    wdot[{}] = {};\n",
+                           kin.kineticsSpeciesName(k), k,
+                           expr.empty() ? "0.0" : expr);
+    }
+    out << "}\n";
+}
+
+void generateCompiledKinetics(Kinetics& kin, const std::string& filename)
+{
+    std::ofstream out(filename);
+    if (!out) {
+        throw CanteraError("generateCompiledKinetics",
+                           "Could not open file '{}' for writing", filename);
+    }
+    generateCompiledKinetics(kin, out);
+}
+
+CompiledKinetics::CompiledKinetics(const std::string& path)
+    : m_path(path)
+{
+#ifdef _WIN32
+    m_handle = LoadLibraryA(path.c_str());
+    if (!m_handle) {
+        throw CanteraError("CompiledKinetics::CompiledKinetics",
+            "Could not load library '{}' (error code {})", path,
+            GetLastError());
+    }
+#else
+    m_handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!m_handle) {
+        throw CanteraError("CompiledKinetics::CompiledKinetics",
+            "Could not load library '{}':\n{}", path, dlerror());
+    }
+#endif
+    try {
+        auto version = reinterpret_cast<int(*)()>(
+            symbol("ct_kinetics_version"));
+        if (version() != compiledKineticsVersion) {
+            throw CanteraError("CompiledKinetics::CompiledKinetics",
+                "Library '{}' was generated for version {} of the interface, "
+                "but version {} is required.", path, version(),
+                compiledKineticsVersion);
+        }
+        m_nSpecies = reinterpret_cast<size_t(*)()>(
+            symbol("ct_kinetics_nSpecies"))();
+        m_nReactions = reinterpret_cast<size_t(*)()>(
+            symbol("ct_kinetics_nReactions"))();
+        m_workSize = reinterpret_cast<size_t(*)()>(
+            symbol("ct_kinetics_workSize"))();
+        std::istringstream names(reinterpret_cast<const char*(*)()>(
+            symbol("ct_kinetics_speciesNames"))());
+        string name;
+        while (names >> name) {
+            m_speciesNames.push_back(name);
+        }
+        m_updateTemp = reinterpret_cast<decltype(m_updateTemp)>(
+            symbol("ct_kinetics_updateTemp"));
+        m_updateROP = reinterpret_cast<decltype(m_updateROP)>(
+            symbol("ct_kinetics_updateROP"));
+        m_getNetProductionRates =
+            reinterpret_cast<decltype(m_getNetProductionRates)>(
+                symbol("ct_kinetics_getNetProductionRates"));
+    } catch (CanteraError&) {
+#ifdef _WIN32
+        FreeLibrary(static_cast<HMODULE>(m_handle));
+#else
+        dlclose(m_handle);
+#endif
+        throw;
+    }
+}
+
+CompiledKinetics::~CompiledKinetics()
+{
+#ifdef _WIN32
+    FreeLibrary(static_cast<HMODULE>(m_handle));
+#else
+    dlclose(m_handle);
+#endif
+}
+
+void* CompiledKinetics::symbol(const std::string& name)
+{
+#ifdef _WIN32
+    void* f = reinterpret_cast<void*>(
+        GetProcAddress(static_cast<HMODULE>(m_handle), name.c_str()));
+#else
+    void* f = dlsym(m_handle, name.c_str());
+#endif
+    if (!f) {
+        throw CanteraError("CompiledKinetics::symbol",
+            "Function '{}' not found in library '{}'", name, m_path);
+    }
+    return f;
+}
+
+}
@@ -6,52 +6,126 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/kinetics/GasKinetics.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/thermo/speciesThermoTypes.h"
+#include "cantera/numerics/eigen_dense.h"
+
+#include <numeric>
+#include <queue>
 
 using namespace std;
 
 namespace Cantera
 {
+
+namespace {
+
+//! Restores the state of a phase when it goes out of scope
+class ThermoStateGuard
+{
+public:
+    explicit ThermoStateGuard(ThermoPhase& thermo) : m_thermo(thermo) {
+        m_thermo.saveState(m_state);
+    }
+    ~ThermoStateGuard() {
+        m_thermo.restoreState(m_state);
+    }
+
+private:
+    ThermoPhase& m_thermo;
+    vector_fp m_state;
+};
+
+//! Block of the internal reaction order for reactions of the given type
+int rateBlock(int reactionType)
+{
+    switch (reactionType) {
+    case THREE_BODY_RXN:
+        return 1;
+    case FALLOFF_RXN:
+        return 2;
+    case CHEMACT_RXN:
+        return 3;
+    case PLOG_RXN:
+        return 4;
+    case CHEBYSHEV_RXN:
+        return 5;
+    default:
+        return 0;
+    }
+}
+
+}
+
 GasKinetics::GasKinetics(thermo_t* thermo) :
     BulkKinetics(thermo),
+    m_rates_ok(true),
+    m_3bStart(0),
+    m_fallStart(0),
+    m_nfalloff(0),
     m_logp_ref(0.0),
     m_logc_ref(0.0),
     m_logStandConc(0.0),
-    m_pres(0.0)
+    m_pres(0.0),
+    m_incrementalROP(false),
+    m_ROP_ref_ok(false),
+    m_adaptive(false),
+    m_active_ok(false),
+    m_adaptiveThreshold(1e-3),
+    m_adaptiveRtol(0.05),
+    m_adaptiveAtol(1e-9),
+    m_nActiveSelections(0),
+    m_adaptiveT(0.0),
+    m_adaptiveP(0.0),
+    m_qss_ok(false),
+    m_compiled_temp(0.0),
+    m_compiled_pres(0.0),
+    m_compiled_rho(0.0),
+    m_compiled_stateNum(-1),
+    m_idealGas(nullptr)
 {
 }
 
 void GasKinetics::update_rates_T()
 {
+    if (!m_rates_ok) {
+        installRates();
+    }
     doublereal T = thermo().temperature();
     doublereal P = thermo().pressure();
     m_logStandConc = log(thermo().standardConcentration());
     doublereal logT = log(T);
 
     if (T != m_temp) {
-        if (!m_rfn.empty()) {
-            m_rates.update(T, logT, m_rfn.data());
-        }
+        if (!m_rateTable || !interpolateRateTable(T)) {
+            if (!m_rfn.empty()) {
+                m_rates.update(T, logT, m_rfn.data());
+            }
 
-        if (!m_rfn_low.empty()) {
-            m_falloff_low_rates.update(T, logT, m_rfn_low.data());
-            m_falloff_high_rates.update(T, logT, m_rfn_high.data());
-        }
-        if (!falloff_work.empty()) {
-            m_falloffn.updateTemp(T, falloff_work.data());
+            if (!m_rfn_low.empty()) {
+                m_falloff_low_rates.update(T, logT, m_rfn_low.data());
+                m_falloff_high_rates.update(T, logT, m_rfn_high.data());
+            }
+            if (!falloff_work.empty()) {
+                m_falloffn.updateTemp(T, falloff_work.data());
+            }
+            updateKc();
         }
-        updateKc();
         m_ROP_ok = false;
+        m_ROP_ref_ok = false;
     }
 
     if (T != m_temp || P != m_pres) {
         if (m_plog_rates.nReactions()) {
             m_plog_rates.update(T, logT, m_rfn.data());
             m_ROP_ok = false;
+            m_ROP_ref_ok = false;
         }
 
         if (m_cheb_rates.nReactions()) {
             m_cheb_rates.update(T, logT, m_rfn.data());
             m_ROP_ok = false;
+            m_ROP_ref_ok = false;
         }
     }
     m_pres = P;
@@ -60,17 +134,34 @@ void GasKinetics::update_rates_T()
 
 void GasKinetics::update_rates_C()
 {
+    updateConcentrations(nullptr);
+}
+
+void GasKinetics::updateConcentrations(const std::vector<char>* active)
+{
+    if (!m_rates_ok) {
+        installRates();
+    }
     thermo().getActivityConcentrations(m_conc.data());
     doublereal ctot = thermo().molarDensity();
 
     // 3-body reactions
     if (!concm_3b_values.empty()) {
-        m_3b_concm.update(m_conc, ctot, concm_3b_values.data());
+        if (active) {
+            m_3b_concm.update(m_conc, ctot, concm_3b_values.data(), *active);
+        } else {
+            m_3b_concm.update(m_conc, ctot, concm_3b_values.data());
+        }
     }
 
     // Falloff reactions
     if (!concm_falloff_values.empty()) {
-        m_falloff_concm.update(m_conc, ctot, concm_falloff_values.data());
+        if (active) {
+            m_falloff_concm.update(m_conc, ctot, concm_falloff_values.data(),
+                                   *active);
+        } else {
+            m_falloff_concm.update(m_conc, ctot, concm_falloff_values.data());
+        }
     }
 
     // P-log reactions
@@ -90,102 +181,221 @@ void GasKinetics::update_rates_C()
 
 void GasKinetics::updateKc()
 {
-    thermo().getStandardChemPotentials(m_grt.data());
-    fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
-
-    // compute Delta G^0 for all reversible reactions
-    getRevReactionDelta(m_grt.data(), m_rkcn.data());
+    calculateLogKc(m_logKc.data());
+    updateRkcn();
+}
 
-    doublereal rrt = 1.0 / thermo().RT();
-    for (size_t i = 0; i < m_revindex.size(); i++) {
-        size_t irxn = m_revindex[i];
-        m_rkcn[irxn] = std::min(exp(m_rkcn[irxn]*rrt - m_dn[irxn]*m_logStandConc),
-                                BigNumber);
+void GasKinetics::updateRkcn()
+{
+    // reciprocals of the equilibrium constants, which are zero for
+    // irreversible reactions
+    for (size_t i = 0; i < nReactions(); i++) {
+        m_rkcn[i] = std::min(exp(-m_logKc[i]), BigNumber);
     }
-
     for (size_t i = 0; i != m_irrev.size(); ++i) {
         m_rkcn[ m_irrev[i] ] = 0.0;
     }
+    for (size_t p = 0; p < m_rxnOrder.size(); p++) {
+        m_sortedRkcn[p] = m_rkcn[m_rxnOrder[p]];
+    }
 }
 
-void GasKinetics::getEquilibriumConstants(doublereal* kc)
+void GasKinetics::calculateLogKc(double* logKc)
 {
-    update_rates_T();
-    thermo().getStandardChemPotentials(m_grt.data());
-    fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
+    size_t nr = nReactions();
+    if (size_t(m_netStoich.rows()) != nr
+        || size_t(m_netStoich.cols()) != m_kk) {
+        SparseTriplets coeffs;
+        m_revProductStoich.getStoichCoeffs(coeffs);
+        m_irrevProductStoich.getStoichCoeffs(coeffs);
+        m_reactantStoich.getStoichCoeffs(coeffs, -1.0);
+        Eigen::SparseMatrix<double> nu(m_kk, nr);
+        nu.setFromTriplets(coeffs.begin(), coeffs.end());
+        m_netStoich = nu.transpose();
+        m_netStoich.makeCompressed();
+        m_idealGas = dynamic_cast<IdealGasPhase*>(&thermo());
+    }
 
-    // compute Delta G^0 for all reactions
-    getReactionDelta(m_grt.data(), m_rkcn.data());
+    MappedVector result(logKc, nr);
+    if (m_idealGas) {
+        // ln(Kc) = -sum(nu_k * g0_k / RT) + dn * ln(P_ref / RT)
+        const vector_fp& g0_RT = m_idealGas->gibbs_RT_ref();
+        double logC0 = log(m_idealGas->refPressure() / thermo().RT());
+        result = logC0 * ConstMappedVector(m_dn.data(), nr);
+        result.noalias() -= m_netStoich * ConstMappedVector(g0_RT.data(), m_kk);
+    } else {
+        // ln(Kc) = -sum(nu_k * mu0_k / RT) + dn * ln(C0)
+        thermo().getStandardChemPotentials(m_grt.data());
+        double rrt = 1.0 / thermo().RT();
+        double logC0 = log(thermo().standardConcentration());
+        result = logC0 * ConstMappedVector(m_dn.data(), nr);
+        result.noalias() -= rrt * (m_netStoich
+                                   * ConstMappedVector(m_grt.data(), m_kk));
+    }
+}
 
-    doublereal rrt = 1.0 / thermo().RT();
+void GasKinetics::getEquilibriumConstants(doublereal* kc)
+{
+    update_rates_T();
+    if (!m_idealGas) {
+        // the standard chemical potentials may depend on pressure, which
+        // does not trigger an update of the equilibrium constants
+        updateKc();
+    }
     for (size_t i = 0; i < nReactions(); i++) {
-        kc[i] = exp(-m_rkcn[i]*rrt + m_dn[i]*m_logStandConc);
+        kc[i] = exp(m_logKc[i]);
     }
+}
 
-    // force an update of T-dependent properties, so that m_rkcn will
-    // be updated before it is used next.
-    m_temp = 0.0;
+void GasKinetics::processFalloffReactions(double* ropf)
+{
+    updateFalloffRates();
+    for (size_t i = 0; i < m_falloff_low_rates.nReactions(); i++) {
+        ropf[m_fallindx[i]] = m_falloff_pr[i];
+    }
 }
 
-void GasKinetics::processFalloffReactions()
+void GasKinetics::updateFalloffRates()
 {
-    // use m_ropr for temporary storage of reduced pressure
-    vector_fp& pr = m_ropr;
+    vector_fp& pr = m_falloff_pr;
 
     for (size_t i = 0; i < m_falloff_low_rates.nReactions(); i++) {
         pr[i] = concm_falloff_values[i] * m_rfn_low[i] / (m_rfn_high[i] + SmallNumber);
-        AssertFinite(pr[i], "GasKinetics::processFalloffReactions",
+        AssertFinite(pr[i], "GasKinetics::updateFalloffRates",
                      "pr[{}] is not finite.", i);
     }
 
     m_falloffn.pr_to_falloff(pr.data(), falloff_work.data());
 
-    for (size_t i = 0; i < m_falloff_low_rates.nReactions(); i++) {
-        if (reactionType(m_fallindx[i]) == FALLOFF_RXN) {
-            pr[i] *= m_rfn_high[i];
-        } else { // CHEMACT_RXN
-            pr[i] *= m_rfn_low[i];
+    // falloff reactions, followed by chemically activated reactions
+    for (size_t i = 0; i < m_nfalloff; i++) {
+        pr[i] *= m_rfn_high[i];
+    }
+    for (size_t i = m_nfalloff; i < m_falloff_low_rates.nReactions(); i++) {
+        pr[i] *= m_rfn_low[i];
+    }
+}
+
+void GasKinetics::processFalloffReactions_active(double* ropf)
+{
+    size_t nfall = m_falloff_low_rates.nReactions();
+    vector_fp& pr = m_falloff_pr;
+    for (size_t i = 0; i < nfall; i++) {
+        if (m_isActiveFalloff[i]) {
+            pr[i] = concm_falloff_values[i] * m_rfn_low[i]
+                    / (m_rfn_high[i] + SmallNumber);
+            AssertFinite(pr[i], "GasKinetics::processFalloffReactions_active",
+                         "pr[{}] is not finite.", i);
         }
-        m_ropf[m_fallindx[i]] = pr[i];
+    }
+
+    m_falloffn.pr_to_falloff(pr.data(), falloff_work.data(),
+                             m_isActiveFalloff);
+
+    for (size_t i = 0; i < nfall; i++) {
+        if (m_isActiveFalloff[i]) {
+            double k = (i < m_nfalloff) ? m_rfn_high[i] : m_rfn_low[i];
+            ropf[m_fallindx[i]] = pr[i] * k;
+        }
+    }
+}
+
+void GasKinetics::processFalloffReactions_ddM(double* dkdM)
+{
+    size_t nfall = m_falloff_low_rates.nReactions();
+    vector_fp pr(nfall), g(nfall), dlogPr(nfall), dT(nfall);
+    for (size_t i = 0; i < nfall; i++) {
+        pr[i] = concm_falloff_values[i] * m_rfn_low[i] / (m_rfn_high[i] + SmallNumber);
+    }
+    g = pr;
+    m_falloffn.pr_to_falloff(g.data(), falloff_work.data());
+    m_falloffn.getDerivatives(thermo().temperature(), pr.data(),
+                              falloff_work.data(), dlogPr.data(), dT.data());
+
+    for (size_t i = 0; i < nfall; i++) {
+        double dgdPr = g[i] * dlogPr[i] / std::max(pr[i], SmallNumber);
+        double dPrdM = m_rfn_low[i] / (m_rfn_high[i] + SmallNumber);
+        size_t irxn = m_fallindx[i];
+        double k = (i < m_nfalloff) ? m_rfn_high[i] : m_rfn_low[i];
+        dkdM[irxn] = k * dgdPr * dPrdM * m_perturb[irxn];
     }
 }
 
 void GasKinetics::updateROP()
 {
+    if (m_compiled && !m_adaptive && m_qss.empty()) {
+        updateROP_compiled();
+        return;
+    }
+    if (m_adaptive) {
+        updateROP_adaptive();
+        return;
+    }
     update_rates_C();
     update_rates_T();
     if (m_ROP_ok) {
         return;
     }
+    if (m_incrementalROP && m_ROP_ref_ok && m_qss.empty()
+        && updateROP_incremental()) {
+        m_ROP_ok = true;
+        return;
+    }
 
-    // copy rate coefficients into ropf
-    m_ropf = m_rfn;
+    // The rates of progress are evaluated in the internal order of the
+    // reactions. Copy rate coefficients into ropf.
+    size_t nr = nReactions();
+    double* ropf = m_sortedRopf.data();
+    double* ropr = m_sortedRopr.data();
+    copy(m_rfn.begin(), m_rfn.end(), ropf);
 
     // multiply ropf by enhanced 3b conc for all 3b rxns
-    if (!concm_3b_values.empty()) {
-        m_3b_concm.multiply(m_ropf.data(), concm_3b_values.data());
+    for (size_t n = 0; n < concm_3b_values.size(); n++) {
+        ropf[m_3bStart + n] *= concm_3b_values[n];
     }
 
     if (m_falloff_high_rates.nReactions()) {
-        processFalloffReactions();
+        updateFalloffRates();
+        copy(m_falloff_pr.begin(), m_falloff_pr.end(), ropf + m_fallStart);
     }
 
-    for (size_t i = 0; i < nReactions(); i++) {
+    for (size_t p = 0; p < nr; p++) {
         // Scale the forward rate coefficient by the perturbation factor
-        m_ropf[i] *= m_perturb[i];
+        ropf[p] *= m_sortedPerturb[p];
         // For reverse rates computed from thermochemistry, multiply the forward
         // rate coefficients by the reciprocals of the equilibrium constants
-        m_ropr[i] = m_ropf[i] * m_rkcn[i];
+        ropr[p] = ropf[p] * m_sortedRkcn[p];
+    }
+    if (m_incrementalROP || !m_qss.empty()) {
+        // the incremental updates and the QSS solver use the rate constants
+        // in the public order
+        for (size_t p = 0; p < nr; p++) {
+            m_ropf[m_rxnOrder[p]] = ropf[p];
+            m_ropr[m_rxnOrder[p]] = ropr[p];
+        }
+    }
+    if (m_incrementalROP) {
+        m_kf_ref = m_ropf;
+    }
+    if (!m_qss.empty()) {
+        solveQuasiSteadyState();
     }
 
     // multiply ropf by concentration products
-    m_reactantStoich.multiply(m_conc.data(), m_ropf.data());
+    m_sortedReactantStoich.multiply(m_conc.data(), ropf);
 
     // for reversible reactions, multiply ropr by concentration products
-    m_revProductStoich.multiply(m_conc.data(), m_ropr.data());
+    m_sortedRevProductStoich.multiply(m_conc.data(), ropr);
 
-    for (size_t j = 0; j != nReactions(); ++j) {
-        m_ropnet[j] = m_ropf[j] - m_ropr[j];
+    // net rates of progress, and all rates of progress in the public order
+    for (size_t p = 0; p < nr; p++) {
+        m_sortedRopnet[p] = ropf[p] - ropr[p];
+    }
+    for (size_t p = 0; p < nr; p++) {
+        size_t i = m_rxnOrder[p];
+        m_ropf[i] = ropf[p];
+        m_ropr[i] = ropr[p];
+        m_ropnet[i] = m_sortedRopnet[p];
     }
 
     for (size_t i = 0; i < m_rfn.size(); i++) {
@@ -196,29 +406,1174 @@ void GasKinetics::updateROP()
         AssertFinite(m_ropr[i], "GasKinetics::updateROP",
                      "m_ropr[{}] is not finite.", i);
     }
+    if (m_incrementalROP) {
+        saveROPReference();
+    }
+    m_ROP_ok = true;
+}
+
+void GasKinetics::updateROP_compiled()
+{
+    if (!m_rates_ok) {
+        installRates();
+    }
+    double T = thermo().temperature();
+    double P = thermo().pressure();
+    double rho = thermo().density();
+    int stateNum = thermo().stateMFNumber();
+    if (m_ROP_ok && T == m_compiled_temp && P == m_compiled_pres
+        && rho == m_compiled_rho && stateNum == m_compiled_stateNum) {
+        return;
+    }
+    thermo().getActivityConcentrations(m_conc.data());
+    double ctot = thermo().molarDensity();
+    double logT = log(T);
+
+    // The equilibrium constants and the P-log and Chebyshev rate constants
+    // are kept separately from those of the generic path, which stay valid
+    // for the temperature and pressure at which they were evaluated.
+    if (T != m_compiled_temp) {
+        m_compiled->updateTemp(T, logT, m_compiled_work.data());
+        calculateLogKc(m_compiled_rkcn.data());
+        for (size_t i = 0; i < nReactions(); i++) {
+            m_compiled_rkcn[i] = std::min(exp(-m_compiled_rkcn[i]), BigNumber);
+        }
+        for (size_t i : m_irrev) {
+            m_compiled_rkcn[i] = 0.0;
+        }
+    }
+    if ((T != m_compiled_temp || P != m_compiled_pres)
+        && (m_plog_rates.nReactions() || m_cheb_rates.nReactions())) {
+        // The rate managers write the rates in the internal order, using
+        // m_sortedRopf as a work array, which is not used by the compiled
+        // kernels
+        if (m_plog_rates.nReactions()) {
+            double logP = log(P);
+            m_plog_rates.update_C(&logP);
+            m_plog_rates.update(T, logT, m_sortedRopf.data());
+        }
+        if (m_cheb_rates.nReactions()) {
+            double log10P = log10(P);
+            m_cheb_rates.update_C(&log10P);
+            m_cheb_rates.update(T, logT, m_sortedRopf.data());
+        }
+        for (size_t p = m_fallStart + m_fallindx.size(); p < nReactions(); p++) {
+            m_compiled_rfn[m_rxnOrder[p]] = m_sortedRopf[p];
+        }
+    }
+    m_compiled_temp = T;
+    m_compiled_pres = P;
+    m_compiled_rho = rho;
+    m_compiled_stateNum = stateNum;
+
+    m_compiled->updateROP(m_compiled_work.data(), m_conc.data(), ctot,
+                          m_compiled_rfn.data(), m_compiled_rkcn.data(),
+                          m_perturb.data(), m_ropf.data(), m_ropr.data(),
+                          m_ropnet.data());
+    m_ROP_ok = true;
+}
+
+void GasKinetics::loadCompiledKinetics(const std::string& path)
+{
+    unique_ptr<CompiledKinetics> lib(new CompiledKinetics(path));
+    if (lib->nSpecies() != m_kk || lib->nReactions() != nReactions()) {
+        throw CanteraError("GasKinetics::loadCompiledKinetics",
+            "Library '{}' is for a mechanism with {} species and {} "
+            "reactions, but this mechanism has {} species and {} reactions.",
+            path, lib->nSpecies(), lib->nReactions(), m_kk, nReactions());
+    }
+    for (size_t k = 0; k < m_kk; k++) {
+        if (lib->speciesNames()[k] != kineticsSpeciesName(k)) {
+            throw CanteraError("GasKinetics::loadCompiledKinetics",
+                "Species {} of library '{}' is '{}' instead of '{}'.", k,
+                path, lib->speciesNames()[k], kineticsSpeciesName(k));
+        }
+    }
+
+    // Compare the rates of progress and production rates with the generic
+    // evaluation at states covering a range of temperatures and pressures
+    unloadCompiledKinetics();
+    vector_fp state;
+    thermo().saveState(state);
+    double P0 = thermo().pressure();
+    vector_fp X(m_kk, 1.0 / m_kk);
+    vector_fp work(lib->workSize()), ropf(nReactions()), ropr(nReactions()),
+              ropnet(nReactions()), rfn(nReactions()), wdot(m_kk),
+              wdot_ref(m_kk);
+    string error;
+    for (double TP : {500.0, 1000.0, 2000.0}) {
+        thermo().setState_TPX(TP, P0 * TP / 1000.0, X.data());
+        updateROP();
+        Kinetics::getNetProductionRates(wdot_ref.data());
+        double T = thermo().temperature();
+        for (size_t i = 0; i < nReactions(); i++) {
+            rfn[i] = m_rfn[m_rxnPosition[i]];
+        }
+        lib->updateTemp(T, log(T), work.data());
+        lib->updateROP(work.data(), m_conc.data(), thermo().molarDensity(),
+                       rfn.data(), m_rkcn.data(), m_perturb.data(),
+                       ropf.data(), ropr.data(), ropnet.data());
+        lib->getNetProductionRates(m_ropnet.data(), wdot.data());
+        double scale = 0.0;
+        for (size_t i = 0; i < nReactions(); i++) {
+            scale = std::max({scale, std::abs(m_ropf[i]), std::abs(m_ropr[i])});
+        }
+        double atol = 1e-14 * scale;
+        for (size_t i = 0; i < nReactions() && error.empty(); i++) {
+            if (std::abs(ropf[i] - m_ropf[i]) > 1e-8 * std::abs(m_ropf[i]) + atol
+                || std::abs(ropr[i] - m_ropr[i]) > 1e-8 * std::abs(m_ropr[i]) + atol) {
+                error = fmt::format("rates of progress of reaction {} ({}) "
+                    "at T = {} differ: {} != {} or {} != {}", i,
+                    reactionString(i), T, ropf[i], m_ropf[i], ropr[i],
+                    m_ropr[i]);
+            }
+        }
+        for (size_t k = 0; k < m_kk && error.empty(); k++) {
+            if (std::abs(wdot[k] - wdot_ref[k]) > 1e-10 * scale) {
+                error = fmt::format("net production rates of species {} at "
+                    "T = {} differ: {} != {}", kineticsSpeciesName(k), T,
+                    wdot[k], wdot_ref[k]);
+            }
+        }
+    }
+    thermo().restoreState(state);
+    if (!error.empty()) {
+        throw CanteraError("GasKinetics::loadCompiledKinetics",
+            "Library '{}' is inconsistent with this mechanism: {}",
+            path, error);
+    }
+
+    m_compiled = std::move(lib);
+    m_compiled_work.resize(m_compiled->workSize());
+    m_compiled_rfn.assign(nReactions(), 0.0);
+    m_compiled_rkcn.resize(nReactions());
+    m_compiled_temp = 0.0;
+    m_ROP_ok = false;
+}
+
+void GasKinetics::unloadCompiledKinetics()
+{
+    m_compiled.reset();
+    m_ROP_ok = false;
+}
+
+void GasKinetics::setIncrementalROP(bool incremental)
+{
+    m_incrementalROP = incremental;
+    m_ROP_ref_ok = false;
+    m_ROP_ok = false;
+}
+
+void GasKinetics::saveROPReference()
+{
+    size_t nr = nReactions();
+    if (m_speciesReactions.size() != m_kk) {
+        // species affecting the concentration products of each reaction
+        SparseTriplets coeffs;
+        m_reactantStoich.getStoichCoeffs(coeffs);
+        m_revProductStoich.getStoichCoeffs(coeffs);
+        m_speciesReactions.assign(m_kk, {});
+        for (const auto& c : coeffs) {
+            m_speciesReactions[c.row()].push_back(c.col());
+        }
+        for (auto& rxns : m_speciesReactions) {
+            std::sort(rxns.begin(), rxns.end());
+            rxns.erase(std::unique(rxns.begin(), rxns.end()), rxns.end());
+        }
+    }
+    m_conc_ref = m_conc;
+    m_concm_3b_ref = concm_3b_values;
+    m_concm_falloff_ref = concm_falloff_values;
+    m_ropf_ref = m_ropf;
+    m_ropr_ref = m_ropr;
+    m_ropnet_ref = m_ropnet;
+    m_wdot_ref.assign(m_kk, 0.0);
+    m_revProductStoich.incrementSpecies(m_ropnet.data(), m_wdot_ref.data());
+    m_irrevProductStoich.incrementSpecies(m_ropnet.data(), m_wdot_ref.data());
+    m_reactantStoich.decrementSpecies(m_ropnet.data(), m_wdot_ref.data());
+    m_modified.clear();
+    m_isModified.assign(nr, 0);
+    m_rop_work.resize(nr);
+    m_ROP_ref_ok = true;
+}
+
+bool GasKinetics::updateROP_incremental()
+{
+    // restore the reactions re-evaluated for the previous state
+    for (size_t i : m_modified) {
+        m_ropf[i] = m_ropf_ref[i];
+        m_ropr[i] = m_ropr_ref[i];
+        m_ropnet[i] = m_ropnet_ref[i];
+    }
+    m_modified.clear();
+
+    // Find the affected reactions, and set their forward rate constants
+    auto mark = [this](size_t i) {
+        if (!m_isModified[i]) {
+            m_isModified[i] = 1;
+            m_modified.push_back(i);
+            m_ropf[i] = m_kf_ref[i];
+        }
+    };
+    for (size_t k = 0; k < m_kk; k++) {
+        if (m_conc[k] != m_conc_ref[k]) {
+            for (size_t i : m_speciesReactions[k]) {
+                mark(i);
+            }
+        }
+    }
+    const std::vector<size_t>& index3b = m_3b_concm.reactionIndices();
+    for (size_t n = 0; n < index3b.size(); n++) {
+        if (concm_3b_values[n] != m_concm_3b_ref[n]) {
+            size_t i = index3b[n];
+            mark(i);
+            m_ropf[i] = m_rfn[m_rxnPosition[i]] * concm_3b_values[n]
+                        * m_perturb[i];
+        }
+    }
+    if (concm_falloff_values != m_concm_falloff_ref) {
+        processFalloffReactions(m_rop_work.data());
+        for (size_t i : m_fallindx) {
+            mark(i);
+            m_ropf[i] = m_rop_work[i] * m_perturb[i];
+        }
+    }
+    for (size_t i : m_modified) {
+        m_isModified[i] = 0;
+    }
+    if (2 * m_modified.size() > nReactions()) {
+        m_modified.clear();
+        return false;
+    }
+
+    for (size_t i : m_modified) {
+        m_ropr[i] = m_ropf[i] * m_rkcn[i];
+    }
+    m_reactantStoich.multiply(m_conc.data(), m_ropf.data(), m_modified);
+    m_revProductStoich.multiply(m_conc.data(), m_ropr.data(), m_modified);
+    for (size_t i : m_modified) {
+        m_ropnet[i] = m_ropf[i] - m_ropr[i];
+    }
+    return true;
+}
+
+void GasKinetics::enableRateTables(double Tmin, double Tmax, double rtol)
+{
+    if (!m_rates_ok) {
+        installRates();
+    }
+    size_t nr = nReactions();
+    size_t nfall = m_falloff_high_rates.nReactions();
+    size_t nk = nr + 2 * nfall;
+    calculateLogKc(m_logKc.data()); // sets m_idealGas
+    size_t nv = nk + falloff_work.size() + (m_idealGas ? nr : 0);
+
+    // Signs of the rate constants, whose logarithms are tabulated. The sign
+    // of an Arrhenius rate constant does not depend on temperature, and
+    // entries which are not set by the Arrhenius rate managers are zero.
+    vector_fp kf(nk, 0.0);
+    double T = 0.5 * (Tmin + Tmax);
+    m_rates.update(T, log(T), kf.data());
+    if (nfall) {
+        m_falloff_low_rates.update(T, log(T), kf.data() + nr);
+        m_falloff_high_rates.update(T, log(T), kf.data() + nr + nfall);
+    }
+    m_table_sign.resize(nk);
+    for (size_t n = 0; n < nk; n++) {
+        m_table_sign[n] = (kf[n] > 0) - (kf[n] < 0);
+    }
+
+    // All tabulated quantities are logarithms or of order one, so that the
+    // interpolation error is controlled in absolute terms
+    vector_fp atol(nv, rtol);
+
+    // The midpoint temperatures of piecewise species thermo
+    // parameterizations are breakpoints of the equilibrium constants
+    vector_fp breakpoints;
+    if (m_idealGas) {
+        for (size_t k = 0; k < m_kk; k++) {
+            const auto* spthermo = thermo().speciesThermo().provideSTIT(k);
+            if (!spthermo) {
+                continue;
+            }
+            size_t index;
+            int type;
+            double tlow, thigh, pref;
+            vector_fp coeffs;
+            try {
+                coeffs.resize(spthermo->nCoeffs());
+            } catch (NotImplementedError&) {
+                continue;
+            }
+            spthermo->reportParameters(index, type, tlow, thigh, pref,
+                                       coeffs.data());
+            if (type == NASA2 || type == SHOMATE2) {
+                breakpoints.push_back(coeffs[0]);
+            } else if (type == NASA9MULTITEMP) {
+                for (size_t n = 1; n < coeffs[0]; n++) {
+                    breakpoints.push_back(coeffs[1 + 11 * n]);
+                }
+            }
+        }
+    }
+
+    vector_fp state;
+    thermo().saveState(state);
+    try {
+        auto table = std::make_shared<TemperatureTable>(Tmin, Tmax, nv,
+            [this](double T, double* values) {
+                evalRateTableValues(T, values);
+            }, 0.0, atol, breakpoints);
+        m_rateTable = TemperatureTable::share(table);
+    } catch (...) {
+        thermo().restoreState(state);
+        throw;
+    }
+    thermo().restoreState(state);
+    m_table_work.resize(nv);
+    invalidateCache();
+}
+
+void GasKinetics::disableRateTables()
+{
+    m_rateTable.reset();
+    invalidateCache();
+}
+
+void GasKinetics::evalRateTableValues(double T, double* values)
+{
+    size_t nr = nReactions();
+    size_t nfall = m_falloff_high_rates.nReactions();
+    size_t nk = nr + 2 * nfall;
+    double logT = log(T);
+    std::fill(values, values + nr, 0.0);
+    m_rates.update(T, logT, values);
+    if (nfall) {
+        m_falloff_low_rates.update(T, logT, values + nr);
+        m_falloff_high_rates.update(T, logT, values + nr + nfall);
+    }
+    // logarithms of the magnitudes of the rate constants
+    for (size_t n = 0; n < nk; n++) {
+        values[n] = m_table_sign[n] ? log(std::abs(values[n])) : 0.0;
+    }
+    double* v = values + nk;
+    if (!falloff_work.empty()) {
+        m_falloffn.updateTemp(T, v);
+        v += falloff_work.size();
+    }
+    if (m_idealGas) {
+        thermo().setState_TR(T, thermo().density());
+        calculateLogKc(v);
+    }
+}
+
+bool GasKinetics::interpolateRateTable(double T)
+{
+    if (!m_rateTable->interpolate(T, m_table_work.data())) {
+        return false;
+    }
+    size_t nr = nReactions();
+    size_t nfall = m_falloff_high_rates.nReactions();
+    const double* v = m_table_work.data();
+    for (size_t i = 0; i < nr; i++) {
+        m_rfn[i] = m_table_sign[i] * exp(v[i]);
+    }
+    v += nr;
+    for (size_t i = 0; i < nfall; i++) {
+        m_rfn_low[i] = m_table_sign[nr + i] * exp(v[i]);
+        m_rfn_high[i] = m_table_sign[nr + nfall + i] * exp(v[nfall + i]);
+    }
+    v += 2 * nfall;
+    std::copy(v, v + falloff_work.size(), falloff_work.begin());
+    v += falloff_work.size();
+    if (m_idealGas) {
+        std::copy(v, v + nr, m_logKc.begin());
+        updateRkcn();
+    } else {
+        updateKc();
+    }
+    return true;
+}
+
+void GasKinetics::setAdaptiveChemistry(const std::vector<std::string>& targets,
+                                       double threshold, double rtol,
+                                       double atol)
+{
+    if (targets.empty()) {
+        throw CanteraError("GasKinetics::setAdaptiveChemistry",
+                           "No target species specified.");
+    }
+    std::vector<size_t> indices;
+    for (const auto& name : targets) {
+        size_t k = thermo().speciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("GasKinetics::setAdaptiveChemistry",
+                               "Unknown target species '{}'.", name);
+        }
+        indices.push_back(k);
+    }
+    m_adaptiveTargets = indices;
+    m_adaptiveThreshold = threshold;
+    m_adaptiveRtol = rtol;
+    m_adaptiveAtol = atol;
+    m_adaptive = true;
+    m_active_ok = false;
+    m_nActiveSelections = 0;
+    m_ROP_ok = false;
+}
+
+void GasKinetics::disableAdaptiveChemistry()
+{
+    m_adaptive = false;
+    m_active_ok = false;
+    m_ROP_ok = false;
+    m_ROP_ref_ok = false;
+}
+
+std::vector<size_t> GasKinetics::activeReactions()
+{
+    if (!m_adaptive) {
+        std::vector<size_t> all(nReactions());
+        std::iota(all.begin(), all.end(), 0);
+        return all;
+    }
+    updateROP();
+    return m_activeReactions;
+}
+
+std::vector<size_t> GasKinetics::activeSpecies()
+{
+    std::vector<size_t> active;
+    if (m_adaptive) {
+        updateROP();
+    }
+    for (size_t k = 0; k < m_kk; k++) {
+        if (!m_adaptive || m_isActiveSpecies[k]) {
+            active.push_back(k);
+        }
+    }
+    return active;
+}
+
+void GasKinetics::updateROP_adaptive()
+{
+    size_t nr = nReactions();
+    bool select = !m_active_ok || adaptiveStateChanged();
+    if (select) {
+        // evaluate all reactions at the state used for the selection
+        m_activeReactions.resize(nr);
+        std::iota(m_activeReactions.begin(), m_activeReactions.end(), 0);
+        m_isActive.assign(nr, 1);
+    }
+
+    // The third-body concentrations and falloff functions are evaluated
+    // only for the active reactions
+    updateConcentrations(&m_isActive);
+    update_rates_T();
+    if (m_ROP_ok && !select) {
+        return;
+    }
+    for (size_t i : m_activeReactions) {
+        m_ropf[i] = m_rfn[m_rxnPosition[i]];
+    }
+    const std::vector<size_t>& index3b = m_3b_concm.reactionIndices();
+    for (size_t n = 0; n < index3b.size(); n++) {
+        if (m_isActive[index3b[n]]) {
+            m_ropf[index3b[n]] *= concm_3b_values[n];
+        }
+    }
+    if (m_falloff_high_rates.nReactions()) {
+        m_isActiveFalloff.resize(m_fallindx.size());
+        for (size_t i = 0; i < m_fallindx.size(); i++) {
+            m_isActiveFalloff[i] = m_isActive[m_fallindx[i]];
+        }
+        processFalloffReactions_active(m_ropf.data());
+    }
+    for (size_t i : m_activeReactions) {
+        m_ropf[i] *= m_perturb[i];
+        m_ropr[i] = m_ropf[i] * m_rkcn[i];
+    }
+    if (!m_qss.empty()) {
+        solveQuasiSteadyState();
+    }
+    m_reactantStoich.multiply(m_conc.data(), m_ropf.data(), m_activeReactions);
+    m_revProductStoich.multiply(m_conc.data(), m_ropr.data(),
+                                m_activeReactions);
+    for (size_t i : m_activeReactions) {
+        m_ropnet[i] = m_ropf[i] - m_ropr[i];
+        AssertFinite(m_ropf[i], "GasKinetics::updateROP_adaptive",
+                     "m_ropf[{}] is not finite.", i);
+        AssertFinite(m_ropr[i], "GasKinetics::updateROP_adaptive",
+                     "m_ropr[{}] is not finite.", i);
+    }
+    if (select) {
+        selectActiveReactions();
+    }
     m_ROP_ok = true;
 }
 
+void GasKinetics::selectActiveReactions()
+{
+    typedef Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator
+        RowIterator;
+    size_t nr = nReactions();
+    if (m_reactionSpecies.size() != nr
+        || size_t(m_speciesNetStoich.rows()) != m_kk) {
+        SparseTriplets coeffs;
+        m_revProductStoich.getStoichCoeffs(coeffs);
+        m_irrevProductStoich.getStoichCoeffs(coeffs);
+        m_reactantStoich.getStoichCoeffs(coeffs, -1.0);
+        m_speciesNetStoich.resize(m_kk, nr);
+        m_speciesNetStoich.setFromTriplets(coeffs.begin(), coeffs.end());
+        m_speciesNetStoich.makeCompressed();
+        m_reactionSpecies.assign(nr, {});
+        for (const auto& c : coeffs) {
+            m_reactionSpecies[c.col()].push_back(c.row());
+        }
+        for (auto& species : m_reactionSpecies) {
+            std::sort(species.begin(), species.end());
+            species.erase(std::unique(species.begin(), species.end()),
+                          species.end());
+        }
+    }
+
+    // production and consumption rates of each species
+    vector_fp P(m_kk, 0.0), C(m_kk, 0.0);
+    for (size_t k = 0; k < m_kk; k++) {
+        for (RowIterator it(m_speciesNetStoich, k); it; ++it) {
+            double w = it.value() * m_ropnet[it.col()];
+            if (w > 0) {
+                P[k] += w;
+            } else {
+                C[k] -= w;
+            }
+        }
+    }
+
+    // Overall interaction coefficients, found by a search for the paths
+    // with the largest products of the direct interaction coefficients,
+    // starting from the target species
+    vector_fp R(m_kk, 0.0);
+    vector_fp num(m_kk, 0.0);
+    std::vector<size_t> touched;
+    std::priority_queue<std::pair<double, size_t>> queue;
+    for (size_t k : m_adaptiveTargets) {
+        R[k] = 1.0;
+        queue.emplace(1.0, k);
+    }
+    while (!queue.empty()) {
+        double RA = queue.top().first;
+        size_t A = queue.top().second;
+        queue.pop();
+        double denom = std::max(P[A], C[A]);
+        if (RA < R[A] || denom == 0.0) {
+            continue;
+        }
+        for (RowIterator it(m_speciesNetStoich, A); it; ++it) {
+            double w = it.value() * m_ropnet[it.col()];
+            for (size_t B : m_reactionSpecies[it.col()]) {
+                if (B != A) {
+                    if (num[B] == 0.0) {
+                        touched.push_back(B);
+                    }
+                    num[B] += w;
+                }
+            }
+        }
+        for (size_t B : touched) {
+            double RB = RA * std::abs(num[B]) / denom;
+            if (RB >= m_adaptiveThreshold && RB > R[B]) {
+                R[B] = RB;
+                queue.emplace(RB, B);
+            }
+            num[B] = 0.0;
+        }
+        touched.clear();
+    }
+
+    m_isActiveSpecies.resize(m_kk);
+    for (size_t k = 0; k < m_kk; k++) {
+        m_isActiveSpecies[k] = (R[k] >= m_adaptiveThreshold);
+    }
+    m_activeReactions.clear();
+    for (size_t i = 0; i < nr; i++) {
+        m_isActive[i] = 1;
+        for (size_t k : m_reactionSpecies[i]) {
+            if (!m_isActiveSpecies[k]) {
+                m_isActive[i] = 0;
+                break;
+            }
+        }
+        if (m_isActive[i]) {
+            m_activeReactions.push_back(i);
+        } else {
+            m_ropf[i] = 0.0;
+            m_ropr[i] = 0.0;
+            m_ropnet[i] = 0.0;
+        }
+    }
+
+    m_adaptiveT = thermo().temperature();
+    m_adaptiveP = thermo().pressure();
+    m_adaptiveX.resize(m_kk);
+    thermo().getMoleFractions(m_adaptiveX.data());
+    m_active_ok = true;
+    m_nActiveSelections++;
+}
+
+bool GasKinetics::adaptiveStateChanged()
+{
+    double T = thermo().temperature();
+    double P = thermo().pressure();
+    if (std::abs(T - m_adaptiveT) > m_adaptiveRtol * m_adaptiveT
+        || std::abs(P - m_adaptiveP) > m_adaptiveRtol * m_adaptiveP) {
+        return true;
+    }
+    m_adaptiveX_work.resize(m_kk);
+    thermo().getMoleFractions(m_adaptiveX_work.data());
+    for (size_t k = 0; k < m_kk; k++) {
+        if (std::abs(m_adaptiveX_work[k] - m_adaptiveX[k])
+            > m_adaptiveRtol * m_adaptiveX[k] + m_adaptiveAtol) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void GasKinetics::setQuasiSteadySpecies(const std::vector<std::string>& names)
+{
+    std::vector<size_t> qss;
+    for (const auto& name : names) {
+        size_t k = thermo().speciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("GasKinetics::setQuasiSteadySpecies",
+                               "Unknown species '{}'.", name);
+        }
+        if (std::find(qss.begin(), qss.end(), k) == qss.end()) {
+            qss.push_back(k);
+        }
+    }
+    m_qss = qss;
+    m_qss_conc.assign(m_qss.size(), 0.0);
+    m_qss_ok = false;
+    m_ROP_ok = false;
+    m_ROP_ref_ok = false;
+}
+
+void GasKinetics::getQuasiSteadyConcentrations(double* conc)
+{
+    updateROP();
+    for (size_t j = 0; j < m_qss.size(); j++) {
+        conc[j] = m_conc[m_qss[j]];
+    }
+}
+
+void GasKinetics::solveQuasiSteadyState()
+{
+    size_t nr = nReactions();
+    size_t nq = m_qss.size();
+    if (!m_qss_ok) {
+        // stoichiometric coefficients of the QSS species in each reaction
+        std::vector<size_t> qssIndex(m_kk, npos);
+        for (size_t j = 0; j < nq; j++) {
+            qssIndex[m_qss[j]] = j;
+        }
+        std::map<std::pair<size_t, size_t>, std::pair<double, double>> coeffs;
+        SparseTriplets reactants, products;
+        m_reactantStoich.getStoichCoeffs(reactants);
+        m_revProductStoich.getStoichCoeffs(products);
+        m_irrevProductStoich.getStoichCoeffs(products);
+        for (const auto& c : reactants) {
+            if (qssIndex[c.row()] != npos) {
+                coeffs[{c.col(), qssIndex[c.row()]}].first += c.value();
+            }
+        }
+        for (const auto& c : products) {
+            if (qssIndex[c.row()] != npos) {
+                coeffs[{c.col(), qssIndex[c.row()]}].second += c.value();
+            }
+        }
+        m_qssReactions.clear();
+        m_qssCoeffSpecies.clear();
+        m_qssCoeffRxn.clear();
+        m_qssReactantCoeff.clear();
+        m_qssProductCoeff.clear();
+        for (const auto& c : coeffs) {
+            size_t i = c.first.first;
+            if (m_qssReactions.empty() || m_qssReactions.back() != i) {
+                m_qssReactions.push_back(i);
+            }
+            m_qssCoeffRxn.push_back(i);
+            m_qssCoeffSpecies.push_back(c.first.second);
+            m_qssReactantCoeff.push_back(c.second.first);
+            m_qssProductCoeff.push_back(c.second.second);
+        }
+        m_qss_ropf.resize(nr);
+        m_qss_ropr.resize(nr);
+        m_qss_ok = true;
+    }
+    if (m_qssReactions.empty()) {
+        return;
+    }
+
+    // Start from the concentrations found for the previous state
+    vector_fp conc(nq), prod(nq), cons(nq), dcons(nq);
+    for (size_t j = 0; j < nq; j++) {
+        conc[j] = std::max(m_qss_conc[j], Tiny);
+    }
+    const size_t maxIterations = 50;
+    bool converged = false;
+    for (size_t iter = 0; iter < maxIterations && !converged; iter++) {
+        for (size_t j = 0; j < nq; j++) {
+            m_conc[m_qss[j]] = conc[j];
+        }
+        for (size_t i : m_qssReactions) {
+            m_qss_ropf[i] = m_ropf[i];
+            m_qss_ropr[i] = m_ropr[i];
+        }
+        m_reactantStoich.multiply(m_conc.data(), m_qss_ropf.data(),
+                                  m_qssReactions);
+        m_revProductStoich.multiply(m_conc.data(), m_qss_ropr.data(),
+                                    m_qssReactions);
+
+        // production and consumption rates of each QSS species, and the
+        // derivative of the consumption rate with respect to its
+        // concentration
+        std::fill(prod.begin(), prod.end(), 0.0);
+        std::fill(cons.begin(), cons.end(), 0.0);
+        std::fill(dcons.begin(), dcons.end(), 0.0);
+        for (size_t n = 0; n < m_qssCoeffRxn.size(); n++) {
+            size_t i = m_qssCoeffRxn[n];
+            if (m_adaptive && !m_isActive[i]) {
+                continue;
+            }
+            size_t j = m_qssCoeffSpecies[n];
+            double nuR = m_qssReactantCoeff[n];
+            double nuP = m_qssProductCoeff[n];
+            double rf = m_qss_ropf[i];
+            double rr = m_qss_ropr[i];
+            prod[j] += nuP * rf + nuR * rr;
+            cons[j] += nuR * rf + nuP * rr;
+            dcons[j] += (nuR * nuR * rf + nuP * nuP * rr) / conc[j];
+        }
+
+        converged = true;
+        for (size_t j = 0; j < nq; j++) {
+            if (dcons[j] <= 0.0) {
+                continue;
+            }
+            double c = conc[j] + (prod[j] - cons[j]) / dcons[j];
+            c = std::max(c, Tiny);
+            if (std::abs(c - conc[j]) > 1e-10 * c) {
+                converged = false;
+            }
+            conc[j] = c;
+        }
+    }
+    if (!converged) {
+        throw CanteraError("GasKinetics::solveQuasiSteadyState",
+            "Concentrations of the quasi-steady-state species did not "
+            "converge after {} iterations at T = {} K, P = {} Pa.",
+            maxIterations, thermo().temperature(), thermo().pressure());
+    }
+    for (size_t j = 0; j < nq; j++) {
+        m_conc[m_qss[j]] = conc[j];
+        m_qss_conc[j] = conc[j];
+    }
+}
+
+void GasKinetics::getNetProductionRates(doublereal* net)
+{
+    updateROP();
+    if (m_adaptive) {
+        // only the active reactions have non-zero rates of progress
+        std::fill(net, net + m_kk, 0.0);
+        m_revProductStoich.incrementSpecies(m_ropnet.data(), net,
+                                            m_activeReactions);
+        m_irrevProductStoich.incrementSpecies(m_ropnet.data(), net,
+                                              m_activeReactions);
+        m_reactantStoich.decrementSpecies(m_ropnet.data(), net,
+                                          m_activeReactions);
+    } else if (m_compiled) {
+        m_compiled->getNetProductionRates(m_ropnet.data(), net);
+    } else if (!m_incrementalROP || !m_ROP_ref_ok) {
+        // all reactions were evaluated by updateROP() in the internal order
+        std::fill(net, net + m_kk, 0.0);
+        m_sortedRevProductStoich.incrementSpecies(m_sortedRopnet.data(), net);
+        m_sortedIrrevProductStoich.incrementSpecies(m_sortedRopnet.data(), net);
+        m_sortedReactantStoich.decrementSpecies(m_sortedRopnet.data(), net);
+    } else {
+        // add the changes in the rates of progress of the re-evaluated
+        // reactions to the reference production rates
+        copy(m_wdot_ref.begin(), m_wdot_ref.end(), net);
+        for (size_t i : m_modified) {
+            m_rop_work[i] = m_ropnet[i] - m_ropnet_ref[i];
+        }
+        m_revProductStoich.incrementSpecies(m_rop_work.data(), net,
+                                            m_modified);
+        m_irrevProductStoich.incrementSpecies(m_rop_work.data(), net,
+                                              m_modified);
+        m_reactantStoich.decrementSpecies(m_rop_work.data(), net, m_modified);
+    }
+    for (size_t k : m_qss) {
+        net[k] = 0.0;
+    }
+}
+
 void GasKinetics::getFwdRateConstants(doublereal* kfwd)
 {
     update_rates_C();
     update_rates_T();
 
-    // copy rate coefficients into ropf
-    m_ropf = m_rfn;
+    // copy rate coefficients into kfwd
+    for (size_t i = 0; i < nReactions(); i++) {
+        kfwd[i] = m_rfn[m_rxnPosition[i]];
+    }
 
-    // multiply ropf by enhanced 3b conc for all 3b rxns
+    // multiply kfwd by enhanced 3b conc for all 3b rxns
     if (!concm_3b_values.empty()) {
-        m_3b_concm.multiply(m_ropf.data(), concm_3b_values.data());
+        m_3b_concm.multiply(kfwd, concm_3b_values.data());
     }
 
     if (m_falloff_high_rates.nReactions()) {
-        processFalloffReactions();
+        processFalloffReactions(kfwd);
     }
 
     for (size_t i = 0; i < nReactions(); i++) {
         // multiply by perturbation factor
-        kfwd[i] = m_ropf[i] * m_perturb[i];
+        kfwd[i] *= m_perturb[i];
+    }
+}
+
+void GasKinetics::getNetProductionRates(size_t n, const double* T,
+                                        const double* P, const double* Y,
+                                        double* wdot)
+{
+    if (m_adaptive || !m_qss.empty()) {
+        // the active reactions and the concentrations of the QSS species
+        // are determined separately for each state
+        Kinetics::getNetProductionRates(n, T, P, Y, wdot);
+        return;
+    }
+    if (!m_rates_ok) {
+        installRates();
+    }
+    // number of states evaluated together
+    const size_t tileSize = 32;
+    size_t nr = nReactions();
+    size_t nfall = m_falloff_high_rates.nReactions();
+    vector_fp state;
+    thermo().saveState(state);
+
+    // Work arrays for one tile. Reaction arrays are indexed as [p*ns + j] for
+    // the reaction at position p of the internal order, and species arrays as
+    // [k*ns + j] for species k and state j
+    vector_fp logT(tileSize), recipT(tileSize), ctot(tileSize);
+    vector_fp conc(m_kk * tileSize), wtile(m_kk * tileSize);
+    vector_fp kf(nr * tileSize), kr(nr * tileSize), mult(nr * tileSize);
+    vector_fp concm_3b(concm_3b_values.size() * tileSize);
+    vector_fp concm_falloff(nfall * tileSize);
+    vector_fp kstate(nr), logKc(nr);
+    vector_fp ropf(tileSize), ropr(tileSize);
+    size_t n3b = concm_3b_values.size();
+    std::vector<char> reversible(nr, 0);
+    for (size_t irxn : m_revindex) {
+        reversible[m_rxnPosition[irxn]] = 1;
+    }
+
+    for (size_t start = 0; start < n; start += tileSize) {
+        size_t ns = std::min(tileSize, n - start);
+
+        // Evaluate the parts depending on the thermodynamic model and the
+        // pressure for one state at a time
+        for (size_t j = 0; j < ns; j++) {
+            double Tj = T[start + j];
+            thermo().setState_TPY(Tj, P[start + j], Y + (start + j) * m_kk);
+            logT[j] = std::log(Tj);
+            recipT[j] = 1.0 / Tj;
+            thermo().getActivityConcentrations(m_conc.data());
+            ctot[j] = thermo().molarDensity();
+            for (size_t k = 0; k < m_kk; k++) {
+                conc[k*ns + j] = m_conc[k];
+            }
+
+            fill(kstate.begin(), kstate.end(), 1.0);
+            if (m_plog_rates.nReactions()) {
+                double logP = log(thermo().pressure());
+                m_plog_rates.update_C(&logP);
+                m_plog_rates.update(Tj, logT[j], kstate.data());
+            }
+            if (m_cheb_rates.nReactions()) {
+                double log10P = log10(thermo().pressure());
+                m_cheb_rates.update_C(&log10P);
+                m_cheb_rates.update(Tj, logT[j], kstate.data());
+            }
+            for (size_t p = 0; p < nr; p++) {
+                mult[p*ns + j] = kstate[p] * m_sortedPerturb[p];
+            }
+
+            calculateLogKc(logKc.data());
+            for (size_t irxn : m_revindex) {
+                kr[m_rxnPosition[irxn]*ns + j] = -logKc[irxn];
+            }
+        }
+
+        // Third-body concentrations for all states in the tile
+        if (n3b) {
+            m_3b_concm.update(conc.data(), ctot.data(), concm_3b.data(), ns);
+            double* m3b = &mult[m_3bStart*ns];
+            for (size_t m = 0; m < n3b*ns; m++) {
+                m3b[m] *= concm_3b[m];
+            }
+        }
+        if (nfall) {
+            m_falloff_concm.update(conc.data(), ctot.data(),
+                                   concm_falloff.data(), ns);
+            for (size_t j = 0; j < ns; j++) {
+                for (size_t i = 0; i < nfall; i++) {
+                    concm_falloff_values[i] = concm_falloff[i*ns + j];
+                }
+                double Tj = T[start + j];
+                m_falloff_low_rates.update(Tj, logT[j], m_rfn_low.data());
+                m_falloff_high_rates.update(Tj, logT[j], m_rfn_high.data());
+                if (!falloff_work.empty()) {
+                    m_falloffn.updateTemp(Tj, falloff_work.data());
+                }
+                updateFalloffRates();
+                for (size_t i = 0; i < nfall; i++) {
+                    mult[(m_fallStart + i)*ns + j] *= m_falloff_pr[i];
+                }
+            }
+        }
+
+        // Rate constants for all states in the tile
+        fill(kf.begin(), kf.begin() + nr*ns, 1.0);
+        m_rates.update(ns, logT.data(), recipT.data(), kf.data());
+        for (size_t i = 0; i < nr*ns; i++) {
+            kf[i] *= mult[i];
+        }
+        for (size_t p = 0; p < nr; p++) {
+            double* r = &kr[p*ns];
+            if (reversible[p]) {
+                const double* f = &kf[p*ns];
+                for (size_t j = 0; j < ns; j++) {
+                    r[j] = f[j] * std::min(std::exp(r[j]), BigNumber);
+                }
+            } else {
+                fill(r, r + ns, 0.0);
+            }
+        }
+
+        // Rates of progress and production rates, in a single pass over the
+        // reactions
+        fill(wtile.begin(), wtile.begin() + m_kk*ns, 0.0);
+        for (size_t p = 0; p < nr; p++) {
+            copy(&kf[p*ns], &kf[p*ns] + ns, ropf.begin());
+            m_sortedReactantStoich.multiply(p, conc.data(), ropf.data(), ns);
+            if (reversible[p]) {
+                copy(&kr[p*ns], &kr[p*ns] + ns, ropr.begin());
+                m_sortedRevProductStoich.multiply(p, conc.data(), ropr.data(),
+                                                  ns);
+                for (size_t j = 0; j < ns; j++) {
+                    ropf[j] -= ropr[j];
+                }
+                m_sortedRevProductStoich.incrementSpecies(p, ropf.data(),
+                                                          wtile.data(), ns);
+            } else {
+                m_sortedIrrevProductStoich.incrementSpecies(p, ropf.data(),
+                                                            wtile.data(), ns);
+            }
+            m_sortedReactantStoich.decrementSpecies(p, ropf.data(),
+                                                    wtile.data(), ns);
+        }
+        for (size_t j = 0; j < ns; j++) {
+            double* w = wdot + (start + j) * m_kk;
+            for (size_t k = 0; k < m_kk; k++) {
+                w[k] = wtile[k*ns + j];
+            }
+        }
+    }
+
+    thermo().restoreState(state);
+    // cached rate data now corresponds to the last state evaluated
+    invalidateCache();
+}
+
+Eigen::SparseMatrix<double> GasKinetics::fwdRatesOfProgress_ddC()
+{
+    return calculateROP_ddC(1.0, 0.0);
+}
+
+Eigen::SparseMatrix<double> GasKinetics::revRatesOfProgress_ddC()
+{
+    return calculateROP_ddC(0.0, 1.0);
+}
+
+Eigen::SparseMatrix<double> GasKinetics::netRatesOfProgress_ddC()
+{
+    return calculateROP_ddC(1.0, -1.0);
+}
+
+Eigen::SparseMatrix<double> GasKinetics::calculateROP_ddC(double fwd, double rev)
+{
+    updateROP();
+    size_t nr = nReactions();
+    vector_fp kf(nr), rates(nr);
+    getFwdRateConstants(kf.data());
+    SparseTriplets jac;
+
+    // dependence through the concentration products
+    if (fwd != 0.0) {
+        for (size_t i = 0; i < nr; i++) {
+            rates[i] = fwd * kf[i];
+        }
+        m_reactantStoich.getDerivatives(m_conc.data(), rates.data(), jac);
+    }
+    if (rev != 0.0) {
+        for (size_t i = 0; i < nr; i++) {
+            rates[i] = rev * kf[i] * m_rkcn[i];
+        }
+        m_revProductStoich.getDerivatives(m_conc.data(), rates.data(), jac);
+    }
+
+    // dependence through the enhanced third-body concentrations
+    if (!concm_3b_values.empty() || !concm_falloff_values.empty()) {
+        // derivatives of the rate constants with respect to the third-body
+        // concentration; only entries for reactions with third bodies are used
+        vector_fp dkdM(nr), dfwd(nr), drev(nr);
+        for (size_t i = 0; i < nr; i++) {
+            dkdM[i] = m_rfn[m_rxnPosition[i]] * m_perturb[i];
+        }
+        if (m_falloff_high_rates.nReactions()) {
+            processFalloffReactions_ddM(dkdM.data());
+        }
+        for (size_t i = 0; i < nr; i++) {
+            dfwd[i] = fwd * dkdM[i];
+            drev[i] = rev * dkdM[i] * m_rkcn[i];
+        }
+        m_reactantStoich.multiply(m_conc.data(), dfwd.data());
+        m_revProductStoich.multiply(m_conc.data(), drev.data());
+        for (size_t i = 0; i < nr; i++) {
+            rates[i] = dfwd[i] + drev[i];
+        }
+        m_3b_concm.getDerivatives(rates.data(), m_kk, jac);
+        m_falloff_concm.getDerivatives(rates.data(), m_kk, jac);
+    }
+
+    if (m_adaptive) {
+        // remove the rows of the inactive reactions
+        jac.erase(std::remove_if(jac.begin(), jac.end(),
+            [this](const Eigen::Triplet<double>& t) {
+                return !m_isActive[t.row()];
+            }), jac.end());
+    }
+
+    Eigen::SparseMatrix<double> out(nr, m_kk);
+    out.setFromTriplets(jac.begin(), jac.end());
+    return out;
+}
+
+void GasKinetics::getNetRatesOfProgress_ddT(double* drop)
+{
+    update_rates_C();
+    update_rates_T();
+    updateROP();
+    size_t nr = nReactions();
+    if (!m_idealGas) {
+        // The standard chemical potentials and the activity concentrations
+        // of other phases may depend on temperature in ways that are not
+        // known here, so the rates of progress are differentiated
+        // numerically. The state of the phase is restored on exit.
+        copy(m_ropnet.begin(), m_ropnet.end(), drop);
+        double T = thermo().temperature();
+        double rho = thermo().density();
+        double dT = 1e-6 * T;
+        ThermoStateGuard guard(thermo());
+        thermo().setState_TR(T + dT, rho);
+        updateROP();
+        for (size_t i = 0; i < nr; i++) {
+            drop[i] = (m_ropnet[i] - drop[i]) / dT;
+        }
+        return;
+    }
+
+    double T = thermo().temperature();
+    double P = thermo().pressure();
+
+    // derivatives of the logarithms of the forward rate constants, in the
+    // internal order of the reactions
+    vector_fp dlogk(nr, 0.0);
+    m_rates.update_ddT(T, dlogk.data());
+
+    if (m_plog_rates.nReactions() || m_cheb_rates.nReactions()) {
+        // The P-log and Chebyshev rates are differentiated numerically,
+        // using copies of their rate managers. At constant density, the
+        // pressure of the ideal gas is proportional to temperature.
+        double dT = 1e-6 * T;
+        vector_fp k1(nr), k2(nr);
+        Rate1<Plog> plog = m_plog_rates;
+        Rate1<ChebyshevRate> cheb = m_cheb_rates;
+        for (int s = 1; s >= -1; s -= 2) {
+            double T1 = T + s * dT;
+            double P1 = P * T1 / T;
+            double* k = (s == 1) ? k1.data() : k2.data();
+            if (plog.nReactions()) {
+                double logP = log(P1);
+                plog.update_C(&logP);
+                plog.update(T1, log(T1), k);
+            }
+            if (cheb.nReactions()) {
+                double log10P = log10(P1);
+                cheb.update_C(&log10P);
+                cheb.update(T1, log(T1), k);
+            }
+        }
+        for (size_t p = m_fallStart + m_fallindx.size(); p < nr; p++) {
+            if (m_rfn[p] != 0.0) {
+                dlogk[p] = (k1[p] - k2[p]) / (2 * dT * m_rfn[p]);
+            }
+        }
+    }
+    vector_fp dlogkf(nr);
+    for (size_t i = 0; i < nr; i++) {
+        dlogkf[i] = dlogk[m_rxnPosition[i]];
+    }
+
+    size_t nfall = m_falloff_low_rates.nReactions();
+    if (nfall) {
+        // k = k_inf * Pr/(1+Pr) * F for falloff reactions, and
+        // k = k_0 / (1+Pr) * F for chemically activated reactions, where
+        // Pr = [M] * k_0 / k_inf and [M] is constant at constant density
+        vector_fp pr(nfall), dlow(nfall), dhigh(nfall), dlogPr(nfall),
+                  dT(nfall);
+        for (size_t i = 0; i < nfall; i++) {
+            pr[i] = concm_falloff_values[i] * m_rfn_low[i]
+                    / (m_rfn_high[i] + SmallNumber);
+        }
+        m_falloff_low_rates.update_ddT(T, dlow.data());
+        m_falloff_high_rates.update_ddT(T, dhigh.data());
+        m_falloffn.getDerivatives(T, pr.data(), falloff_work.data(),
+                                  dlogPr.data(), dT.data());
+        for (size_t i = 0; i < nfall; i++) {
+            double dlogk_base = (i < m_nfalloff) ? dhigh[i] : dlow[i];
+            dlogkf[m_fallindx[i]] = dlogk_base + dT[i]
+                                    + dlogPr[i] * (dlow[i] - dhigh[i]);
+        }
+    }
+
+    // ln(Kc) = -sum(nu_k * g0_k / RT) + dn * ln(P_ref / RT), where
+    // d(g0_k / RT) / dT = -h0_k / (R T^2)
+    const vector_fp& h0_RT = m_idealGas->enthalpy_RT_ref();
+    vector_fp dlogKc(nr);
+    MappedVector(dlogKc.data(), nr) =
+        (m_netStoich * ConstMappedVector(h0_RT.data(), m_kk)
+         - ConstMappedVector(m_dn.data(), nr)) / T;
+
+    // The concentrations are constant, so the forward and reverse rates of
+    // progress change in proportion to the forward and reverse rate constants
+    for (size_t i = 0; i < nr; i++) {
+        drop[i] = m_ropf[i] * dlogkf[i]
+                  - m_ropr[i] * (dlogkf[i] - dlogKc[i]);
     }
 }
 
@@ -229,10 +1584,20 @@ bool GasKinetics::addReaction(shared_ptr<Reaction> r)
     if (!added) {
         return false;
     }
+    m_ROP_ref_ok = false;
+    m_active_ok = false;
+    m_speciesReactions.clear();
+    m_reactionSpecies.clear();
+    m_qss_ok = false;
+    m_rateTable.reset();
+    unloadCompiledKinetics();
+    m_logKc.push_back(0.0);
 
+    // The rate expressions are installed in the rate managers by
+    // installRates() once the reactions are used
+    m_rates_ok = false;
     switch (r->reaction_type) {
     case ELEMENTARY_RXN:
-        addElementaryReaction(dynamic_cast<ElementaryReaction&>(*r));
         break;
     case THREE_BODY_RXN:
         addThreeBodyReaction(dynamic_cast<ThreeBodyReaction&>(*r));
@@ -242,10 +1607,7 @@ bool GasKinetics::addReaction(shared_ptr<Reaction> r)
         addFalloffReaction(dynamic_cast<FalloffReaction&>(*r));
         break;
     case PLOG_RXN:
-        addPlogReaction(dynamic_cast<PlogReaction&>(*r));
-        break;
     case CHEBYSHEV_RXN:
-        addChebyshevReaction(dynamic_cast<ChebyshevReaction&>(*r));
         break;
     default:
         throw CanteraError("GasKinetics::addReaction",
@@ -255,6 +1617,18 @@ bool GasKinetics::addReaction(shared_ptr<Reaction> r)
 }
 
 void GasKinetics::addFalloffReaction(FalloffReaction& r)
+{
+    for (const auto& eff : r.third_body.efficiencies) {
+        if (kineticsSpeciesIndex(eff.first) == npos
+            && !m_skipUndeclaredThirdBodies) {
+            throw CanteraError("GasKinetics::addFalloffReaction", "Found "
+                "third-body efficiency for undefined species '" + eff.first +
+                "' while adding reaction '" + r.equation() + "'");
+        }
+    }
+}
+
+void GasKinetics::installFalloffReaction(size_t i, FalloffReaction& r)
 {
     // install high and low rate coeff calculators and extend the high and low
     // rate coeff value vectors
@@ -265,8 +1639,11 @@ void GasKinetics::addFalloffReaction(FalloffReaction& r)
     m_rfn_low.push_back(0.0);
 
     // add this reaction number to the list of falloff reactions
-    m_fallindx.push_back(nReactions()-1);
-    m_rfallindx[nReactions()-1] = nfall;
+    m_fallindx.push_back(i);
+    m_rfallindx[i] = nfall;
+    if (r.reaction_type == FALLOFF_RXN) {
+        m_nfalloff++;
+    }
 
     // install the enhanced third-body concentration calculator
     map<size_t, double> efficiencies;
@@ -274,86 +1651,180 @@ void GasKinetics::addFalloffReaction(FalloffReaction& r)
         size_t k = kineticsSpeciesIndex(eff.first);
         if (k != npos) {
             efficiencies[k] = eff.second;
-        } else if (!m_skipUndeclaredThirdBodies) {
-            throw CanteraError("GasKinetics::addFalloffReaction", "Found "
-                "third-body efficiency for undefined species '" + eff.first +
-                "' while adding reaction '" + r.equation() + "'");
         }
     }
-    m_falloff_concm.install(nfall, efficiencies,
+    m_falloff_concm.install(i, efficiencies,
                             r.third_body.default_efficiency);
-    concm_falloff_values.resize(m_falloff_concm.workSize());
+    m_falloff_pr.push_back(0.0);
 
     // install the falloff function calculator for this reaction
     m_falloffn.install(nfall, r.reaction_type, r.falloff);
-    falloff_work.resize(m_falloffn.workSize());
 }
 
 void GasKinetics::addThreeBodyReaction(ThreeBodyReaction& r)
 {
-    m_rates.install(nReactions()-1, r.rate);
-    map<size_t, double> efficiencies;
     for (const auto& eff : r.third_body.efficiencies) {
-        size_t k = kineticsSpeciesIndex(eff.first);
-        if (k != npos) {
-            efficiencies[k] = eff.second;
-        } else if (!m_skipUndeclaredThirdBodies) {
+        if (kineticsSpeciesIndex(eff.first) == npos
+            && !m_skipUndeclaredThirdBodies) {
             throw CanteraError("GasKinetics::addThreeBodyReaction", "Found "
                 "third-body efficiency for undefined species '" + eff.first +
                 "' while adding reaction '" + r.equation() + "'");
         }
     }
-    m_3b_concm.install(nReactions()-1, efficiencies,
-                       r.third_body.default_efficiency);
-    concm_3b_values.resize(m_3b_concm.workSize());
 }
 
-void GasKinetics::addPlogReaction(PlogReaction& r)
+void GasKinetics::installThreeBodyReaction(size_t i, ThreeBodyReaction& r)
 {
-    m_plog_rates.install(nReactions()-1, r.rate);
+    map<size_t, double> efficiencies;
+    for (const auto& eff : r.third_body.efficiencies) {
+        size_t k = kineticsSpeciesIndex(eff.first);
+        if (k != npos) {
+            efficiencies[k] = eff.second;
+        }
+    }
+    m_3b_concm.install(i, efficiencies, r.third_body.default_efficiency);
 }
 
-void GasKinetics::addChebyshevReaction(ChebyshevReaction& r)
+void GasKinetics::installRates()
 {
-    m_cheb_rates.install(nReactions()-1, r.rate);
+    if (m_compact) {
+        // compact() installs the rates before releasing the Reaction objects
+        throw CanteraError("GasKinetics::installRates", "Reaction objects "
+            "have been released by compact().");
+    }
+    size_t nr = nReactions();
+
+    // Sort the reactions into blocks by rate type and reversibility,
+    // keeping the order in which they were added within each block
+    std::vector<int> block(nr);
+    for (size_t i = 0; i < nr; i++) {
+        const Reaction& r = *m_reactions[i];
+        block[i] = 2 * rateBlock(r.reaction_type) + (r.reversible ? 0 : 1);
+    }
+    m_rxnOrder.resize(nr);
+    std::iota(m_rxnOrder.begin(), m_rxnOrder.end(), 0);
+    std::stable_sort(m_rxnOrder.begin(), m_rxnOrder.end(),
+        [&block](size_t i, size_t j) { return block[i] < block[j]; });
+    m_rxnPosition.resize(nr);
+    for (size_t p = 0; p < nr; p++) {
+        m_rxnPosition[m_rxnOrder[p]] = p;
+    }
+
+    // Install the rate expressions in the internal order
+    m_rates = Rate1<Arrhenius>();
+    m_3b_concm = ThirdBodyCalc();
+    m_falloff_low_rates = Rate1<Arrhenius>();
+    m_falloff_high_rates = Rate1<Arrhenius>();
+    m_falloffn = FalloffMgr();
+    m_falloff_concm = ThirdBodyCalc();
+    m_plog_rates = Rate1<Plog>();
+    m_cheb_rates = Rate1<ChebyshevRate>();
+    m_fallindx.clear();
+    m_rfallindx.clear();
+    m_nfalloff = 0;
+    m_rfn_low.clear();
+    m_rfn_high.clear();
+    m_falloff_pr.clear();
+    m_3bStart = 0;
+    for (size_t p = 0; p < nr; p++) {
+        size_t i = m_rxnOrder[p];
+        Reaction& r = *m_reactions[i];
+        switch (r.reaction_type) {
+        case ELEMENTARY_RXN:
+            m_rates.install(p, dynamic_cast<ElementaryReaction&>(r).rate);
+            m_3bStart++;
+            break;
+        case THREE_BODY_RXN:
+            m_rates.install(p, dynamic_cast<ThreeBodyReaction&>(r).rate);
+            installThreeBodyReaction(i, dynamic_cast<ThreeBodyReaction&>(r));
+            break;
+        case FALLOFF_RXN:
+        case CHEMACT_RXN:
+            installFalloffReaction(i, dynamic_cast<FalloffReaction&>(r));
+            break;
+        case PLOG_RXN:
+            m_plog_rates.install(p, dynamic_cast<PlogReaction&>(r).rate);
+            break;
+        case CHEBYSHEV_RXN:
+            m_cheb_rates.install(p, dynamic_cast<ChebyshevReaction&>(r).rate);
+            break;
+        }
+    }
+    m_fallStart = m_3bStart + m_3b_concm.workSize();
+    concm_3b_values.resize(m_3b_concm.workSize());
+    concm_falloff_values.resize(m_falloff_concm.workSize());
+    falloff_work.resize(m_falloffn.workSize());
+
+    m_reactantStoich.finalize(m_kk);
+    m_revProductStoich.finalize(m_kk);
+    m_irrevProductStoich.finalize(m_kk);
+    m_sortedReactantStoich = m_reactantStoich.permuted(m_rxnPosition);
+    m_sortedRevProductStoich = m_revProductStoich.permuted(m_rxnPosition);
+    m_sortedIrrevProductStoich = m_irrevProductStoich.permuted(m_rxnPosition);
+    m_sortedReactantStoich.finalize(m_kk);
+    m_sortedRevProductStoich.finalize(m_kk);
+    m_sortedIrrevProductStoich.finalize(m_kk);
+    m_sortedPerturb.resize(nr);
+    for (size_t p = 0; p < nr; p++) {
+        m_sortedPerturb[p] = m_perturb[m_rxnOrder[p]];
+    }
+    m_sortedRkcn.resize(nr);
+    m_sortedRopf.resize(nr);
+    m_sortedRopr.resize(nr);
+    m_sortedRopnet.resize(nr);
+    m_rates_ok = true;
+    invalidateCache();
 }
 
 void GasKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 {
     // operations common to all reaction types
     BulkKinetics::modifyReaction(i, rNew);
+    m_rateTable.reset();
+    unloadCompiledKinetics();
 
-    switch (rNew->reaction_type) {
-    case ELEMENTARY_RXN:
-        modifyElementaryReaction(i, dynamic_cast<ElementaryReaction&>(*rNew));
-        break;
-    case THREE_BODY_RXN:
-        modifyThreeBodyReaction(i, dynamic_cast<ThreeBodyReaction&>(*rNew));
-        break;
-    case FALLOFF_RXN:
-    case CHEMACT_RXN:
-        modifyFalloffReaction(i, dynamic_cast<FalloffReaction&>(*rNew));
-        break;
-    case PLOG_RXN:
-        modifyPlogReaction(i, dynamic_cast<PlogReaction&>(*rNew));
-        break;
-    case CHEBYSHEV_RXN:
-        modifyChebyshevReaction(i, dynamic_cast<ChebyshevReaction&>(*rNew));
-        break;
-    default:
-        throw CanteraError("GasKinetics::modifyReaction",
-            "Unknown reaction type specified: {}", rNew->reaction_type);
+    // Rate expressions which are not installed yet are taken from the new
+    // reaction by installRates()
+    if (m_rates_ok) {
+        switch (rNew->reaction_type) {
+        case ELEMENTARY_RXN:
+            modifyElementaryReaction(i, dynamic_cast<ElementaryReaction&>(*rNew));
+            break;
+        case THREE_BODY_RXN:
+            modifyThreeBodyReaction(i, dynamic_cast<ThreeBodyReaction&>(*rNew));
+            break;
+        case FALLOFF_RXN:
+        case CHEMACT_RXN:
+            modifyFalloffReaction(i, dynamic_cast<FalloffReaction&>(*rNew));
+            break;
+        case PLOG_RXN:
+            modifyPlogReaction(i, dynamic_cast<PlogReaction&>(*rNew));
+            break;
+        case CHEBYSHEV_RXN:
+            modifyChebyshevReaction(i, dynamic_cast<ChebyshevReaction&>(*rNew));
+            break;
+        default:
+            throw CanteraError("GasKinetics::modifyReaction",
+                "Unknown reaction type specified: {}", rNew->reaction_type);
+        }
     }
 
     // invalidate all cached data
     m_ROP_ok = false;
+    m_ROP_ref_ok = false;
+    m_active_ok = false;
     m_temp += 0.1234;
     m_pres += 0.1234;
 }
 
+void GasKinetics::modifyElementaryReaction(size_t i, ElementaryReaction& rNew)
+{
+    m_rates.replace(m_rxnPosition[i], rNew.rate);
+}
+
 void GasKinetics::modifyThreeBodyReaction(size_t i, ThreeBodyReaction& r)
 {
-    m_rates.replace(i, r.rate);
+    m_rates.replace(m_rxnPosition[i], r.rate);
 }
 
 void GasKinetics::modifyFalloffReaction(size_t i, FalloffReaction& r)
@@ -362,16 +1833,17 @@ void GasKinetics::modifyFalloffReaction(size_t i, FalloffReaction& r)
     m_falloff_high_rates.replace(iFall, r.high_rate);
     m_falloff_low_rates.replace(iFall, r.low_rate);
     m_falloffn.replace(iFall, r.falloff);
+    falloff_work.resize(m_falloffn.workSize());
 }
 
 void GasKinetics::modifyPlogReaction(size_t i, PlogReaction& r)
 {
-    m_plog_rates.replace(i, r.rate);
+    m_plog_rates.replace(m_rxnPosition[i], r.rate);
 }
 
 void GasKinetics::modifyChebyshevReaction(size_t i, ChebyshevReaction& r)
 {
-    m_cheb_rates.replace(i, r.rate);
+    m_cheb_rates.replace(m_rxnPosition[i], r.rate);
 }
 
 void GasKinetics::init()
@@ -384,6 +1856,38 @@ void GasKinetics::invalidateCache()
 {
     BulkKinetics::invalidateCache();
     m_pres += 0.13579;
+    m_ROP_ref_ok = false;
+    m_compiled_temp = 0.0;
+}
+
+void GasKinetics::compact()
+{
+    // The rate expressions are installed from the Reaction objects
+    if (!m_rates_ok) {
+        installRates();
+    }
+    BulkKinetics::compact();
+}
+
+void GasKinetics::getMemoryUsage(std::map<std::string, size_t>& usage) const
+{
+    BulkKinetics::getMemoryUsage(usage);
+    usage["stoichiometry"] += m_sortedReactantStoich.memoryUsage()
+        + m_sortedRevProductStoich.memoryUsage()
+        + m_sortedIrrevProductStoich.memoryUsage();
+    usage["rates"] += m_rates.memoryUsage() + m_falloff_low_rates.memoryUsage()
+        + m_falloff_high_rates.memoryUsage() + m_falloffn.memoryUsage()
+        + m_3b_concm.memoryUsage() + m_falloff_concm.memoryUsage()
+        + m_plog_rates.memoryUsage() + m_cheb_rates.memoryUsage();
+}
+
+void GasKinetics::setMultiplier(size_t i, double f)
+{
+    BulkKinetics::setMultiplier(i, f);
+    if (m_rates_ok) {
+        m_sortedPerturb[m_rxnPosition[i]] = f;
+    }
+    m_ROP_ref_ok = false;
 }
 
 }
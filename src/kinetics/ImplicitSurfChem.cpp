@@ -81,9 +81,9 @@ ImplicitSurfChem::ImplicitSurfChem(
     m_integ.reset(newIntegrator("CVODE"));
 
     // use backward differencing, with a full Jacobian computed
-    // numerically, and use a Newton linear iterator
+    // analytically, and use a Newton linear iterator
     m_integ->setMethod(BDF_Method);
-    m_integ->setProblemType(DENSE + NOJAC);
+    m_integ->setProblemType(DENSE + JAC);
     m_work.resize(ntmax);
 }
 
@@ -182,13 +182,80 @@ void ImplicitSurfChem::eval(doublereal time, doublereal* y,
         double sum = 0.0;
         for (size_t k = 1; k < m_nsp[n]; k++) {
             ydot[k + loc] = m_work[kstart + k] * rs0 * m_surf[n]->size(k);
-            sum -= ydot[k];
+            sum -= ydot[k + loc];
         }
         ydot[loc] = sum;
         loc += m_nsp[n];
     }
 }
 
+void ImplicitSurfChem::evalJacobian(doublereal t, doublereal* y,
+                                    doublereal* ydot, doublereal* jac)
+{
+    updateState(y);
+    std::fill(jac, jac + m_nv * m_nv, 0.0);
+    for (size_t n = 0; n < m_surf.size(); n++) {
+        InterfaceKinetics* kin = m_vecKinPtrs[n];
+        double rs0 = 1.0/m_surf[n]->siteDensity();
+        size_t kstart = kin->kineticsSpeciesIndex(0, m_surfindex[n]);
+        size_t loc = m_specStartIndex[n];
+        Eigen::SparseMatrix<double> dwdot = kin->netProductionRates_ddC();
+
+        // Derivatives with respect to the coverages of each of the surface
+        // phases of the kinetics object, using C_j = n0 * theta_j / size_j
+        for (size_t p = 0; p < kin->nPhases(); p++) {
+            size_t m = 0;
+            while (m < m_surf.size() && &kin->thermo(p) != m_surf[m]) {
+                m++;
+            }
+            if (m == m_surf.size()) {
+                continue;
+            }
+            size_t pstart = kin->kineticsSpeciesIndex(0, p);
+            double n0 = m_surf[m]->siteDensity();
+            for (size_t j = 0; j < m_nsp[m]; j++) {
+                double* col = jac + (m_specStartIndex[m] + j) * m_nv;
+                double dCdtheta = n0 / m_surf[m]->size(j);
+                for (Eigen::SparseMatrix<double>::InnerIterator
+                     it(dwdot, pstart + j); it; ++it) {
+                    size_t k = it.row();
+                    if (k > kstart && k < kstart + m_nsp[n]) {
+                        double d = it.value() * dCdtheta * rs0
+                                   * m_surf[n]->size(k - kstart);
+                        col[loc + k - kstart] += d;
+                        col[loc] -= d;
+                    }
+                }
+            }
+        }
+    }
+
+    // The coverages are normalized in updateState(), so that
+    // d theta_i / d y_j = (delta_ij - theta_i) / sum(y)
+    vector_fp v(m_nv);
+    for (size_t m = 0; m < m_surf.size(); m++) {
+        size_t loc = m_specStartIndex[m];
+        double sum = 0.0;
+        for (size_t i = 0; i < m_nsp[m]; i++) {
+            sum += y[loc + i];
+        }
+        std::fill(v.begin(), v.end(), 0.0);
+        for (size_t i = 0; i < m_nsp[m]; i++) {
+            double theta = y[loc + i] / sum;
+            const double* col = jac + (loc + i) * m_nv;
+            for (size_t k = 0; k < m_nv; k++) {
+                v[k] += col[k] * theta;
+            }
+        }
+        for (size_t j = 0; j < m_nsp[m]; j++) {
+            double* col = jac + (loc + j) * m_nv;
+            for (size_t k = 0; k < m_nv; k++) {
+                col[k] = (col[k] - v[k]) / sum;
+            }
+        }
+    }
+}
+
 void ImplicitSurfChem::solvePseudoSteadyStateProblem(int ifuncOverride,
         doublereal timeScaleOverride)
 {
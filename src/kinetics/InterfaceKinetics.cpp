@@ -19,6 +19,10 @@ namespace Cantera
 
 InterfaceKinetics::InterfaceKinetics(thermo_t* thermo) :
     m_redo_rates(false),
+    m_redo_phi(false),
+    m_covStateNum(-1),
+    m_siteDens(0.0),
+    m_siteDensThermo(0.0),
     m_surf(0),
     m_integrator(0),
     m_ROP_ok(false),
@@ -44,28 +48,70 @@ InterfaceKinetics::~InterfaceKinetics()
 void InterfaceKinetics::setElectricPotential(int n, doublereal V)
 {
     thermo(n).setElectricPotential(V);
-    m_redo_rates = true;
+    m_redo_phi = true;
 }
 
 void InterfaceKinetics::_update_rates_T()
 {
     // First task is update the electrical potentials from the Phases
     _update_rates_phi();
-    if (m_has_coverage_dependence) {
-        m_surf->getCoverages(m_actConc.data());
-        m_rates.update_C(m_actConc.data());
-        m_redo_rates = true;
-    }
 
     // Go find the temperature from the surface
     doublereal T = thermo(surfacePhaseIndex()).temperature();
-    m_redo_rates = true;
-    if (T != m_temp || m_redo_rates) {
+
+    // Rate constants before the electrochemical corrections depend on the
+    // temperature, the coverages and the site density
+    bool redoBase = m_redo_rates || T != m_temp;
+    if (m_has_coverage_dependence && m_surf->stateMFNumber() != m_covStateNum) {
+        redoBase = true;
+    }
+    if (!m_stickingData.empty() && m_surf->siteDensity() != m_siteDens) {
+        redoBase = true;
+    }
+
+    // Standard chemical potentials and concentrations depend on the
+    // temperature and pressure of each phase and on the site density
+    bool redoThermo = m_redo_rates || T != m_temp;
+    for (size_t n = 0; n < nPhases(); n++) {
+        double Tn = thermo(n).temperature();
+        double Pn = thermo(n).pressure();
+        if (Tn != m_phaseTP[2*n] || Pn != m_phaseTP[2*n+1]) {
+            m_phaseTP[2*n] = Tn;
+            m_phaseTP[2*n+1] = Pn;
+            redoThermo = true;
+        }
+    }
+    if (m_surf && m_surf->siteDensity() != m_siteDensThermo) {
+        m_siteDensThermo = m_surf->siteDensity();
+        redoThermo = true;
+    }
+
+    if (redoBase) {
+        if (m_has_coverage_dependence) {
+            m_surf->getCoverages(m_actConc.data());
+            m_rates.update_C(m_actConc.data());
+            m_covStateNum = m_surf->stateMFNumber();
+        }
         m_logtemp = log(T);
 
-        //  Calculate the forward rate constant by calling m_rates and store it in m_rfn[]
-        m_rates.update(T, m_logtemp, m_rfn.data());
-        applyStickingCorrection(T, m_rfn.data());
+        //  Calculate the forward rate constant by calling m_rates and store it
+        //  in m_rfn_base[]
+        m_rates.update(T, m_logtemp, m_rfn_base.data());
+        applyStickingCorrection(T, m_rfn_base.data());
+        if (!m_stickingData.empty()) {
+            m_siteDens = m_surf->siteDensity();
+        }
+    }
+
+    // The equilibrium constants and the quantities used by the exchange
+    // current density formulation also depend on the electric potentials
+    if (redoThermo || m_redo_phi) {
+        updateMu0();
+        updateKc();
+    }
+
+    if (redoBase || redoThermo || m_redo_phi) {
+        copy(m_rfn_base.begin(), m_rfn_base.end(), m_rfn.begin());
 
         // If we need to do conversions between exchange current density
         // formulation and regular formulation (either way) do it here.
@@ -75,11 +121,11 @@ void InterfaceKinetics::_update_rates_T()
         if (m_has_electrochem_rxns) {
             applyVoltageKfwdCorrection(m_rfn.data());
         }
-        m_temp = T;
-        updateKc();
         m_ROP_ok = false;
-        m_redo_rates = false;
     }
+    m_temp = T;
+    m_redo_rates = false;
+    m_redo_phi = false;
 }
 
 void InterfaceKinetics::_update_rates_phi()
@@ -88,11 +134,17 @@ void InterfaceKinetics::_update_rates_phi()
     for (size_t n = 0; n < nPhases(); n++) {
         if (thermo(n).electricPotential() != m_phi[n]) {
             m_phi[n] = thermo(n).electricPotential();
-            m_redo_rates = true;
+            m_redo_phi = true;
         }
     }
 }
 
+void InterfaceKinetics::invalidateCache()
+{
+    Kinetics::invalidateCache();
+    m_redo_rates = true;
+}
+
 void InterfaceKinetics::_update_rates_C()
 {
     for (size_t n = 0; n < nPhases(); n++) {
@@ -123,12 +175,6 @@ void InterfaceKinetics::updateKc()
     fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
 
     if (m_revindex.size() > 0) {
-        /*
-         * Get the vector of standard state electrochemical potentials for
-         * species in the Interfacial kinetics object and store it in m_mu0[]
-         * and m_mu0_Kc[]
-         */
-        updateMu0();
         doublereal rrt = 1.0 / thermo(reactionPhaseIndex()).RT();
 
         // compute Delta mu^0 for all reversible reactions
@@ -154,10 +200,10 @@ void InterfaceKinetics::updateMu0()
     // First task is update the electrical potentials from the Phases
     _update_rates_phi();
 
+    // Also sets m_mu0[]
     updateExchangeCurrentQuantities();
     size_t ik = 0;
     for (size_t n = 0; n < nPhases(); n++) {
-        thermo(n).getStandardChemPotentials(m_mu0.data() + m_start[n]);
         for (size_t k = 0; k < thermo(n).nSpecies(); k++) {
             m_mu0_Kc[ik] = m_mu0[ik] + Faraday * m_phi[n] * thermo(n).charge(k);
             m_mu0_Kc[ik] -= thermo(reactionPhaseIndex()).RT()
@@ -249,7 +295,6 @@ void InterfaceKinetics::applyVoltageKfwdCorrection(doublereal* const kf)
 
 void InterfaceKinetics::convertExchangeCurrentDensityFormulation(doublereal* const kfwd)
 {
-    updateExchangeCurrentQuantities();
     // Loop over all reactions which are defined to have a voltage transfer
     // coefficient that affects the activity energy for the reaction
     for (size_t i = 0; i < m_ctrxn.size(); i++) {
@@ -316,6 +361,80 @@ void InterfaceKinetics::getRevRateConstants(doublereal* krev, bool doIrreversibl
     }
 }
 
+Eigen::SparseMatrix<double> InterfaceKinetics::fwdRatesOfProgress_ddC()
+{
+    return calculateROP_ddC(1.0, 0.0);
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::revRatesOfProgress_ddC()
+{
+    return calculateROP_ddC(0.0, 1.0);
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::netRatesOfProgress_ddC()
+{
+    return calculateROP_ddC(1.0, -1.0);
+}
+
+Eigen::SparseMatrix<double> InterfaceKinetics::calculateROP_ddC(double fwd,
+                                                                double rev)
+{
+    updateROP();
+    size_t nr = nReactions();
+    vector_fp rates(nr);
+    SparseTriplets jac;
+
+    // dependence through the activity concentration products
+    if (fwd != 0.0) {
+        for (size_t i = 0; i < nr; i++) {
+            rates[i] = fwd * m_rfn[i] * m_perturb[i];
+        }
+        m_reactantStoich.getDerivatives(m_actConc.data(), rates.data(), jac);
+    }
+    if (rev != 0.0) {
+        for (size_t i = 0; i < nr; i++) {
+            rates[i] = rev * m_rfn[i] * m_perturb[i] * m_rkcn[i];
+        }
+        m_revProductStoich.getDerivatives(m_actConc.data(), rates.data(), jac);
+    }
+
+    // dependence of the rate constants on the coverages
+    if (m_has_coverage_dependence) {
+        double T = thermo(surfacePhaseIndex()).temperature();
+        vector_fp theta(m_surf->nSpecies());
+        m_surf->getCoverages(theta.data());
+        SparseTriplets dlogk;
+        m_rates.getCoverageDerivatives(T, theta.data(), dlogk);
+
+        // d(log k)/d(log gamma) for sticking reactions using the Motz-Wise
+        // correction, k ~ gamma / (1 - gamma / 2)
+        vector_fp scale(nr, 1.0), gamma;
+        for (const auto& item : m_stickingData) {
+            if (item.use_motz_wise) {
+                if (gamma.empty()) {
+                    gamma.resize(nr);
+                    m_rates.update(T, log(T), gamma.data());
+                }
+                scale[item.index] = 1.0 / (1.0 - 0.5 * gamma[item.index]);
+            }
+        }
+
+        size_t kstart = m_start[surfacePhaseIndex()];
+        double n0 = m_surf->siteDensity();
+        for (const auto& entry : dlogk) {
+            size_t i = entry.row();
+            size_t k = entry.col();
+            double rop = fwd * m_ropf[i] + rev * m_ropr[i];
+            jac.emplace_back(i, kstart + k, rop * scale[i] * entry.value()
+                                            * m_surf->size(k) / n0);
+        }
+    }
+
+    Eigen::SparseMatrix<double> out(nr, m_kk);
+    out.setFromTriplets(jac.begin(), jac.end());
+    return out;
+}
+
 void InterfaceKinetics::updateROP()
 {
     // evaluate rate constants and equilibrium constants at temperature and phi
@@ -600,6 +719,7 @@ bool InterfaceKinetics::addReaction(shared_ptr<Reaction> r_base)
     deltaElectricEnergy_.push_back(0.0);
     m_deltaG0.push_back(0.0);
     m_deltaG.push_back(0.0);
+    m_rfn_base.push_back(0.0);
     m_ProdStanConcReac.push_back(0.0);
 
     return true;
@@ -614,7 +734,6 @@ void InterfaceKinetics::modifyReaction(size_t i, shared_ptr<Reaction> r_base)
 
     // Invalidate cached data
     m_redo_rates = true;
-    m_temp += 0.1;
 }
 
 SurfaceArrhenius InterfaceKinetics::buildSurfaceArrhenius(
@@ -758,6 +877,7 @@ void InterfaceKinetics::resizeSpecies()
     m_grt.resize(m_kk);
     m_pot.resize(m_kk, 0.0);
     m_phi.resize(nPhases(), 0.0);
+    m_phaseTP.resize(2 * nPhases(), 0.0);
 }
 
 doublereal InterfaceKinetics::electrochem_beta(size_t irxn) const
@@ -25,7 +25,8 @@ Kinetics::Kinetics() :
     m_rxnphase(npos),
     m_mindim(4),
     m_skipUndeclaredSpecies(false),
-    m_skipUndeclaredThirdBodies(false)
+    m_skipUndeclaredThirdBodies(false),
+    m_compact(false)
 {
 }
 
@@ -77,6 +78,10 @@ void Kinetics::checkSpeciesArraySize(size_t kk) const
 
 std::pair<size_t, size_t> Kinetics::checkDuplicates(bool throw_err) const
 {
+    if (m_compact) {
+        throw CanteraError("Kinetics::checkDuplicates", "Reaction objects "
+            "have been released by compact().");
+    }
     //! Map of (key indicating participating species) to reaction numbers
     std::map<size_t, std::vector<size_t> > participants;
     std::vector<std::map<int, double> > net_stoich;
@@ -357,16 +362,45 @@ size_t Kinetics::speciesPhaseIndex(size_t k) const
 
 double Kinetics::reactantStoichCoeff(size_t kSpec, size_t irxn) const
 {
+    if (m_compact) {
+        return m_compactReactantStoich.coeff(kSpec, irxn);
+    }
     return getValue(m_reactions[irxn]->reactants, kineticsSpeciesName(kSpec),
                     0.0);
 }
 
 double Kinetics::productStoichCoeff(size_t kSpec, size_t irxn) const
 {
+    if (m_compact) {
+        return m_compactProductStoich.coeff(kSpec, irxn);
+    }
     return getValue(m_reactions[irxn]->products, kineticsSpeciesName(kSpec),
                     0.0);
 }
 
+std::string Kinetics::reactantString(size_t i) const
+{
+    if (m_compact) {
+        const std::string& eq = m_compactEquations[i];
+        size_t arrow = eq.find(" <=> ");
+        return eq.substr(0, arrow != npos ? arrow : eq.find(" => "));
+    }
+    return m_reactions[i]->reactantString();
+}
+
+std::string Kinetics::productString(size_t i) const
+{
+    if (m_compact) {
+        const std::string& eq = m_compactEquations[i];
+        size_t arrow = eq.find(" <=> ");
+        if (arrow != npos) {
+            return eq.substr(arrow + 5);
+        }
+        return eq.substr(eq.find(" => ") + 4);
+    }
+    return m_reactions[i]->productString();
+}
+
 void Kinetics::getFwdRatesOfProgress(doublereal* fwdROP)
 {
     updateROP();
@@ -442,6 +476,52 @@ void Kinetics::getNetProductionRates(doublereal* net)
     m_reactantStoich.decrementSpecies(m_ropnet.data(), net);
 }
 
+void Kinetics::getNetProductionRates(size_t n, const double* T,
+                                     const double* P, const double* Y,
+                                     double* wdot)
+{
+    if (nPhases() != 1) {
+        throw CanteraError("Kinetics::getNetProductionRates",
+            "Evaluation for multiple states requires a kinetics manager "
+            "with a single phase.");
+    }
+    ThermoPhase& phase = thermo(0);
+    vector_fp state;
+    phase.saveState(state);
+    for (size_t j = 0; j < n; j++) {
+        phase.setState_TPY(T[j], P[j], Y + j*m_kk);
+        getNetProductionRates(wdot + j*m_kk);
+    }
+    phase.restoreState(state);
+}
+
+Eigen::SparseMatrix<double> Kinetics::netStoichCoeffs() const
+{
+    SparseTriplets coeffs;
+    m_revProductStoich.getStoichCoeffs(coeffs, 1.0);
+    m_irrevProductStoich.getStoichCoeffs(coeffs, 1.0);
+    m_reactantStoich.getStoichCoeffs(coeffs, -1.0);
+    Eigen::SparseMatrix<double> nu(m_kk, nReactions());
+    nu.setFromTriplets(coeffs.begin(), coeffs.end());
+    return nu;
+}
+
+Eigen::SparseMatrix<double> Kinetics::netProductionRates_ddC()
+{
+    return netStoichCoeffs() * netRatesOfProgress_ddC();
+}
+
+void Kinetics::getNetProductionRates_ddT(double* dwdot)
+{
+    vector_fp drop(nReactions());
+    getNetRatesOfProgress_ddT(drop.data());
+
+    fill(dwdot, dwdot + m_kk, 0.0);
+    m_revProductStoich.incrementSpecies(drop.data(), dwdot);
+    m_irrevProductStoich.incrementSpecies(drop.data(), dwdot);
+    m_reactantStoich.decrementSpecies(drop.data(), dwdot);
+}
+
 void Kinetics::addPhase(thermo_t& thermo)
 {
     // the phase with lowest dimensionality is assumed to be the
@@ -475,6 +555,10 @@ void Kinetics::resizeSpecies()
 
 bool Kinetics::addReaction(shared_ptr<Reaction> r)
 {
+    if (m_compact) {
+        throw CanteraError("Kinetics::addReaction", "Reactions cannot be "
+            "added after calling compact().");
+    }
     r->validate();
     if (m_kk == 0) {
         init();
@@ -588,6 +672,10 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r)
 void Kinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 {
     checkReactionIndex(i);
+    if (m_compact) {
+        throw CanteraError("Kinetics::modifyReaction", "Reactions cannot be "
+            "modified after calling compact().");
+    }
     shared_ptr<Reaction>& rOld = m_reactions[i];
     if (rNew->reaction_type != rOld->reaction_type) {
         throw CanteraError("Kinetics::modifyReaction",
@@ -613,13 +701,72 @@ void Kinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 shared_ptr<Reaction> Kinetics::reaction(size_t i)
 {
     checkReactionIndex(i);
+    if (m_compact) {
+        throw CanteraError("Kinetics::reaction", "Reaction objects have been "
+            "released by compact().");
+    }
     return m_reactions[i];
 }
 
 shared_ptr<const Reaction> Kinetics::reaction(size_t i) const
 {
     checkReactionIndex(i);
+    if (m_compact) {
+        throw CanteraError("Kinetics::reaction", "Reaction objects have been "
+            "released by compact().");
+    }
     return m_reactions[i];
 }
 
+void Kinetics::compact()
+{
+    if (m_compact) {
+        return;
+    }
+    size_t nr = nReactions();
+    m_compactEquations.resize(nr);
+    m_compactTypes.resize(nr);
+    SparseTriplets reactants, products;
+    for (size_t i = 0; i < nr; i++) {
+        const Reaction& r = *m_reactions[i];
+        m_compactEquations[i] = r.equation();
+        m_compactTypes[i] = r.reaction_type;
+        for (const auto& sp : r.reactants) {
+            reactants.emplace_back(kineticsSpeciesIndex(sp.first), i,
+                                   sp.second);
+        }
+        for (const auto& sp : r.products) {
+            products.emplace_back(kineticsSpeciesIndex(sp.first), i,
+                                  sp.second);
+        }
+        // Keep the slot so that nReactions() is unchanged
+        m_reactions[i].reset();
+    }
+    m_compactReactantStoich.resize(m_kk, nr);
+    m_compactReactantStoich.setFromTriplets(reactants.begin(), reactants.end());
+    m_compactProductStoich.resize(m_kk, nr);
+    m_compactProductStoich.setFromTriplets(products.begin(), products.end());
+    m_compact = true;
+}
+
+void Kinetics::getMemoryUsage(std::map<std::string, size_t>& usage) const
+{
+    size_t& reactions = usage["reactions"];
+    if (m_compact) {
+        for (const auto& eq : m_compactEquations) {
+            reactions += sizeof(eq) + eq.capacity();
+        }
+        reactions += m_compactTypes.capacity() * sizeof(int)
+            + (m_compactReactantStoich.nonZeros()
+               + m_compactProductStoich.nonZeros())
+              * (sizeof(double) + sizeof(int));
+    } else {
+        for (const auto& r : m_reactions) {
+            reactions += r->memoryUsage();
+        }
+    }
+    usage["stoichiometry"] += m_reactantStoich.memoryUsage()
+        + m_revProductStoich.memoryUsage() + m_irrevProductStoich.memoryUsage();
+}
+
 }
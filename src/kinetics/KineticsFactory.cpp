@@ -92,6 +92,29 @@ unique_ptr<Kinetics> newKinetics(std::vector<ThermoPhase*>& phases,
     }
 }
 
+unique_ptr<Kinetics> newKinetics(std::vector<ThermoPhase*>& phases,
+                                 Kinetics& other)
+{
+    if (other.isCompact() || phases.size() != other.nPhases()) {
+        throw CanteraError("newKinetics", "Kinetics manager cannot be copied "
+            "because it has been compacted or the number of phases differs.");
+    }
+    const AnyMap& input = other.thermo(other.reactionPhaseIndex()).input();
+    unique_ptr<Kinetics> kin(KineticsFactory::factory()->newKinetics(
+        input.getString("kinetics", "none")));
+    for (auto& phase : phases) {
+        kin->addPhase(*phase);
+    }
+    kin->init();
+    kin->skipUndeclaredSpecies(other.skipUndeclaredSpecies());
+    kin->skipUndeclaredThirdBodies(other.skipUndeclaredThirdBodies());
+    for (size_t i = 0; i < other.nReactions(); i++) {
+        kin->addReaction(other.reaction(i));
+        kin->setMultiplier(i, other.multiplier(i));
+    }
+    return kin;
+}
+
 void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode)
 {
     kin.skipUndeclaredThirdBodies(
@@ -0,0 +1,426 @@
+//! @file RateCoeffMgr.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/RateCoeffMgr.h"
+#include "cantera/numerics/eigen_dense.h"
+
+namespace Cantera
+{
+
+typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                      Eigen::RowMajor> RowMatrix;
+
+void Rate1<SurfaceArrhenius>::install(size_t rxnNumber,
+                                      const SurfaceArrhenius& rate)
+{
+    m_indices[rxnNumber] = m_rxn.size();
+    m_rxn.push_back(rxnNumber);
+    m_rates.push_back(rate);
+    m_A.push_back(rate.m_A);
+    m_b.push_back(rate.m_b);
+    m_E.push_back(rate.m_E);
+    m_logAcov.push_back(0.0);
+    m_Ecov.push_back(0.0);
+    m_work.push_back(0.0);
+    m_matricesOk = false;
+}
+
+void Rate1<SurfaceArrhenius>::replace(size_t rxnNumber,
+                                      const SurfaceArrhenius& rate)
+{
+    size_t i = m_indices[rxnNumber];
+    m_rates[i] = rate;
+    m_A[i] = rate.m_A;
+    m_b[i] = rate.m_b;
+    m_E[i] = rate.m_E;
+    m_matricesOk = false;
+}
+
+void Rate1<SurfaceArrhenius>::buildMatrices()
+{
+    m_nCov = 0;
+    for (const auto& rate : m_rates) {
+        for (size_t k : rate.m_sp) {
+            m_nCov = std::max(m_nCov, k + 1);
+        }
+        for (size_t k : rate.m_msp) {
+            m_nCov = std::max(m_nCov, k + 1);
+        }
+    }
+
+    // Duplicate entries are summed by setFromTriplets, as required when a
+    // reaction has more than one dependency on the same species
+    SparseTriplets A, E;
+    for (size_t i = 0; i < m_rates.size(); i++) {
+        const SurfaceArrhenius& rate = m_rates[i];
+        for (size_t n = 0; n < rate.m_sp.size(); n++) {
+            if (rate.m_ac[n] != 0.0) {
+                A.emplace_back(i, rate.m_sp[n], std::log(10.0) * rate.m_ac[n]);
+            }
+            if (rate.m_ec[n] != 0.0) {
+                E.emplace_back(i, rate.m_sp[n], rate.m_ec[n]);
+            }
+        }
+        for (size_t n = 0; n < rate.m_msp.size(); n++) {
+            A.emplace_back(i, m_nCov + rate.m_msp[n], rate.m_mc[n]);
+        }
+    }
+    m_covA.resize(m_rates.size(), 2 * m_nCov);
+    m_covA.setFromTriplets(A.begin(), A.end());
+    m_covE.resize(m_rates.size(), m_nCov);
+    m_covE.setFromTriplets(E.begin(), E.end());
+    m_covTerms.resize(2 * m_nCov);
+    std::fill(m_logAcov.begin(), m_logAcov.end(), 0.0);
+    std::fill(m_Ecov.begin(), m_Ecov.end(), 0.0);
+    m_matricesOk = true;
+}
+
+void Rate1<SurfaceArrhenius>::update_C(const doublereal* c)
+{
+    if (!m_matricesOk) {
+        buildMatrices();
+    }
+    if (m_nCov == 0) {
+        return;
+    }
+    ConstMappedVector theta(c, m_nCov);
+    MappedVector terms(m_covTerms.data(), 2 * m_nCov);
+    terms.head(m_nCov) = theta;
+    terms.tail(m_nCov) = theta.array().max(Tiny).log().matrix();
+    MappedVector(m_logAcov.data(), m_rxn.size()) = m_covA * terms;
+    MappedVector(m_Ecov.data(), m_rxn.size()) = m_covE * theta;
+}
+
+void Rate1<SurfaceArrhenius>::getCoverageDerivatives(double T,
+    const double* theta, SparseTriplets& jac)
+{
+    if (!m_matricesOk) {
+        buildMatrices();
+    }
+    typedef Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator Iter;
+    for (size_t i = 0; i < m_rxn.size(); i++) {
+        for (Iter it(m_covA, i); it; ++it) {
+            size_t k = it.col();
+            if (k < m_nCov) {
+                jac.emplace_back(m_rxn[i], k, it.value());
+            } else if (theta[k - m_nCov] > Tiny) {
+                // the log of the coverage is limited to log(Tiny)
+                jac.emplace_back(m_rxn[i], k - m_nCov,
+                                 it.value() / theta[k - m_nCov]);
+            }
+        }
+        for (Iter it(m_covE, i); it; ++it) {
+            jac.emplace_back(m_rxn[i], it.col(), - it.value() / T);
+        }
+    }
+}
+
+void Rate1<SurfaceArrhenius>::update(doublereal T, doublereal logT,
+                                     doublereal* values)
+{
+    doublereal recipT = 1.0/T;
+    size_t n = m_rxn.size();
+    for (size_t i = 0; i < n; i++) {
+        m_work[i] = m_logAcov[i] + m_b[i]*logT - (m_E[i] + m_Ecov[i])*recipT;
+    }
+    for (size_t i = 0; i < n; i++) {
+        values[m_rxn[i]] = m_A[i] * std::exp(m_work[i]);
+    }
+}
+
+void Rate1<Plog>::install(size_t rxnNumber, const Plog& rate)
+{
+    m_indices[rxnNumber] = m_rxn.size();
+    m_rxn.push_back(rxnNumber);
+    m_rates.push_back(rate);
+    addRate(m_rxn.size() - 1, rate);
+    m_activeStart.clear(); // force update of the active expressions
+}
+
+void Rate1<Plog>::replace(size_t rxnNumber, const Plog& rate)
+{
+    m_rates[m_indices[rxnNumber]] = rate;
+
+    // rebuild the flattened representation of all reactions, since the
+    // number of Arrhenius expressions and the pressure grid may change
+    m_gridLogP.clear();
+    m_gridLow.clear();
+    m_gridHigh.clear();
+    m_gridFrac.clear();
+    m_grid.clear();
+    m_levelStart.clear();
+    m_levels.clear();
+    m_logA.clear();
+    m_A.clear();
+    m_b.clear();
+    m_E.clear();
+    for (size_t i = 0; i < m_rates.size(); i++) {
+        addRate(i, m_rates[i]);
+    }
+    m_activeStart.clear();
+}
+
+void Rate1<Plog>::addRate(size_t i, const Plog& rate)
+{
+    vector_fp logP;
+    m_levelStart.push_back(m_levels.size());
+    for (const auto& r : rate.rates()) {
+        double logp = std::log(r.first);
+        if (logP.empty() || logP.back() != logp) {
+            // starting a new reference pressure
+            logP.push_back(logp);
+            m_levels.push_back(m_A.size());
+        }
+        double A = r.second.preExponentialFactor();
+        m_A.push_back(A);
+        m_logA.push_back(A <= 0.0 ? -1.0E300 : std::log(A));
+        m_b.push_back(r.second.temperatureExponent());
+        m_E.push_back(r.second.activationEnergy_R());
+    }
+    m_levels.push_back(m_A.size());
+
+    // share the pressure grid with earlier reactions if possible
+    size_t grid = std::find(m_gridLogP.begin(), m_gridLogP.end(), logP)
+                  - m_gridLogP.begin();
+    if (grid == m_gridLogP.size()) {
+        m_gridLogP.push_back(logP);
+        m_gridLow.push_back(npos);
+        m_gridHigh.push_back(npos);
+        m_gridFrac.push_back(0.0);
+    }
+    m_grid.push_back(grid);
+}
+
+void Rate1<Plog>::update_C(const doublereal* c)
+{
+    m_logP = c[0];
+    bool changed = m_activeStart.size() != 2 * m_rxn.size() + 1;
+    for (size_t g = 0; g < m_gridLogP.size(); g++) {
+        const vector_fp& logP = m_gridLogP[g];
+        size_t upper = std::upper_bound(logP.begin(), logP.end(), m_logP)
+                       - logP.begin();
+        size_t low, high;
+        if (upper == 0) {
+            low = high = 0;
+        } else if (upper == logP.size()) {
+            low = high = logP.size() - 1;
+        } else {
+            low = upper - 1;
+            high = upper;
+        }
+        if (low != m_gridLow[g] || high != m_gridHigh[g]) {
+            changed = true;
+            m_gridLow[g] = low;
+            m_gridHigh[g] = high;
+        }
+        if (low != high) {
+            double rDeltaP = 1.0 / (logP[high] - logP[low]);
+            m_gridFrac[g] = (m_logP - logP[low]) * rDeltaP;
+        } else {
+            m_gridFrac[g] = 0.0;
+        }
+    }
+    if (changed) {
+        updateActive();
+    }
+}
+
+void Rate1<Plog>::updateActive()
+{
+    m_activeStart.assign(1, 0);
+    m_activeLogA.clear();
+    m_activeA.clear();
+    m_activeB.clear();
+    m_activeE.clear();
+    for (size_t i = 0; i < m_rxn.size(); i++) {
+        size_t g = m_grid[i];
+        size_t levels[2] = {m_gridLow[g], m_gridHigh[g]};
+        for (size_t n = 0; n < 2; n++) {
+            if (n == 1 && levels[1] == levels[0]) {
+                // no interpolation; leave the upper range empty
+                m_activeStart.push_back(m_activeA.size());
+                break;
+            }
+            size_t level = m_levelStart[i] + levels[n];
+            for (size_t j = m_levels[level]; j < m_levels[level+1]; j++) {
+                m_activeLogA.push_back(m_logA[j]);
+                m_activeA.push_back(m_A[j]);
+                m_activeB.push_back(m_b[j]);
+                m_activeE.push_back(m_E[j]);
+            }
+            m_activeStart.push_back(m_activeA.size());
+        }
+    }
+    m_work.resize(m_activeA.size());
+}
+
+void Rate1<Plog>::update(doublereal T, doublereal logT, doublereal* values)
+{
+    if (m_activeStart.size() != 2 * m_rxn.size() + 1) {
+        update_C(&m_logP);
+    }
+    double recipT = 1.0 / T;
+    const double* b = m_activeB.data();
+    const double* E = m_activeE.data();
+    double* w = m_work.data();
+    for (size_t j = 0; j < m_work.size(); j++) {
+        w[j] = b[j]*logT - E[j]*recipT;
+    }
+
+    // log of the rate coefficient given by the active expressions from
+    // position j1 to j2-1
+    auto logRate = [&](size_t j1, size_t j2) {
+        if (j2 == j1 + 1) {
+            return m_activeLogA[j1] + w[j1];
+        }
+        double k = 1e-300; // non-zero to make log(k) finite
+        for (size_t j = j1; j < j2; j++) {
+            k += m_activeA[j] * std::exp(w[j]);
+        }
+        return std::log(k);
+    };
+
+    const size_t* start = m_activeStart.data();
+    for (size_t i = 0; i < m_rxn.size(); i++, start += 2) {
+        double log_k1 = logRate(start[0], start[1]);
+        if (start[2] == start[1]) {
+            values[m_rxn[i]] = std::exp(log_k1);
+        } else {
+            double log_k2 = logRate(start[1], start[2]);
+            values[m_rxn[i]] = std::exp(
+                log_k1 + (log_k2 - log_k1) * m_gridFrac[m_grid[i]]);
+        }
+    }
+}
+
+size_t Rate1<Plog>::memoryUsage() const
+{
+    size_t usage = vectorMemoryUsage(m_rates) + vectorMemoryUsage(m_rxn)
+        + mapMemoryUsage(m_indices) + vectorMemoryUsage(m_gridLogP)
+        + vectorMemoryUsage(m_gridLow) + vectorMemoryUsage(m_gridHigh)
+        + vectorMemoryUsage(m_gridFrac) + vectorMemoryUsage(m_grid)
+        + vectorMemoryUsage(m_levelStart) + vectorMemoryUsage(m_levels)
+        + vectorMemoryUsage(m_logA) + vectorMemoryUsage(m_A)
+        + vectorMemoryUsage(m_b) + vectorMemoryUsage(m_E)
+        + vectorMemoryUsage(m_activeStart) + vectorMemoryUsage(m_activeLogA)
+        + vectorMemoryUsage(m_activeA) + vectorMemoryUsage(m_activeB)
+        + vectorMemoryUsage(m_activeE) + vectorMemoryUsage(m_work);
+    for (const auto& logP : m_gridLogP) {
+        usage += vectorMemoryUsage(logP);
+    }
+    return usage;
+}
+
+
+void Rate1<ChebyshevRate>::install(size_t rxnNumber, const ChebyshevRate& rate)
+{
+    m_indices[rxnNumber] = m_rxn.size();
+    m_rxn.push_back(rxnNumber);
+    m_rates.push_back(rate);
+    addRate(rxnNumber, rate);
+}
+
+void Rate1<ChebyshevRate>::replace(size_t rxnNumber, const ChebyshevRate& rate)
+{
+    m_rates[m_indices[rxnNumber]] = rate;
+
+    // regroup all reactions, since the ranges may have changed
+    m_groups.clear();
+    for (size_t i = 0; i < m_rates.size(); i++) {
+        addRate(m_rxn[i], m_rates[i]);
+    }
+}
+
+void Rate1<ChebyshevRate>::addRate(size_t rxnNumber, const ChebyshevRate& rate)
+{
+    size_t nT = rate.nTemperature();
+    size_t nP = rate.nPressure();
+    Group* group = nullptr;
+    for (auto& g : m_groups) {
+        if (g.Tmin == rate.Tmin() && g.Tmax == rate.Tmax()
+            && g.Pmin == rate.Pmin() && g.Pmax == rate.Pmax()
+            && g.nT == nT && g.nP == nP) {
+            group = &g;
+            break;
+        }
+    }
+    if (!group) {
+        m_groups.emplace_back();
+        group = &m_groups.back();
+        group->Tmin = rate.Tmin();
+        group->Tmax = rate.Tmax();
+        group->Pmin = rate.Pmin();
+        group->Pmax = rate.Pmax();
+        group->nT = nT;
+        group->nP = nP;
+        double logPmin = std::log10(rate.Pmin());
+        double logPmax = std::log10(rate.Pmax());
+        double TminInv = 1.0 / rate.Tmin();
+        double TmaxInv = 1.0 / rate.Tmax();
+        group->TrNum = - TminInv - TmaxInv;
+        group->TrDen = 1.0 / (TmaxInv - TminInv);
+        group->PrNum = - logPmin - logPmax;
+        group->PrDen = 1.0 / (logPmax - logPmin);
+    }
+    group->rxn.push_back(rxnNumber);
+    const vector_fp& coeffs = rate.coeffs();
+    group->coeffs.insert(group->coeffs.end(), coeffs.begin(), coeffs.end());
+    group->dotProd.resize(group->dotProd.size() + nT, 0.0);
+    group->logk.push_back(0.0);
+    m_poly.resize(std::max(m_poly.size(), std::max(nT, nP)));
+}
+
+//! Evaluate the Chebyshev polynomials of degree 0 to n-1 at x
+static void chebyshevPolynomials(double x, size_t n, double* poly)
+{
+    poly[0] = 1.0;
+    if (n > 1) {
+        poly[1] = x;
+    }
+    for (size_t i = 2; i < n; i++) {
+        poly[i] = 2 * x * poly[i-1] - poly[i-2];
+    }
+}
+
+void Rate1<ChebyshevRate>::update_C(const doublereal* c)
+{
+    for (auto& g : m_groups) {
+        double Pr = (2 * c[0] + g.PrNum) * g.PrDen;
+        chebyshevPolynomials(Pr, g.nP, m_poly.data());
+        Eigen::Map<const RowMatrix> C(g.coeffs.data(), g.dotProd.size(), g.nP);
+        MappedVector(g.dotProd.data(), g.dotProd.size()) =
+            C * ConstMappedVector(m_poly.data(), g.nP);
+    }
+}
+
+void Rate1<ChebyshevRate>::update(doublereal T, doublereal logT,
+                                  doublereal* values)
+{
+    double recipT = 1.0 / T;
+    for (auto& g : m_groups) {
+        double Tr = (2 * recipT + g.TrNum) * g.TrDen;
+        chebyshevPolynomials(Tr, g.nT, m_poly.data());
+        Eigen::Map<const RowMatrix> D(g.dotProd.data(), g.rxn.size(), g.nT);
+        MappedVector(g.logk.data(), g.logk.size()) =
+            D * ConstMappedVector(m_poly.data(), g.nT);
+        for (size_t i = 0; i < g.rxn.size(); i++) {
+            values[g.rxn[i]] = std::pow(10, g.logk[i]);
+        }
+    }
+}
+
+size_t Rate1<ChebyshevRate>::memoryUsage() const
+{
+    size_t usage = vectorMemoryUsage(m_rates) + vectorMemoryUsage(m_rxn)
+        + mapMemoryUsage(m_indices) + vectorMemoryUsage(m_groups)
+        + vectorMemoryUsage(m_poly);
+    for (const auto& group : m_groups) {
+        usage += vectorMemoryUsage(group.rxn) + vectorMemoryUsage(group.coeffs)
+            + vectorMemoryUsage(group.dotProd) + vectorMemoryUsage(group.logk);
+    }
+    return usage;
+}
+
+}
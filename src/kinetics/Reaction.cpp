@@ -63,6 +63,12 @@ void Reaction::validate()
     }
 }
 
+size_t Reaction::memoryUsage() const
+{
+    return mapMemoryUsage(reactants) + mapMemoryUsage(products)
+        + mapMemoryUsage(orders) + id.capacity() + input.memoryUsage();
+}
+
 std::string Reaction::reactantString() const
 {
     std::ostringstream result;
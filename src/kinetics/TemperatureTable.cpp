@@ -0,0 +1,168 @@
+//! @file TemperatureTable.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/TemperatureTable.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <cstring>
+#include <mutex>
+
+namespace Cantera
+{
+
+namespace {
+std::mutex table_mutex;
+std::vector<std::weak_ptr<const TemperatureTable>> shared_tables;
+}
+
+TemperatureTable::TemperatureTable(double Tmin, double Tmax, size_t nValues,
+                                   const std::function<void(double, double*)>& f,
+                                   double rtol, const vector_fp& atol,
+                                   const vector_fp& breakpoints,
+                                   size_t maxIntervals)
+    : m_nValues(nValues)
+    , m_checksum(0)
+{
+    if (Tmin <= 0 || Tmax <= Tmin) {
+        throw CanteraError("TemperatureTable::TemperatureTable",
+            "Invalid temperature range [{}, {}].", Tmin, Tmax);
+    }
+    if (nValues == 0 || atol.size() != nValues) {
+        throw CanteraError("TemperatureTable::TemperatureTable",
+            "Expected {} absolute tolerances but got {}.", nValues,
+            atol.size());
+    }
+    m_bounds.push_back(Tmin);
+    for (double T : breakpoints) {
+        if (T > Tmin && T < Tmax) {
+            m_bounds.push_back(T);
+        }
+    }
+    m_bounds.push_back(Tmax);
+    std::sort(m_bounds.begin(), m_bounds.end());
+    m_bounds.erase(std::unique(m_bounds.begin(), m_bounds.end()),
+                   m_bounds.end());
+
+    // Grid points at breakpoints are evaluated slightly inside the segment,
+    // so that the branch of a piecewise function used for each segment is
+    // the one valid within the segment
+    const double nudge = 1e-12;
+    vector_fp data, mid, interp(nValues), refined;
+    for (size_t seg = 0; seg + 1 < m_bounds.size(); seg++) {
+        double Tlow = m_bounds[seg];
+        double Thigh = m_bounds[seg + 1];
+        auto eval = [&](double x, double* values) {
+            double T = 1.0 / x;
+            if (seg > 0) {
+                T = std::max(T, Tlow * (1 + nudge));
+            }
+            if (seg + 2 < m_bounds.size()) {
+                T = std::min(T, Thigh * (1 - nudge));
+            }
+            f(T, values);
+        };
+
+        double x0 = 1.0 / Thigh;
+        double range = 1.0 / Tlow - x0;
+        size_t N = 16;
+        data.resize((N + 1) * nValues);
+        for (size_t j = 0; j <= N; j++) {
+            eval(x0 + range * j / N, &data[j * nValues]);
+        }
+        while (true) {
+            // Compare the interpolated values at the midpoints of the
+            // intervals with the exact values, which are also the
+            // additional grid points needed if the grid is refined
+            mid.resize(N * nValues);
+            double maxError = 0.0; // largest error relative to tolerance
+            for (size_t j = 0; j < N; j++) {
+                double x = x0 + range * (j + 0.5) / N;
+                double* exact = &mid[j * nValues];
+                eval(x, exact);
+                size_t k = std::min(j > 0 ? j - 1 : 0, N - 3);
+                interpolateRows(&data[k * nValues], (x - x0) * N / range - k,
+                                interp.data());
+                for (size_t n = 0; n < nValues; n++) {
+                    double tol = rtol * std::abs(exact[n]) + atol[n];
+                    double err = std::abs(interp[n] - exact[n]);
+                    if (err > tol) {
+                        maxError = std::max(maxError, err / tol);
+                    }
+                }
+            }
+            if (maxError == 0.0) {
+                break;
+            } else if (2 * N > maxIntervals) {
+                throw CanteraError("TemperatureTable::TemperatureTable",
+                    "Interpolation error exceeds the tolerance by a factor "
+                    "of {} with {} intervals between {} K and {} K.",
+                    maxError, N, Tlow, Thigh);
+            }
+            refined.resize((2 * N + 1) * nValues);
+            for (size_t j = 0; j <= N; j++) {
+                std::copy(&data[j * nValues], &data[j * nValues] + nValues,
+                          &refined[2 * j * nValues]);
+                if (j < N) {
+                    std::copy(&mid[j * nValues], &mid[j * nValues] + nValues,
+                              &refined[(2 * j + 1) * nValues]);
+                }
+            }
+            data.swap(refined);
+            N *= 2;
+        }
+        m_x0.push_back(x0);
+        m_rdx.push_back(N / range);
+        m_nIntervals.push_back(N);
+        m_offset.push_back(m_data.size() / nValues);
+        m_data.insert(m_data.end(), data.begin(), data.end());
+    }
+
+    // FNV-1a hash of the table contents
+    m_checksum = 14695981039346656037ull;
+    const unsigned char* bytes =
+        reinterpret_cast<const unsigned char*>(m_data.data());
+    for (size_t i = 0; i < m_data.size() * sizeof(double); i++) {
+        m_checksum = (m_checksum ^ bytes[i]) * 1099511628211ull;
+    }
+}
+
+size_t TemperatureTable::nIntervals() const
+{
+    size_t n = 0;
+    for (size_t N : m_nIntervals) {
+        n += N;
+    }
+    return n;
+}
+
+bool TemperatureTable::operator==(const TemperatureTable& other) const
+{
+    return m_bounds == other.m_bounds && m_nValues == other.m_nValues
+        && m_nIntervals == other.m_nIntervals
+        && m_checksum == other.m_checksum
+        && std::memcmp(m_data.data(), other.m_data.data(),
+                       m_data.size() * sizeof(double)) == 0;
+}
+
+shared_ptr<const TemperatureTable> TemperatureTable::share(
+    shared_ptr<const TemperatureTable> table)
+{
+    std::unique_lock<std::mutex> lock(table_mutex);
+    auto iter = shared_tables.begin();
+    while (iter != shared_tables.end()) {
+        auto existing = iter->lock();
+        if (!existing) {
+            iter = shared_tables.erase(iter);
+        } else if (*existing == *table) {
+            return existing;
+        } else {
+            ++iter;
+        }
+    }
+    shared_tables.push_back(table);
+    return table;
+}
+
+}
@@ -447,9 +447,71 @@ void solveSP::resjac_eval(DenseMatrix& jac,
                           const doublereal CSolnOld[], const bool do_time,
                           const doublereal deltaT)
 {
-    size_t kColIndex = 0;
     // Calculate the residual
     fun_eval(resid, CSoln, CSolnOld, do_time, deltaT);
+    if (m_bulkFunc == BULK_DEPOSITION) {
+        resjac_eval_fd(jac, resid, CSoln, CSolnOld, do_time, deltaT);
+        return;
+    }
+
+    // Assemble the Jacobian from the derivatives of the net production rates
+    // with respect to the surface concentrations
+    jac.zero();
+    for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+        InterfaceKinetics* kin = m_objects[isp];
+        size_t nsp = m_nSpeciesSurfPhase[isp];
+        size_t ieq = m_eqnIndexStartSolnPhase[isp];
+        size_t kstart = kin->kineticsSpeciesIndex(0, kin->surfacePhaseIndex());
+
+        // Index of the first unknown for each phase of the kinetics object,
+        // or npos for phases that are not solved for
+        vector<size_t> jstart(kin->nPhases(), npos);
+        for (size_t p = 0; p < kin->nPhases(); p++) {
+            for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
+                if (&kin->thermo(p) == m_ptrsSurfPhase[jsp]) {
+                    jstart[p] = m_eqnIndexStartSolnPhase[jsp];
+                }
+            }
+        }
+
+        Eigen::SparseMatrix<double> dwdot = kin->netProductionRates_ddC();
+        for (int col = 0; col < dwdot.outerSize(); col++) {
+            size_t p = kin->speciesPhaseIndex(col);
+            if (jstart[p] == npos) {
+                continue;
+            }
+            size_t j = jstart[p] + col - kin->kineticsSpeciesIndex(0, p);
+            for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot, col);
+                 it; ++it) {
+                size_t k = it.row();
+                if (k >= kstart && k < kstart + nsp) {
+                    jac(ieq + k - kstart, j) -= it.value();
+                }
+            }
+        }
+        if (do_time) {
+            for (size_t k = 0; k < nsp; k++) {
+                jac(ieq + k, ieq + k) += 1.0 / deltaT;
+            }
+        }
+
+        // The equation for the largest species is replaced by the site
+        // conservation equation
+        size_t kspecial = ieq + m_spSurfLarge[isp];
+        for (size_t j = 0; j < m_neq; j++) {
+            jac(kspecial, j) = 0.0;
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            jac(kspecial, ieq + k) = -1.0;
+        }
+    }
+}
+
+void solveSP::resjac_eval_fd(DenseMatrix& jac, const doublereal resid[],
+                             doublereal CSoln[], const doublereal CSolnOld[],
+                             const bool do_time, const doublereal deltaT)
+{
+    size_t kColIndex = 0;
     // Now we will look over the columns perturbing each unknown.
     for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
         size_t nsp = m_nSpeciesSurfPhase[jsp];
@@ -484,6 +546,8 @@ void solveSP::resjac_eval(DenseMatrix& jac,
             }
         }
     }
+    // restore the unperturbed state
+    updateState(CSoln);
 }
 
 /*!
@@ -64,6 +64,28 @@ extern "C" {
         return f->eval_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot));
     }
 
+    //! Function called by CVodes to evaluate the Jacobian of ydot with respect
+    //! to y, if the problem type is DENSE + JAC.
+    #if CT_SUNDIALS_VERSION >= 30
+    static int cvodes_jac(realtype t, N_Vector y, N_Vector ydot, SUNMatrix J,
+                          void* f_data, N_Vector tmp1, N_Vector tmp2,
+                          N_Vector tmp3)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalJacobian_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot),
+                                       SUNDenseMatrix_Data(J));
+    }
+    #else
+    static int cvodes_jac(sd_size_t N, realtype t, N_Vector y, N_Vector ydot,
+                          DlsMat J, void* f_data, N_Vector tmp1,
+                          N_Vector tmp2, N_Vector tmp3)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalJacobian_nothrow(t, NV_DATA_S(y), NV_DATA_S(ydot),
+                                       J->data);
+    }
+    #endif
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -364,7 +386,7 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
 
 void CVodesIntegrator::applyOptions()
 {
-    if (m_type == DENSE + NOJAC) {
+    if (m_type == DENSE + NOJAC || m_type == DENSE + JAC) {
         sd_size_t N = static_cast<sd_size_t>(m_neq);
         #if CT_SUNDIALS_VERSION >= 30
             SUNLinSolFree((SUNLinearSolver) m_linsol);
@@ -381,12 +403,18 @@ void CVodesIntegrator::applyOptions()
             #endif
             CVDlsSetLinearSolver(m_cvode_mem, (SUNLinearSolver) m_linsol,
                                  (SUNMatrix) m_linsol_matrix);
+            if (m_type == DENSE + JAC) {
+                CVDlsSetJacFn(m_cvode_mem, cvodes_jac);
+            }
         #else
             #if CT_SUNDIALS_USE_LAPACK
                 CVLapackDense(m_cvode_mem, N);
             #else
                 CVDense(m_cvode_mem, N);
             #endif
+            if (m_type == DENSE + JAC) {
+                CVDlsSetDenseJacFn(m_cvode_mem, cvodes_jac);
+            }
         #endif
     } else if (m_type == DIAG) {
         CVDiag(m_cvode_mem);
@@ -13,6 +13,27 @@ int FuncEval::eval_nothrow(double t, double* y, double* ydot)
 {
     try {
         eval(t, y, ydot, m_sens_params.data());
+    } catch (...) {
+        return handleError("FuncEval::eval_nothrow");
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::evalJacobian_nothrow(double t, double* y, double* ydot,
+                                   double* jac)
+{
+    try {
+        evalJacobian(t, y, ydot, jac);
+    } catch (...) {
+        return handleError("FuncEval::evalJacobian_nothrow");
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::handleError(const std::string& method)
+{
+    try {
+        throw;
     } catch (CanteraError& err) {
         if (suppressErrors()) {
             m_errors.push_back(err.what());
@@ -24,14 +45,13 @@ int FuncEval::eval_nothrow(double t, double* y, double* ydot)
         if (suppressErrors()) {
             m_errors.push_back(err.what());
         } else {
-            writelog("FuncEval::eval_nothrow: unhandled exception:\n");
+            writelog(method + ": unhandled exception:\n");
             writelog(err.what());
             writelogendl();
         }
         return -1; // unrecoverable error
     } catch (...) {
-        std::string msg = "FuncEval::eval_nothrow: unhandled exception"
-            " of unknown type\n";
+        std::string msg = method + ": unhandled exception of unknown type\n";
         if (suppressErrors()) {
             m_errors.push_back(msg);
         } else {
@@ -39,7 +59,6 @@ int FuncEval::eval_nothrow(double t, double* y, double* ydot)
         }
         return -1; // unrecoverable error
     }
-    return 0; // successful evaluation
 }
 
 std::string FuncEval::getErrors() const {
@@ -47,7 +47,7 @@ void Boundary1D::_init(size_t n)
             m_left_nv = m_flow_left->nComponents();
             m_left_points = m_flow_left->nPoints();
             m_left_loc = container().start(m_index-1);
-            m_left_nsp = m_left_nv - c_offset_Y;
+            m_left_nsp = m_flow_left->phase().nSpecies();
             m_phase_left = &m_flow_left->phase();
         } else {
             throw CanteraError("Boundary1D::_init",
@@ -63,7 +63,7 @@ void Boundary1D::_init(size_t n)
             m_flow_right = (StFlow*)&r;
             m_right_nv = m_flow_right->nComponents();
             m_right_loc = container().start(m_index+1);
-            m_right_nsp = m_right_nv - c_offset_Y;
+            m_right_nsp = m_flow_right->phase().nSpecies();
             m_phase_right = &m_flow_right->phase();
         } else {
             throw CanteraError("Boundary1D::_init",
@@ -185,8 +185,9 @@ void Inlet1D::eval(size_t jg, double* xg, double* rg,
 
         // add the convective term to the species residual equations
         for (size_t k = 0; k < m_nsp; k++) {
-            if (k != m_flow_right->leftExcessSpecies()) {
-                rb[c_offset_Y+k] += m_mdot*m_yin[k];
+            size_t n = m_flow_right->speciesComponent(k);
+            if (k != m_flow_right->leftExcessSpecies() && n != npos) {
+                rb[n] += m_mdot*m_yin[k];
             }
         }
 
@@ -200,8 +201,9 @@ void Inlet1D::eval(size_t jg, double* xg, double* rg,
         }
         rb[c_offset_U] += m_mdot; // u
         for (size_t k = 0; k < m_nsp; k++) {
-            if (k != m_flow_left->rightExcessSpecies()) {
-                rb[c_offset_Y+k] += m_mdot * m_yin[k];
+            size_t n = m_flow_left->speciesComponent(k);
+            if (k != m_flow_left->rightExcessSpecies() && n != npos) {
+                rb[n] += m_mdot * m_yin[k];
             }
         }
     }
@@ -385,7 +387,8 @@ void Outlet1D::eval(size_t jg, double* xg, double* rg, integer* diagg,
         if (m_flow_left->doEnergy(m_flow_left->nPoints()-1)) {
             rb[c_offset_T] = xb[c_offset_T] - xb[c_offset_T - nc]; // zero T gradient
         }
-        size_t kSkip = c_offset_Y + m_flow_left->rightExcessSpecies();
+        size_t kSkip = m_flow_left->speciesComponent(
+            m_flow_left->rightExcessSpecies());
         for (size_t k = c_offset_Y; k < nc; k++) {
             if (k != kSkip) {
                 rb[k] = xb[k] - xb[k - nc]; // zero mass fraction gradient
@@ -478,7 +481,7 @@ void OutletRes1D::eval(size_t jg, double* xg, double* rg,
 
         // specified mass fractions
         for (size_t k = c_offset_Y; k < nc; k++) {
-            rb[k] = xb[k] - m_yres[k-c_offset_Y];
+            rb[k] = xb[k] - m_yres[m_flow_right->stateSpecies(k-c_offset_Y)];
         }
     }
 
@@ -496,10 +499,12 @@ void OutletRes1D::eval(size_t jg, double* xg, double* rg,
         if (m_flow_left->doEnergy(m_flow_left->nPoints()-1)) {
             rb[c_offset_T] = xb[c_offset_T] - m_temp; // zero dT/dz
         }
-        size_t kSkip = m_flow_left->rightExcessSpecies();
+        size_t kSkip = m_flow_left->speciesComponent(
+            m_flow_left->rightExcessSpecies());
         for (size_t k = c_offset_Y; k < nc; k++) {
             if (k != kSkip) {
-                rb[k] = xb[k] - m_yres[k-c_offset_Y]; // fixed Y
+                // fixed Y
+                rb[k] = xb[k] - m_yres[m_flow_left->stateSpecies(k-c_offset_Y)];
                 db[k] = 0;
             }
         }
@@ -714,8 +719,9 @@ void ReactingSurf1D::eval(size_t jg, double* xg, double* rg,
             }
         }
         for (size_t nl = 0; nl < m_left_nsp; nl++) {
-            if (nl != nSkip) {
-                rb[c_offset_Y+nl] += m_work[nl + l_offset]*mwleft[nl];
+            size_t n = m_flow_left->speciesComponent(nl);
+            if (nl != nSkip && n != npos) {
+                rb[n] += m_work[nl + l_offset]*mwleft[nl];
             }
         }
     }
@@ -6,6 +6,7 @@
 #include "cantera/oneD/StFlow.h"
 #include "cantera/base/ctml.h"
 #include "cantera/transport/TransportBase.h"
+#include "cantera/kinetics/GasKinetics.h"
 #include "cantera/numerics/funcs.h"
 
 using namespace std;
@@ -57,6 +58,14 @@ StFlow::StFlow(ThermoPhase* ph, size_t nsp, size_t points) :
     // plus the offset of the first mass fraction.
     m_nv = c_offset_Y + m_nsp;
 
+    // all species are part of the solution vector unless quasi-steady-state
+    // species are defined by the kinetics manager
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_stateSpecies.push_back(k);
+        m_stateIndex.push_back(k);
+    }
+    m_ywork.resize(m_nsp, 0.0);
+
     // enable all species equations by default
     m_do_species.resize(m_nsp, true);
 
@@ -138,13 +147,91 @@ void StFlow::setupGrid(size_t n, const doublereal* z)
     }
 }
 
+void StFlow::setKinetics(Kinetics& kin)
+{
+    m_kin = &kin;
+    std::vector<char> isQss(m_nsp, 0);
+    GasKinetics* gasKin = dynamic_cast<GasKinetics*>(&kin);
+    if (gasKin) {
+        for (size_t k : gasKin->quasiSteadySpecies()) {
+            isQss[k] = 1;
+        }
+    }
+    std::vector<size_t> oldIndex = m_stateIndex;
+    m_stateSpecies.clear();
+    m_stateIndex.assign(m_nsp, npos);
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (!isQss[k]) {
+            m_stateIndex[k] = m_stateSpecies.size();
+            m_stateSpecies.push_back(k);
+        }
+    }
+
+    // The species with the largest mass fractions at the boundaries are only
+    // found by updateProperties(), and must be part of the solution vector
+    // before then
+    if (m_stateIndex[m_kExcessLeft] == npos) {
+        m_kExcessLeft = m_stateSpecies[0];
+    }
+    if (m_stateIndex[m_kExcessRight] == npos) {
+        m_kExcessRight = m_stateSpecies[0];
+    }
+    if (m_stateIndex == oldIndex) {
+        return;
+    }
+    if (m_container) {
+        throw CanteraError("StFlow::setKinetics", "The quasi-steady-state "
+            "species cannot be changed after the domain has been added to a "
+            "Sim1D object.");
+    }
+
+    // Move the bounds and tolerances of the species remaining in the solution
+    // vector to their new components
+    auto remap = [&](vector_fp& v, double defaultValue) {
+        vector_fp old = v;
+        v.resize(c_offset_Y);
+        for (size_t k : m_stateSpecies) {
+            v.push_back(oldIndex[k] != npos ? old[c_offset_Y + oldIndex[k]]
+                                            : defaultValue);
+        }
+    };
+    remap(m_min, -1.0e-7);
+    remap(m_max, 1.0e5);
+    remap(m_rtol_ss, 1.0e-4);
+    remap(m_atol_ss, 1.0e-9);
+    remap(m_rtol_ts, 1.0e-4);
+    remap(m_atol_ts, 1.0e-11);
+    m_name.resize(c_offset_Y);
+
+    // The grid refiner is replaced when the number of components changes, so
+    // the refinement settings of the other components are kept
+    std::vector<bool> refine(c_offset_Y);
+    for (size_t n = 0; n < c_offset_Y; n++) {
+        refine[n] = m_refiner->active(n);
+    }
+    resize(c_offset_Y + m_stateSpecies.size(), m_points);
+    for (size_t n = 0; n < c_offset_Y; n++) {
+        m_refiner->setActive(n, refine[n]);
+    }
+}
+
 void StFlow::resetBadValues(double* xg)
 {
     double* x = xg + loc();
     for (size_t j = 0; j < m_points; j++) {
         double* Y = x + m_nv*j + c_offset_Y;
-        m_thermo->setMassFractions(Y);
-        m_thermo->getMassFractions(Y);
+        if (m_stateSpecies.size() == m_nsp) {
+            m_thermo->setMassFractions(Y);
+            m_thermo->getMassFractions(Y);
+        } else {
+            for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+                m_ywork[m_stateSpecies[n]] = Y[n];
+            }
+            m_thermo->setMassFractions(m_ywork.data());
+            for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+                Y[n] = m_thermo->massFraction(m_stateSpecies[n]);
+            }
+        }
     }
 }
 
@@ -164,7 +251,10 @@ void StFlow::_getInitialSoln(double* x)
 {
     for (size_t j = 0; j < m_points; j++) {
         T(x,j) = m_thermo->temperature();
-        m_thermo->getMassFractions(&Y(x, 0, j));
+        for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+            x[index(c_offset_Y + n, j)] =
+                m_thermo->massFraction(m_stateSpecies[n]);
+        }
     }
 }
 
@@ -172,7 +262,14 @@ void StFlow::setGas(const doublereal* x, size_t j)
 {
     m_thermo->setTemperature(T(x,j));
     const doublereal* yy = x + m_nv*j + c_offset_Y;
-    m_thermo->setMassFractions_NoNorm(yy);
+    if (m_stateSpecies.size() == m_nsp) {
+        m_thermo->setMassFractions_NoNorm(yy);
+    } else {
+        for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+            m_ywork[m_stateSpecies[n]] = yy[n];
+        }
+        m_thermo->setMassFractions_NoNorm(m_ywork.data());
+    }
     m_thermo->setPressure(m_press);
 }
 
@@ -181,8 +278,8 @@ void StFlow::setGasAtMidpoint(const doublereal* x, size_t j)
     m_thermo->setTemperature(0.5*(T(x,j)+T(x,j+1)));
     const doublereal* yyj = x + m_nv*j + c_offset_Y;
     const doublereal* yyjp = x + m_nv*(j+1) + c_offset_Y;
-    for (size_t k = 0; k < m_nsp; k++) {
-        m_ybar[k] = 0.5*(yyj[k] + yyjp[k]);
+    for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+        m_ybar[m_stateSpecies[n]] = 0.5*(yyj[n] + yyjp[n]);
     }
     m_thermo->setMassFractions_NoNorm(m_ybar.data());
     m_thermo->setPressure(m_press);
@@ -276,10 +373,13 @@ void StFlow::updateProperties(size_t jg, double* x, size_t jmin, size_t jmax)
         updateTransport(x, j0, j1);
     }
     if (jg == npos) {
+        size_t nY = m_stateSpecies.size();
         double* Yleft = x + index(c_offset_Y, jmin);
-        m_kExcessLeft = distance(Yleft, max_element(Yleft, Yleft + m_nsp));
+        m_kExcessLeft = m_stateSpecies[
+            distance(Yleft, max_element(Yleft, Yleft + nY))];
         double* Yright = x + index(c_offset_Y, jmax);
-        m_kExcessRight = distance(Yright, max_element(Yright, Yright + m_nsp));
+        m_kExcessRight = m_stateSpecies[
+            distance(Yright, max_element(Yright, Yright + nY))];
     }
 
     // update the species diffusive mass fluxes whether or not a
@@ -390,12 +490,13 @@ void StFlow::evalResidual(double* x, double* rsd, int* diag,
             // The default boundary condition for species is zero flux. However,
             // the boundary object may modify this.
             double sum = 0.0;
-            for (size_t k = 0; k < m_nsp; k++) {
+            for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+                size_t k = m_stateSpecies[n];
                 sum += Y(x,k,0);
-                rsd[index(c_offset_Y + k, 0)] =
+                rsd[index(c_offset_Y + n, 0)] =
                     -(m_flux(k,0) + rho_u(x,0)* Y(x,k,0));
             }
-            rsd[index(c_offset_Y + leftExcessSpecies(), 0)] = 1.0 - sum;
+            rsd[index(speciesComponent(leftExcessSpecies()), 0)] = 1.0 - sum;
 
             // set residual of poisson's equ to zero
             rsd[index(c_offset_E, 0)] = x[index(c_offset_E, j)];
@@ -427,15 +528,16 @@ void StFlow::evalResidual(double* x, double* rsd, int* diag,
             //   = M_k\omega_k
             //-------------------------------------------------
             getWdot(x,j);
-            for (size_t k = 0; k < m_nsp; k++) {
+            for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+                size_t k = m_stateSpecies[n];
                 double convec = rho_u(x,j)*dYdz(x,k,j);
                 double diffus = 2.0*(m_flux(k,j) - m_flux(k,j-1))
                                 / (z(j+1) - z(j-1));
-                rsd[index(c_offset_Y + k, j)]
+                rsd[index(c_offset_Y + n, j)]
                 = (m_wt[k]*(wdot(k,j))
                    - convec - diffus)/m_rho[j]
                   - rdt*(Y(x,k,j) - Y_prev(k,j));
-                diag[index(c_offset_Y + k, j)] = 1;
+                diag[index(c_offset_Y + n, j)] = 1;
             }
 
             //-----------------------------------------------
@@ -584,8 +686,8 @@ string StFlow::componentName(size_t n) const
     case 4:
         return "eField";
     default:
-        if (n >= c_offset_Y && n < (c_offset_Y + m_nsp)) {
-            return m_thermo->speciesName(n - c_offset_Y);
+        if (n >= c_offset_Y && n < (c_offset_Y + m_stateSpecies.size())) {
+            return m_thermo->speciesName(m_stateSpecies[n - c_offset_Y]);
         } else {
             return "<unknown>";
         }
@@ -615,10 +717,9 @@ size_t StFlow::componentIndex(const std::string& name) const
     } else if (name == "eField") {
         return 4;
     } else {
-        for (size_t n=c_offset_Y; n<m_nsp+c_offset_Y; n++) {
-            if (componentName(n)==name) {
-                return n;
-            }
+        size_t k = m_thermo->speciesIndex(name);
+        if (k != npos && m_stateIndex[k] != npos) {
+            return c_offset_Y + m_stateIndex[k];
         }
         throw CanteraError("StFlow1D::componentIndex",
                            "no component named " + name);
@@ -716,11 +817,11 @@ void StFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
             }
         } else if (m_thermo->speciesIndex(nm) != npos) {
             debuglog(nm+"   ", loglevel >= 2);
-            if (x.size() == np) {
-                size_t k = m_thermo->speciesIndex(nm);
+            size_t k = m_thermo->speciesIndex(nm);
+            if (x.size() == np && m_stateIndex[k] != npos) {
                 did_species[k] = 1;
                 for (size_t j = 0; j < np; j++) {
-                    soln[index(k+c_offset_Y,j)] = x[j];
+                    soln[index(speciesComponent(k), j)] = x[j];
                 }
             }
         } else {
@@ -739,7 +840,7 @@ void StFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
 
     if (loglevel >= 1) {
         for (size_t ks = 0; ks < nsp; ks++) {
-            if (did_species[ks] == 0) {
+            if (did_species[ks] == 0 && m_stateIndex[ks] != npos) {
                 if (!wrote_header) {
                     writelog("Missing data for species:\n");
                     wrote_header = true;
@@ -820,9 +921,9 @@ XML_Node& StFlow::save(XML_Node& o, const doublereal* const sol)
     soln.getRow(c_offset_L, x.data());
     addFloatArray(gv,"L",x.size(),x.data(),"N/m^4");
 
-    for (size_t k = 0; k < m_nsp; k++) {
-        soln.getRow(c_offset_Y+k, x.data());
-        addFloatArray(gv,m_thermo->speciesName(k),
+    for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+        soln.getRow(c_offset_Y + n, x.data());
+        addFloatArray(gv,m_thermo->speciesName(m_stateSpecies[n]),
                       x.size(),x.data(),"","massFraction");
     }
     if (m_do_radiation) {
@@ -928,12 +1029,13 @@ void StFlow::evalRightBoundary(double* x, double* rsd, int* diag, double rdt)
     doublereal sum = 0.0;
     rsd[index(c_offset_L, j)] = lambda(x,j) - lambda(x,j-1);
     diag[index(c_offset_L, j)] = 0;
-    for (size_t k = 0; k < m_nsp; k++) {
+    for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+        size_t k = m_stateSpecies[n];
         sum += Y(x,k,j);
-        rsd[index(k+c_offset_Y,j)] = m_flux(k,j-1) + rho_u(x,j)*Y(x,k,j);
+        rsd[index(c_offset_Y + n, j)] = m_flux(k,j-1) + rho_u(x,j)*Y(x,k,j);
     }
-    rsd[index(c_offset_Y + rightExcessSpecies(), j)] = 1.0 - sum;
-    diag[index(c_offset_Y + rightExcessSpecies(), j)] = 0;
+    rsd[index(speciesComponent(rightExcessSpecies()), j)] = 1.0 - sum;
+    diag[index(speciesComponent(rightExcessSpecies()), j)] = 0;
     if (domainType() == cAxisymmetricStagnationFlow) {
         rsd[index(c_offset_U,j)] = rho_u(x,j);
         if (m_do_energy[j]) {
@@ -223,6 +223,64 @@ void IdealGasPhase::getCp_R_ref(doublereal* cprt) const
     copy(_cpr.begin(), _cpr.end(), cprt);
 }
 
+void IdealGasPhase::getReferenceProperties(size_t nT, const double* T,
+                                           double* cp_R, double* h_RT,
+                                           double* s_R, double* g_RT)
+{
+    m_spthermo.update(nT, T, cp_R, h_RT, s_R);
+    for (size_t i = 0; i < nT * m_kk; i++) {
+        g_RT[i] = h_RT[i] - s_R[i];
+    }
+}
+
+std::vector<size_t> IdealGasPhase::getTemperatures_HPorUV(
+    size_t n, const double* h, const double* p, const double* Y, double* T,
+    double rtol, bool doUV)
+{
+    if (!m_spthermo.allNasaPoly()) {
+        return ThermoPhase::getTemperatures_HPorUV(n, h, p, Y, T, rtol, doUV);
+    }
+    // With the species weighted by Y_k / M_k, the target for the enthalpy is
+    // h / R, and the internal energy includes the term -T * sum(Y_k / M_k).
+    // The states are processed in chunks to limit the size of the weights.
+    const size_t chunkSize = 256;
+    vector_fp w(chunkSize * m_kk), c(chunkSize), H(chunkSize), T0(chunkSize);
+    const vector_fp& mw = molecularWeights();
+    std::vector<size_t> failed;
+    for (size_t j0 = 0; j0 < n; j0 += chunkSize) {
+        size_t nc = std::min(chunkSize, n - j0);
+        for (size_t j = 0; j < nc; j++) {
+            const double* Yj = Y + (j0 + j) * m_kk;
+            double* wj = &w[j * m_kk];
+            double sum = 0.0;
+            for (size_t k = 0; k < m_kk; k++) {
+                wj[k] = Yj[k] / mw[k];
+                sum += wj[k];
+            }
+            c[j] = doUV ? sum : 0.0;
+            H[j] = h[j0 + j] / GasConstant;
+            T0[j] = T[j0 + j];
+        }
+        std::vector<size_t> chunkFailed = m_spthermo.solveNasaTemperatures(
+            nc, w.data(), c.data(), H.data(), T + j0, rtol);
+        size_t i = 0;
+        for (size_t j = 0; j < nc; j++) {
+            // Invalid pressures or specific volumes are rejected as they are
+            // by setState_HP and setState_UV
+            bool ok = (p[j0 + j] >= 1.0E-300);
+            if (i < chunkFailed.size() && chunkFailed[i] == j) {
+                ok = false;
+                i++;
+            }
+            if (!ok) {
+                T[j0 + j] = T0[j];
+                failed.push_back(j0 + j);
+            }
+        }
+    }
+    return failed;
+}
+
 void IdealGasPhase::getStandardVolumes_ref(doublereal* vol) const
 {
     doublereal tmp = RT() / m_p0;
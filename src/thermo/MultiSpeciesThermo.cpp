@@ -19,7 +19,11 @@ namespace Cantera
 MultiSpeciesThermo::MultiSpeciesThermo() :
     m_tlow_max(0.0),
     m_thigh_min(1.0E30),
-    m_p0(OneAtm)
+    m_p0(OneAtm),
+    m_nasa_low(7),
+    m_nasa_high(7),
+    m_nasa_start(npos),
+    m_nasa_groups_ok(false)
 {
 }
 
@@ -39,6 +43,9 @@ void MultiSpeciesThermo::install_STIT(size_t index,
     if (m_sp[type].size() == 1) {
         m_tpoly[type].resize(stit_ptr->temperaturePolySize());
     }
+    if (type == NASA2) {
+        packNasaPoly(m_sp[type].size() - 1);
+    }
 
     // Calculate max and min T
     m_tlow_max = std::max(stit_ptr->minTemp(), m_tlow_max);
@@ -76,6 +83,9 @@ void MultiSpeciesThermo::modifySpecies(size_t index,
     }
 
     m_sp[type][m_speciesLoc[index].second] = {index, spthermo};
+    if (type == NASA2) {
+        packNasaPoly(m_speciesLoc[index].second);
+    }
 }
 
 void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
@@ -90,15 +100,34 @@ void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
 void MultiSpeciesThermo::update(doublereal t, doublereal* cp_R,
                                   doublereal* h_RT, doublereal* s_R) const
 {
+    update(1, &t, cp_R, h_RT, s_R);
+}
+
+void MultiSpeciesThermo::update(size_t nT, const double* T, double* cp_R,
+                                double* h_RT, double* s_R) const
+{
+    size_t nsp = m_installed.size();
     auto iter = m_sp.begin();
     auto jter = m_tpoly.begin();
     for (; iter != m_sp.end(); iter++, jter++) {
+        if (iter->first == NASA2) {
+            for (size_t i = 0; i < nT; i++) {
+                size_t offset = i * nsp;
+                updateNasaPoly(T[i], cp_R + offset, h_RT + offset,
+                               s_R + offset);
+            }
+            continue;
+        }
         const std::vector<index_STIT>& species = iter->second;
         double* tpoly = &jter->second[0];
-        species[0].second->updateTemperaturePoly(t, tpoly);
-        for (size_t k = 0; k < species.size(); k++) {
-            size_t i = species[k].first;
-            species[k].second->updateProperties(tpoly, cp_R+i, h_RT+i, s_R+i);
+        for (size_t i = 0; i < nT; i++) {
+            size_t offset = i * nsp;
+            species[0].second->updateTemperaturePoly(T[i], tpoly);
+            for (size_t k = 0; k < species.size(); k++) {
+                size_t j = offset + species[k].first;
+                species[k].second->updateProperties(tpoly, cp_R+j, h_RT+j,
+                                                    s_R+j);
+            }
         }
     }
 }
@@ -179,6 +208,36 @@ const SpeciesThermoInterpType* MultiSpeciesThermo::provideSTIT(size_t k) const
     }
 }
 
+size_t MultiSpeciesThermo::memoryUsage() const
+{
+    size_t usage = mapMemoryUsage(m_speciesLoc) + mapMemoryUsage(m_sp)
+        + mapMemoryUsage(m_tpoly) + m_installed.capacity() / 8
+        + vectorMemoryUsage(m_nasa_tmid) + vectorMemoryUsage(m_nasa_low)
+        + vectorMemoryUsage(m_nasa_high) + vectorMemoryUsage(m_nasa_group_tmid)
+        + vectorMemoryUsage(m_nasa_group) + vectorMemoryUsage(m_nasa_hcoeffs);
+    for (const auto& item : m_sp) {
+        usage += vectorMemoryUsage(item.second);
+        for (const auto& stit : item.second) {
+            size_t nCoeffs = 0;
+            try {
+                nCoeffs = stit.second->nCoeffs();
+            } catch (NotImplementedError&) {
+            }
+            usage += sizeof(SpeciesThermoInterpType) + nCoeffs * sizeof(double);
+        }
+    }
+    for (const auto& item : m_tpoly) {
+        usage += vectorMemoryUsage(item.second);
+    }
+    for (const auto& coeffs : m_nasa_low) {
+        usage += vectorMemoryUsage(coeffs);
+    }
+    for (const auto& coeffs : m_nasa_high) {
+        usage += vectorMemoryUsage(coeffs);
+    }
+    return usage;
+}
+
 doublereal MultiSpeciesThermo::reportOneHf298(const size_t k) const
 {
     const SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
@@ -194,6 +253,9 @@ void MultiSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298Ne
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->modifyOneHf298(k, Hf298New);
+        if (sp_ptr->reportType() == NASA2) {
+            packNasaPoly(m_speciesLoc[k].second);
+        }
     }
 }
 
@@ -202,6 +264,9 @@ void MultiSpeciesThermo::resetHf298(const size_t k)
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->resetHf298();
+        if (sp_ptr->reportType() == NASA2) {
+            packNasaPoly(m_speciesLoc[k].second);
+        }
     }
 }
 
@@ -217,6 +282,260 @@ bool MultiSpeciesThermo::ready(size_t nSpecies) {
     return true;
 }
 
+void MultiSpeciesThermo::packNasaPoly(size_t n)
+{
+    const index_STIT& item = m_sp.at(NASA2)[n];
+    size_t index;
+    int type;
+    double tlow, thigh, pref;
+    double c[15];
+    item.second->reportParameters(index, type, tlow, thigh, pref, c);
+    m_nasa_groups_ok = false;
+    if (n == m_nasa_tmid.size()) {
+        m_nasa_tmid.push_back(c[0]);
+        for (size_t j = 0; j < 7; j++) {
+            m_nasa_low[j].push_back(c[8+j]);
+            m_nasa_high[j].push_back(c[1+j]);
+        }
+        if (n == 0) {
+            m_nasa_start = item.first;
+        } else if (m_nasa_start != npos && item.first != m_nasa_start + n) {
+            m_nasa_start = npos;
+        }
+    } else {
+        m_nasa_tmid[n] = c[0];
+        for (size_t j = 0; j < 7; j++) {
+            m_nasa_low[j][n] = c[8+j];
+            m_nasa_high[j][n] = c[1+j];
+        }
+    }
+}
+
+void MultiSpeciesThermo::updateNasaPoly(double T, double* cp_R, double* h_RT,
+                                        double* s_R) const
+{
+    double T2 = T * T;
+    double T3 = T2 * T;
+    double T4 = T3 * T;
+    double rT = 1.0 / T;
+    double logT = std::log(T);
+    const std::vector<index_STIT>& species = m_sp.at(NASA2);
+    size_t nsp = m_nasa_tmid.size();
+
+    // The species are processed in blocks, with the properties stored in
+    // local arrays which the compiler knows not to overlap with the
+    // coefficient arrays, so that the inner loop can be vectorized.
+    const size_t blockSize = 32;
+    double cp[blockSize], h[blockSize], s[blockSize];
+    for (size_t n0 = 0; n0 < nsp; n0 += blockSize) {
+        size_t nb = std::min(blockSize, nsp - n0);
+        const double* tmid = &m_nasa_tmid[n0];
+        const double* lo0 = &m_nasa_low[0][n0];
+        const double* lo1 = &m_nasa_low[1][n0];
+        const double* lo2 = &m_nasa_low[2][n0];
+        const double* lo3 = &m_nasa_low[3][n0];
+        const double* lo4 = &m_nasa_low[4][n0];
+        const double* lo5 = &m_nasa_low[5][n0];
+        const double* lo6 = &m_nasa_low[6][n0];
+        const double* hi0 = &m_nasa_high[0][n0];
+        const double* hi1 = &m_nasa_high[1][n0];
+        const double* hi2 = &m_nasa_high[2][n0];
+        const double* hi3 = &m_nasa_high[3][n0];
+        const double* hi4 = &m_nasa_high[4][n0];
+        const double* hi5 = &m_nasa_high[5][n0];
+        const double* hi6 = &m_nasa_high[6][n0];
+        for (size_t n = 0; n < nb; n++) {
+            // Select the coefficients for the temperature region using
+            // weights of exactly one and zero instead of a branch, which
+            // gives the same results as NasaPoly2::updateProperties
+            double wl = (T <= tmid[n]) ? 1.0 : 0.0;
+            double wh = 1.0 - wl;
+            double ct0 = wl * lo0[n] + wh * hi0[n];
+            double ct1 = (wl * lo1[n] + wh * hi1[n]) * T;
+            double ct2 = (wl * lo2[n] + wh * hi2[n]) * T2;
+            double ct3 = (wl * lo3[n] + wh * hi3[n]) * T3;
+            double ct4 = (wl * lo4[n] + wh * hi4[n]) * T4;
+            double a5 = wl * lo5[n] + wh * hi5[n];
+            double a6 = wl * lo6[n] + wh * hi6[n];
+            cp[n] = ct0 + ct1 + ct2 + ct3 + ct4;
+            h[n] = ct0 + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4 + a5*rT;
+            s[n] = ct0*logT + ct1 + 0.5*ct2 + 1.0/3.0*ct3 + 0.25*ct4 + a6;
+        }
+        if (m_nasa_start != npos) {
+            size_t k = m_nasa_start + n0;
+            std::copy(cp, cp + nb, cp_R + k);
+            std::copy(h, h + nb, h_RT + k);
+            std::copy(s, s + nb, s_R + k);
+        } else {
+            for (size_t n = 0; n < nb; n++) {
+                size_t k = species[n0 + n].first;
+                cp_R[k] = cp[n];
+                h_RT[k] = h[n];
+                s_R[k] = s[n];
+            }
+        }
+    }
+}
+
+std::vector<size_t> MultiSpeciesThermo::solveNasaTemperatures(
+    size_t n, const double* w, const double* c, const double* H, double* T,
+    double rtol) const
+{
+    if (!allNasaPoly()) {
+        throw CanteraError("MultiSpeciesThermo::solveNasaTemperatures",
+            "Only implemented when all species use NasaPoly2 "
+            "parameterizations.");
+    }
+    if (!m_nasa_groups_ok) {
+        updateNasaGroups();
+    }
+    size_t nsp = m_nasa_tmid.size();
+    const vector_fp& tmid = m_nasa_group_tmid;
+    const std::vector<size_t>& group = m_nasa_group;
+    const vector_fp& a = m_nasa_hcoeffs;
+    size_t ng = tmid.size();
+
+    double Tmin = minTemp() - 0.1;
+    double Tmax = maxTemp() + 0.1;
+    const int maxIter = 100;
+    const size_t blockSize = 32;
+    // Coefficients of the combined polynomials of the mixtures in a block.
+    // Coefficient `i` of the polynomial for group `g` and mixture `j` is at
+    // `P[(12 * g + i) * blockSize + j]`, with `i` from 0 to 5 for the low
+    // temperature region and 6 to 11 for the high temperature region.
+    vector_fp P(12 * ng * blockSize);
+    double Tb[blockSize], Hb[blockSize], cpb[blockSize];
+    int status[blockSize]; // 0: iterating, 1: converged, -1: failed
+    std::vector<size_t> failed;
+    for (size_t j0 = 0; j0 < n; j0 += blockSize) {
+        size_t nb = std::min(blockSize, n - j0);
+        std::fill(P.begin(), P.end(), 0.0);
+        for (size_t j = 0; j < nb; j++) {
+            const double* wj = w + (j0 + j) * nsp;
+            for (size_t k = 0; k < nsp; k++) {
+                double* Pk = &P[12 * group[k] * blockSize + j];
+                const double* ak = &a[12 * k];
+                for (size_t i = 0; i < 12; i++) {
+                    Pk[i * blockSize] += wj[k] * ak[i];
+                }
+            }
+            P[blockSize + j] -= c[j0 + j];
+            P[7 * blockSize + j] -= c[j0 + j];
+            // Make sure we are within the temperature bounds at the start of
+            // the iteration
+            Tb[j] = T[j0 + j];
+            if (Tb[j] > Tmax) {
+                Tb[j] = Tmax - 1.0;
+            } else if (Tb[j] < Tmin) {
+                Tb[j] = Tmin + 1.0;
+            }
+            status[j] = 0;
+        }
+
+        size_t nActive = nb;
+        for (int iter = 0; iter < maxIter && nActive; iter++) {
+            std::fill(Hb, Hb + nb, 0.0);
+            std::fill(cpb, cpb + nb, 0.0);
+            for (size_t g = 0; g < ng; g++) {
+                const double* lo0 = &P[12 * g * blockSize];
+                const double* lo1 = lo0 + blockSize;
+                const double* lo2 = lo1 + blockSize;
+                const double* lo3 = lo2 + blockSize;
+                const double* lo4 = lo3 + blockSize;
+                const double* lo5 = lo4 + blockSize;
+                const double* hi0 = lo5 + blockSize;
+                const double* hi1 = hi0 + blockSize;
+                const double* hi2 = hi1 + blockSize;
+                const double* hi3 = hi2 + blockSize;
+                const double* hi4 = hi3 + blockSize;
+                const double* hi5 = hi4 + blockSize;
+                double Tm = tmid[g];
+                for (size_t j = 0; j < nb; j++) {
+                    double t = Tb[j];
+                    double wl = (t <= Tm) ? 1.0 : 0.0;
+                    double wh = 1.0 - wl;
+                    double p0 = wl * lo0[j] + wh * hi0[j];
+                    double p1 = wl * lo1[j] + wh * hi1[j];
+                    double p2 = wl * lo2[j] + wh * hi2[j];
+                    double p3 = wl * lo3[j] + wh * hi3[j];
+                    double p4 = wl * lo4[j] + wh * hi4[j];
+                    double p5 = wl * lo5[j] + wh * hi5[j];
+                    Hb[j] += p0 + t*(p1 + t*(p2 + t*(p3 + t*(p4 + t*p5))));
+                    cpb[j] += p1 + t*(2*p2 + t*(3*p3 + t*(4*p4 + t*5*p5)));
+                }
+            }
+            for (size_t j = 0; j < nb; j++) {
+                if (status[j] != 0) {
+                    continue;
+                }
+                double Told = Tb[j];
+                double Herr = H[j0 + j] - Hb[j];
+                if (!(cpb[j] > 0.0) || !std::isfinite(Herr)) {
+                    status[j] = -1;
+                    nActive--;
+                    continue;
+                }
+                double dT = clip(Herr / cpb[j], -100.0, 100.0);
+                double Tnew = clip(Told + dT, Tmin, Tmax);
+                if (Tnew == Told && Tnew != Told + dT) {
+                    // The solution is outside the temperature range
+                    status[j] = -1;
+                    nActive--;
+                    continue;
+                }
+                Tb[j] = Tnew;
+                double denom = std::max(std::abs(H[j0 + j]), cpb[j] * Told);
+                if (std::abs(Herr) < rtol * denom
+                    || std::abs(Tnew - Told) < rtol * Told) {
+                    status[j] = 1;
+                    nActive--;
+                }
+            }
+        }
+        for (size_t j = 0; j < nb; j++) {
+            if (status[j] == 1) {
+                T[j0 + j] = Tb[j];
+            } else {
+                failed.push_back(j0 + j);
+            }
+        }
+    }
+    return failed;
+}
+
+void MultiSpeciesThermo::updateNasaGroups() const
+{
+    size_t nsp = m_nasa_tmid.size();
+
+    // Species with the same midpoint temperature form a group, for which
+    // the enthalpy polynomials are combined
+    m_nasa_group_tmid = m_nasa_tmid;
+    std::sort(m_nasa_group_tmid.begin(), m_nasa_group_tmid.end());
+    m_nasa_group_tmid.erase(std::unique(m_nasa_group_tmid.begin(),
+                                        m_nasa_group_tmid.end()),
+                            m_nasa_group_tmid.end());
+    m_nasa_group.resize(nsp);
+    m_nasa_hcoeffs.resize(12 * nsp);
+    for (size_t k = 0; k < nsp; k++) {
+        m_nasa_group[k] = std::lower_bound(m_nasa_group_tmid.begin(),
+                                           m_nasa_group_tmid.end(),
+                                           m_nasa_tmid[k])
+                          - m_nasa_group_tmid.begin();
+        const std::vector<vector_fp>* coeffs[] = {&m_nasa_low, &m_nasa_high};
+        for (size_t r = 0; r < 2; r++) {
+            const std::vector<vector_fp>& cr = *coeffs[r];
+            double* ak = &m_nasa_hcoeffs[12 * k + 6 * r];
+            ak[0] = cr[5][k];
+            ak[1] = cr[0][k];
+            ak[2] = cr[1][k] / 2;
+            ak[3] = cr[2][k] / 3;
+            ak[4] = cr[3][k] / 4;
+            ak[5] = cr[4][k] / 5;
+        }
+    }
+    m_nasa_groups_ok = true;
+}
+
 void MultiSpeciesThermo::markInstalled(size_t k) {
     if (k >= m_installed.size()) {
         m_installed.resize(k+1, false);
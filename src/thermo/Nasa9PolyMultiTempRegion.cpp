@@ -23,12 +23,10 @@ namespace Cantera
 {
 
 Nasa9PolyMultiTempRegion::Nasa9PolyMultiTempRegion()
-    : m_currRegion(0)
 {
 }
 
-Nasa9PolyMultiTempRegion::Nasa9PolyMultiTempRegion(vector<Nasa9Poly1*>& regionPts) :
-    m_currRegion(0)
+Nasa9PolyMultiTempRegion::Nasa9PolyMultiTempRegion(vector<Nasa9Poly1*>& regionPts)
 {
     // From now on, we own these pointers
     for (Nasa9Poly1* region : regionPts) {
@@ -128,31 +126,28 @@ void Nasa9PolyMultiTempRegion::updateProperties(const doublereal* tt,
         doublereal* h_RT,
         doublereal* s_R) const
 {
-    m_currRegion = 0;
-    for (size_t i = 1; i < m_regionPts.size(); i++) {
-        if (tt[0] < m_lowerTempBounds[i]) {
-            break;
-        }
-        m_currRegion++;
-    }
-
-    m_regionPts[m_currRegion]->updateProperties(tt, cp_R, h_RT, s_R);
+    m_regionPts[region(tt[0])]->updateProperties(tt, cp_R, h_RT, s_R);
 }
 
 void Nasa9PolyMultiTempRegion::updatePropertiesTemp(const doublereal temp,
         doublereal* cp_R, doublereal* h_RT,
         doublereal* s_R) const
 {
-    // Now find the region
-    m_currRegion = 0;
+    m_regionPts[region(temp)]->updatePropertiesTemp(temp, cp_R, h_RT, s_R);
+}
+
+size_t Nasa9PolyMultiTempRegion::region(double T) const
+{
+    // The index is not stored in the object, which may be shared between
+    // phases used by different threads
+    size_t n = 0;
     for (size_t i = 1; i < m_regionPts.size(); i++) {
-        if (temp < m_lowerTempBounds[i]) {
+        if (T < m_lowerTempBounds[i]) {
             break;
         }
-        m_currRegion++;
+        n++;
     }
-
-    m_regionPts[m_currRegion]->updatePropertiesTemp(temp, cp_R, h_RT, s_R);
+    return n;
 }
 
 size_t Nasa9PolyMultiTempRegion::nCoeffs() const
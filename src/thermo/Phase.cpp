@@ -22,12 +22,17 @@ Phase::Phase() :
     m_ndim(3),
     m_undefinedElementBehavior(UndefElement::add),
     m_caseSensitiveSpecies(false),
+    m_compact(false),
     m_xml(new XML_Node("phase")),
     m_id("<phase>"),
     m_temp(0.001),
     m_dens(0.001),
     m_mmw(0.0),
     m_stateNum(-1),
+    m_stateOffsetT(npos),
+    m_stateOffsetDP(npos),
+    m_stateOffsetComp(npos),
+    m_stateMoleFractions(false),
     m_mm(0),
     m_elem_type(0)
 {
@@ -320,19 +325,22 @@ void Phase::saveState(vector_fp& state) const
 
 void Phase::saveState(size_t lenstate, doublereal* state) const
 {
-    auto native = nativeState();
+    if (m_stateOffsetT == npos) {
+        initStateOffsets();
+    }
 
-    // function assumes default definition of nativeState
-    state[native.at("T")] = temperature();
+    state[m_stateOffsetT] = temperature();
     if (isCompressible()) {
-        state[native.at("D")] = density();
+        state[m_stateOffsetDP] = density();
     } else {
-        state[native.at("P")] = pressure();
+        state[m_stateOffsetDP] = pressure();
     }
-    if (native.count("X")) {
-        getMoleFractions(state + native["X"]);
-    } else if (native.count("Y")) {
-        getMassFractions(state + native["Y"]);
+    if (m_stateOffsetComp != npos) {
+        if (m_stateMoleFractions) {
+            getMoleFractions(state + m_stateOffsetComp);
+        } else {
+            getMassFractions(state + m_stateOffsetComp);
+        }
     }
 }
 
@@ -348,21 +356,80 @@ void Phase::restoreState(size_t lenstate, const double* state)
         throw ArraySizeError("Phase::restoreState",
                              lenstate, ls);
     }
+    if (m_stateOffsetT == npos) {
+        initStateOffsets();
+    }
 
-    auto native = nativeState();
-    setTemperature(state[native.at("T")]);
+    // If the saved state is identical to the current state, leave the phase
+    // untouched so that properties cached for the current state remain valid
+    if (stateMatches(state)) {
+        return;
+    }
+
+    setTemperature(state[m_stateOffsetT]);
     if (isCompressible()) {
-        setDensity(state[native.at("D")]);
+        setDensity(state[m_stateOffsetDP]);
+    } else {
+        setPressure(state[m_stateOffsetDP]);
+    }
+
+    // Setting the composition calls compositionChanged()
+    if (m_stateOffsetComp == npos) {
+        compositionChanged();
+    } else if (m_stateMoleFractions) {
+        setMoleFractions_NoNorm(state + m_stateOffsetComp);
     } else {
-        setPressure(state[native.at("P")]);
+        setMassFractions_NoNorm(state + m_stateOffsetComp);
     }
+}
 
+void Phase::initStateOffsets() const
+{
+    // offsets are determined from the names used by the default definition
+    // of nativeState()
+    auto native = nativeState();
+    m_stateOffsetDP = native.at(isCompressible() ? "D" : "P");
+    m_stateOffsetComp = npos;
+    m_stateMoleFractions = false;
     if (native.count("X")) {
-        setMoleFractions_NoNorm(state + native["X"]);
+        m_stateOffsetComp = native["X"];
+        m_stateMoleFractions = true;
     } else if (native.count("Y")) {
-        setMassFractions_NoNorm(state + native["Y"]);
+        m_stateOffsetComp = native["Y"];
     }
-    compositionChanged();
+    m_stateOffsetT = native.at("T");
+}
+
+bool Phase::stateMatches(const double* state) const
+{
+    if (state[m_stateOffsetT] != m_temp) {
+        return false;
+    }
+    if (isCompressible()) {
+        if (state[m_stateOffsetDP] != m_dens) {
+            return false;
+        }
+    } else if (state[m_stateOffsetDP] != pressure()) {
+        return false;
+    }
+    if (m_stateOffsetComp == npos) {
+        return true;
+    }
+    const double* comp = state + m_stateOffsetComp;
+    if (m_stateMoleFractions) {
+        for (size_t k = 0; k < m_kk; k++) {
+            if (comp[k] != m_ym[k] * m_mmw) {
+                return false;
+            }
+        }
+    } else {
+        for (size_t k = 0; k < m_kk; k++) {
+            if (comp[k] != m_y[k]) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
 void Phase::setMoleFractions(const double* const x)
@@ -831,6 +898,10 @@ size_t Phase::addElement(const std::string& symbol, doublereal weight,
 }
 
 bool Phase::addSpecies(shared_ptr<Species> spec) {
+    if (m_compact) {
+        throw CanteraError("Phase::addSpecies", "Species cannot be added "
+            "to phase '{}' after calling compact().", m_name);
+    }
     if (m_species.find(spec->name) != m_species.end()) {
         throw CanteraError("Phase::addSpecies",
             "Phase '{}' already contains a species named '{}'.",
@@ -928,6 +999,10 @@ bool Phase::addSpecies(shared_ptr<Species> spec) {
 
 void Phase::modifySpecies(size_t k, shared_ptr<Species> spec)
 {
+    if (m_compact) {
+        throw CanteraError("Phase::modifySpecies", "Species of phase '{}' "
+            "cannot be modified after calling compact().", m_name);
+    }
     if (speciesName(k) != spec->name) {
         throw CanteraError("Phase::modifySpecies",
             "New species name '{}' does not match existing name '{}'",
@@ -961,6 +1036,10 @@ void Phase::addSpeciesAlias(const std::string& name, const std::string& alias)
 
 vector<std::string> Phase::findIsomers(const compositionMap& compMap) const
 {
+    if (m_compact) {
+        throw CanteraError("Phase::findIsomers", "Species objects of phase "
+            "'{}' have been released by compact().", m_name);
+    }
     vector<std::string> isomerNames;
 
     for (const auto& k : m_species) {
@@ -981,7 +1060,7 @@ shared_ptr<Species> Phase::species(const std::string& name) const
 {
     size_t k = speciesIndex(name);
     if (k != npos) {
-        return m_species.at(speciesName(k));
+        return species(k);
     } else {
         throw CanteraError("Phase::species",
                            "Unknown species '{}'", name);
@@ -990,9 +1069,27 @@ shared_ptr<Species> Phase::species(const std::string& name) const
 
 shared_ptr<Species> Phase::species(size_t k) const
 {
+    if (m_compact) {
+        throw CanteraError("Phase::species", "Species objects of phase '{}' "
+            "have been released by compact().", m_name);
+    }
     return m_species.at(m_speciesNames[k]);
 }
 
+void Phase::compact()
+{
+    m_species.clear();
+    m_compact = true;
+}
+
+void Phase::getMemoryUsage(std::map<std::string, size_t>& usage) const
+{
+    size_t& species = usage["species"];
+    for (const auto& sp : m_species) {
+        species += sp.second->memoryUsage();
+    }
+}
+
 void Phase::ignoreUndefinedElements() {
     m_undefinedElementBehavior = UndefElement::ignore;
 }
@@ -6,6 +6,7 @@
 #include "cantera/thermo/SpeciesThermoFactory.h"
 #include "cantera/transport/TransportData.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/utilities.h"
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/ctml.h"
 #include <iostream>
@@ -33,6 +34,12 @@ Species::~Species()
 {
 }
 
+size_t Species::memoryUsage() const
+{
+    return sizeof(Species) + name.capacity() + mapMemoryUsage(composition)
+        + extra.memoryUsage() + input.memoryUsage();
+}
+
 shared_ptr<Species> newSpecies(const XML_Node& species_node)
 {
     std::string name = species_node["name"];
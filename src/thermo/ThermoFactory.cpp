@@ -444,6 +444,40 @@ void addSpecies(ThermoPhase& thermo, const AnyValue& names, const AnyValue& spec
     }
 }
 
+//! Install the PDSS objects for the species of a VPStandardStateTP phase,
+//! using the equation of state definitions of the species.
+static void installPDSS(ThermoPhase& thermo)
+{
+    auto* vpssThermo = dynamic_cast<VPStandardStateTP*>(&thermo);
+    if (vpssThermo) {
+        for (size_t k = 0; k < thermo.nSpecies(); k++) {
+            unique_ptr<PDSS> pdss;
+            if (thermo.species(k)->input.hasKey("equation-of-state")) {
+                // Use the first node which specifies a valid PDSS model
+                auto& eos = thermo.species(k)->input["equation-of-state"];
+                bool found = false;
+                for (auto& node : eos.asVector<AnyMap>()) {
+                    string model = node["model"].asString();
+                    if (PDSSFactory::factory()->exists(model)) {
+                        pdss.reset(newPDSS(model));
+                        pdss->setParameters(node);
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found) {
+                    throw InputFileError("installPDSS", eos,
+                        "Could not find an equation-of-state specification "
+                        "which defines a known PDSS model.");
+                }
+            } else {
+                pdss.reset(newPDSS("ideal-gas"));
+            }
+            vpssThermo->installPDSS(k, std::move(pdss));
+        }
+    }
+}
+
 void setupPhase(ThermoPhase& thermo, AnyMap& phaseNode, const AnyMap& rootNode)
 {
     thermo.setName(phaseNode["name"].asString());
@@ -551,34 +585,7 @@ void setupPhase(ThermoPhase& thermo, AnyMap& phaseNode, const AnyMap& rootNode)
         addSpecies(thermo, AnyValue("all"), rootNode["species"]);
     }
 
-    auto* vpssThermo = dynamic_cast<VPStandardStateTP*>(&thermo);
-    if (vpssThermo) {
-        for (size_t k = 0; k < thermo.nSpecies(); k++) {
-            unique_ptr<PDSS> pdss;
-            if (thermo.species(k)->input.hasKey("equation-of-state")) {
-                // Use the first node which specifies a valid PDSS model
-                auto& eos = thermo.species(k)->input["equation-of-state"];
-                bool found = false;
-                for (auto& node : eos.asVector<AnyMap>()) {
-                    string model = node["model"].asString();
-                    if (PDSSFactory::factory()->exists(model)) {
-                        pdss.reset(newPDSS(model));
-                        pdss->setParameters(node);
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
-                    throw InputFileError("setupPhase", eos,
-                        "Could not find an equation-of-state specification "
-                        "which defines a known PDSS model.");
-                }
-            } else {
-                pdss.reset(newPDSS("ideal-gas"));
-            }
-            vpssThermo->installPDSS(k, std::move(pdss));
-        }
-    }
+    installPDSS(thermo);
 
     thermo.setParameters(phaseNode, rootNode);
     thermo.initThermo();
@@ -591,6 +598,43 @@ void setupPhase(ThermoPhase& thermo, AnyMap& phaseNode, const AnyMap& rootNode)
     }
 }
 
+unique_ptr<ThermoPhase> newPhase(const ThermoPhase& other)
+{
+    const AnyMap& input = other.input();
+    if (other.isCompact() || !input.hasKey("thermo")) {
+        throw CanteraError("newPhase", "Phase '{}' cannot be copied because "
+            "it was not created from YAML input or has been compacted.",
+            other.name());
+    }
+    if (dynamic_cast<const LatticeSolidPhase*>(&other)
+        || dynamic_cast<const IonsFromNeutralVPSSTP*>(&other)) {
+        // These phases are set up from the definitions of other phases in the
+        // input file, which are not kept
+        throw CanteraError("newPhase", "Phase '{}' of type '{}' cannot be "
+            "copied because it is defined in terms of other phases.",
+            other.name(), other.type());
+    }
+    unique_ptr<ThermoPhase> t(newThermoPhase(input.at("thermo").asString()));
+    t->setName(other.name());
+    t->setCaseSensitiveSpecies(other.caseSensitiveSpecies());
+    for (size_t m = 0; m < other.nElements(); m++) {
+        t->addElement(other.elementName(m), other.atomicWeight(m),
+                      other.atomicNumber(m), other.entropyElement298(m),
+                      other.elementType(m));
+    }
+    for (size_t k = 0; k < other.nSpecies(); k++) {
+        t->addSpecies(other.species(k));
+    }
+    installPDSS(*t);
+    t->setParameters(input);
+    t->initThermo();
+
+    vector_fp state;
+    other.saveState(state);
+    t->restoreState(state);
+    return t;
+}
+
 void installElements(Phase& th, const XML_Node& phaseNode)
 {
     // get the declared element names
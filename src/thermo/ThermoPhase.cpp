@@ -51,6 +51,28 @@ void ThermoPhase::resetHf298(size_t k) {
     invalidateCache();
 }
 
+void ThermoPhase::getReferenceProperties(size_t nT, const double* T,
+                                         double* cp_R, double* h_RT,
+                                         double* s_R, double* g_RT)
+{
+    vector_fp state;
+    saveState(state);
+    try {
+        for (size_t i = 0; i < nT; i++) {
+            setTemperature(T[i]);
+            size_t offset = i * m_kk;
+            getCp_R_ref(cp_R + offset);
+            getEnthalpy_RT_ref(h_RT + offset);
+            getEntropy_R_ref(s_R + offset);
+            getGibbs_RT_ref(g_RT + offset);
+        }
+    } catch (CanteraError&) {
+        restoreState(state);
+        throw;
+    }
+    restoreState(state);
+}
+
 int ThermoPhase::activityConvention() const
 {
     return cAC_CONVENTION_MOLAR;
@@ -318,9 +340,6 @@ void ThermoPhase::setState_conditional_TP(doublereal t, doublereal p, bool set_p
 void ThermoPhase::setState_HPorUV(double Htarget, double p,
                                   double rtol, bool doUV)
 {
-    doublereal dt;
-    doublereal v = 0.0;
-
     // Assign the specific volume or pressure and make sure it's positive
     if (doUV) {
         doublereal v = p;
@@ -336,6 +355,13 @@ void ThermoPhase::setState_HPorUV(double Htarget, double p,
         }
         setPressure(p);
     }
+    setTemperature_HorU(Htarget, rtol, doUV);
+}
+
+int ThermoPhase::setTemperature_HorU(double Htarget, double rtol, bool doUV)
+{
+    doublereal dt;
+    double p = doUV ? 0.0 : pressure();
     double Tmax = maxTemp() + 0.1;
     double Tmin = minTemp() - 0.1;
 
@@ -453,7 +479,7 @@ void ThermoPhase::setState_HPorUV(double Htarget, double p,
         }
 
         if (Hnew == Htarget) {
-            return;
+            return n + 1;
         } else if (Hnew > Htarget && (Htop < Htarget || Hnew < Htop)) {
             Htop = Hnew;
             Ttop = Tnew;
@@ -467,7 +493,7 @@ void ThermoPhase::setState_HPorUV(double Htarget, double p,
         double denom = std::max(fabs(Htarget), acpd * Tnew);
         double HConvErr = fabs((Herr)/denom);
         if (HConvErr < rtol || fabs(dt/Tnew) < rtol) {
-            return;
+            return n + 1;
         }
     }
     // We are here when there hasn't been convergence
@@ -483,7 +509,7 @@ void ThermoPhase::setState_HPorUV(double Htarget, double p,
             "\tCurrent Temperature     = {}\n"
             "\tCurrent Internal Energy = {}\n"
             "\tCurrent Delta T         = {}\n",
-            Htarget, v, Tinit, Tnew, Hnew, dt);
+            Htarget, 1.0 / density(), Tinit, Tnew, Hnew, dt);
     } else {
         ErrString += fmt::format(
             "\tTarget Enthalpy         = {}\n"
@@ -500,12 +526,37 @@ void ThermoPhase::setState_HPorUV(double Htarget, double p,
             Tunstable);
     }
     if (doUV) {
-        throw CanteraError("ThermoPhase::setState_HPorUV (UV)", ErrString);
+        throw CanteraError("ThermoPhase::setTemperature_HorU (UV)", ErrString);
     } else {
-        throw CanteraError("ThermoPhase::setState_HPorUV (HP)", ErrString);
+        throw CanteraError("ThermoPhase::setTemperature_HorU (HP)", ErrString);
     }
 }
 
+std::vector<size_t> ThermoPhase::getTemperatures_HPorUV(
+    size_t n, const double* h, const double* p, const double* Y, double* T,
+    double rtol, bool doUV)
+{
+    std::vector<size_t> failed;
+    vector_fp state;
+    saveState(state);
+    for (size_t j = 0; j < n; j++) {
+        try {
+            setMassFractions_NoNorm(Y + j * m_kk);
+            setTemperature(T[j]);
+            if (doUV) {
+                setState_UV(h[j], p[j], rtol);
+            } else {
+                setState_HP(h[j], p[j], rtol);
+            }
+            T[j] = temperature();
+        } catch (CanteraError&) {
+            failed.push_back(j);
+        }
+    }
+    restoreState(state);
+    return failed;
+}
+
 void ThermoPhase::setState_SP(double Starget, double p, double rtol)
 {
     setState_SPorSV(Starget, p, rtol, false);
@@ -1186,6 +1237,19 @@ AnyMap& ThermoPhase::input()
     return m_input;
 }
 
+void ThermoPhase::compact()
+{
+    Phase::compact();
+    m_input.clear();
+}
+
+void ThermoPhase::getMemoryUsage(std::map<std::string, size_t>& usage) const
+{
+    Phase::getMemoryUsage(usage);
+    usage["phase-input"] += m_input.memoryUsage();
+    usage["species-thermo"] += m_spthermo.memoryUsage();
+}
+
 void ThermoPhase::setStateFromXML(const XML_Node& state)
 {
     string comp = getChildValue(state,"moleFractions");
@@ -151,6 +151,28 @@ void VPStandardStateTP::getStandardVolumes_ref(doublereal* vol) const
     std::copy(m_Vss.begin(), m_Vss.end(), vol);
 }
 
+void VPStandardStateTP::getReferenceProperties(size_t nT, const double* T,
+                                               double* cp_R, double* h_RT,
+                                               double* s_R, double* g_RT)
+{
+    // Evaluate the standard state objects directly, without changing the
+    // state of the phase or the cached standard state properties
+    for (size_t i = 0; i < nT; i++) {
+        size_t offset = i * m_kk;
+        for (size_t k = 0; k < m_kk; k++) {
+            PDSS* kPDSS = m_PDSS_storage[k].get();
+            kPDSS->setState_TP(T[i], m_Pcurrent);
+            h_RT[offset + k] = kPDSS->enthalpy_RT_ref();
+            s_R[offset + k] = kPDSS->entropy_R_ref();
+            g_RT[offset + k] = h_RT[offset + k] - s_R[offset + k];
+            cp_R[offset + k] = kPDSS->cp_R_ref();
+        }
+    }
+    for (size_t k = 0; k < m_kk; k++) {
+        m_PDSS_storage[k]->setState_TP(temperature(), m_Pcurrent);
+    }
+}
+
 void VPStandardStateTP::initThermo()
 {
     ThermoPhase::initThermo();
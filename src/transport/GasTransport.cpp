@@ -362,8 +362,47 @@ void GasTransport::setupCollisionParameters()
     }
 }
 
+void GasTransport::useFitsFrom(const GasTransport& other)
+{
+    if (other.transportType() != transportType()) {
+        throw CanteraError("GasTransport::useFitsFrom",
+            "Fits cannot be copied from a transport manager of a different "
+            "type ('{}' instead of '{}').", other.transportType(),
+            transportType());
+    }
+    m_copiedFits.reset(new CopiedFits());
+    m_copiedFits->nsp = other.m_nsp;
+    m_copiedFits->mode = other.m_mode;
+    m_copiedFits->poly = other.m_poly;
+    m_copiedFits->omega22_poly = other.m_omega22_poly;
+    m_copiedFits->astar_poly = other.m_astar_poly;
+    m_copiedFits->bstar_poly = other.m_bstar_poly;
+    m_copiedFits->cstar_poly = other.m_cstar_poly;
+    m_copiedFits->visccoeffs = other.m_visccoeffs;
+    m_copiedFits->condcoeffs = other.m_condcoeffs;
+    m_copiedFits->diffcoeffs = other.m_diffcoeffs;
+}
+
 void GasTransport::setupCollisionIntegral()
 {
+    if (m_copiedFits) {
+        unique_ptr<CopiedFits> fits = std::move(m_copiedFits);
+        if (fits->nsp != m_nsp || fits->mode != m_mode) {
+            throw CanteraError("GasTransport::setupCollisionIntegral",
+                "Fits cannot be copied from a transport manager for a phase "
+                "with different species or in a different mode.");
+        }
+        m_poly = std::move(fits->poly);
+        m_omega22_poly = std::move(fits->omega22_poly);
+        m_astar_poly = std::move(fits->astar_poly);
+        m_bstar_poly = std::move(fits->bstar_poly);
+        m_cstar_poly = std::move(fits->cstar_poly);
+        m_visccoeffs = std::move(fits->visccoeffs);
+        m_condcoeffs = std::move(fits->condcoeffs);
+        m_diffcoeffs = std::move(fits->diffcoeffs);
+        return;
+    }
+
     double tstar_min = 1.e8, tstar_max = 0.0;
     for (size_t i = 0; i < m_nsp; i++) {
         for (size_t j = i; j < m_nsp; j++) {
@@ -64,6 +64,9 @@ TransportFactory::TransportFactory()
     addAlias("water", "Water");
     reg("high-pressure", []() { return new HighPressureGasTransport(); });
     addAlias("high-pressure", "HighP");
+    // aliases for the names returned by Transport::transportType()
+    addAlias("", "Transport");
+    addAlias("high-pressure", "HighPressureGas");
     m_CK_mode["CK_Mix"] = m_CK_mode["mixture-averaged-CK"] = true;
     m_CK_mode["CK_Multi"] = m_CK_mode["multicomponent-CK"] = true;
 }
@@ -114,6 +117,28 @@ Transport* TransportFactory::newTransport(thermo_t* phase, int log_level)
     return newTransport(transportModel, phase,log_level);
 }
 
+Transport* TransportFactory::newTransport(const Transport& other,
+                                          thermo_t* phase)
+{
+    string transportModel = other.transportType();
+    if (transportModel == "DustyGas") {
+        throw CanteraError("TransportFactory::newTransport",
+            "Copying of DustyGas transport managers is not implemented.");
+    }
+    vector_fp state;
+    phase->saveState(state);
+    unique_ptr<Transport> tr(create(transportModel));
+    int mode = m_CK_mode[transportModel] ? CK_Mode : 0;
+    auto gastr = dynamic_cast<GasTransport*>(tr.get());
+    auto source = dynamic_cast<const GasTransport*>(&other);
+    if (gastr && source) {
+        gastr->useFitsFrom(*source);
+    }
+    tr->init(phase, mode);
+    phase->restoreState(state);
+    return tr.release();
+}
+
 Transport* newTransportMgr(const std::string& transportModel, thermo_t* thermo, int loglevel, int ndim)
 {
     TransportFactory* f = TransportFactory::factory();
@@ -125,4 +150,9 @@ Transport* newDefaultTransportMgr(thermo_t* thermo, int loglevel)
     return TransportFactory::factory()->newTransport(thermo, loglevel);
 }
 
+Transport* newTransportMgr(const Transport& other, thermo_t* thermo)
+{
+    return TransportFactory::factory()->newTransport(other, thermo);
+}
+
 }
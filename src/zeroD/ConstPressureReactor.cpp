@@ -28,11 +28,11 @@ void ConstPressureReactor::getState(double* y)
     y[1] = m_thermo->enthalpy_mass() * m_thermo->density() * m_vol;
 
     // set components y+2 ... y+K+1 to the mass fractions Y_k of each species
-    m_thermo->getMassFractions(y+2);
+    getStateMassFractions(y+2);
 
     // set the remaining components to the surface species
     // coverages on the walls
-    getSurfaceInitialConditions(y + m_nsp + 2);
+    getSurfaceInitialConditions(y + nStateSpecies() + 2);
 }
 
 void ConstPressureReactor::initialize(doublereal t0)
@@ -44,17 +44,20 @@ void ConstPressureReactor::initialize(doublereal t0)
 void ConstPressureReactor::updateState(doublereal* y)
 {
     // The components of y are [0] the total mass, [1] the total enthalpy,
-    // [2...K+2) are the mass fractions of each species, and [K+2...] are the
-    // coverages of surface species on each wall.
+    // [2...K+2) are the mass fractions of each species (except for
+    // quasi-steady-state species), and [K+2...] are the coverages of surface
+    // species on each wall.
     m_mass = y[0];
-    m_thermo->setMassFractions_NoNorm(y+2);
+    setStateMassFractions(y+2);
     if (m_energy) {
-        m_thermo->setState_HP(y[1]/m_mass, m_pressure);
+        // Tight tolerance, consistent with Reactor::updateState, so that the
+        // finite difference Jacobian is not affected by the solver tolerance
+        m_thermo->setState_HP(y[1]/m_mass, m_pressure, 1e-14);
     } else {
         m_thermo->setPressure(m_pressure);
     }
     m_vol = m_mass / m_thermo->density();
-    updateSurfaceState(y + m_nsp + 2);
+    updateSurfaceState(y + nStateSpecies() + 2);
     updateConnected(false);
 }
 
@@ -62,13 +65,13 @@ void ConstPressureReactor::evalEqs(doublereal time, doublereal* y,
                                    doublereal* ydot, doublereal* params)
 {
     double dmdt = 0.0; // dm/dt (gas phase)
-    double* dYdt = ydot + 2;
+    double* dYdt = m_dYdt.data();
 
     evalWalls(time);
     applySensitivity(params);
 
     m_thermo->restoreState(m_state);
-    double mdot_surf = evalSurfaces(time, ydot + m_nsp + 2);
+    double mdot_surf = evalSurfaces(time, ydot + nStateSpecies() + 2);
     dmdt += mdot_surf;
 
     const vector_fp& mw = m_thermo->molecularWeights();
@@ -114,6 +117,8 @@ void ConstPressureReactor::evalEqs(doublereal time, doublereal* y,
         ydot[1] = 0.0;
     }
 
+    getStateSpeciesRates(ydot + 2);
+
     // reset sensitivity parameters
     resetSensitivity(params);
 }
@@ -139,10 +144,10 @@ std::string ConstPressureReactor::componentName(size_t k) {
         return "enthalpy";
     } else if (k >= 2 && k < neq()) {
         k -= 2;
-        if (k < m_thermo->nSpecies()) {
-            return m_thermo->speciesName(k);
+        if (k < nStateSpecies()) {
+            return m_thermo->speciesName(stateSpecies(k));
         } else {
-            k -= m_thermo->nSpecies();
+            k -= nStateSpecies();
         }
         for (auto& S : m_surfaces) {
             ThermoPhase* th = S->thermo();
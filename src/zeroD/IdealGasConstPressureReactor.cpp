@@ -38,11 +38,11 @@ void IdealGasConstPressureReactor::getState(double* y)
     y[1] = m_thermo->temperature();
 
     // set components y+2 ... y+K+1 to the mass fractions Y_k of each species
-    m_thermo->getMassFractions(y+2);
+    getStateMassFractions(y+2);
 
     // set the remaining components to the surface species
     // coverages on the walls
-    getSurfaceInitialConditions(y + m_nsp + 2);
+    getSurfaceInitialConditions(y + nStateSpecies() + 2);
 }
 
 void IdealGasConstPressureReactor::initialize(doublereal t0)
@@ -54,13 +54,14 @@ void IdealGasConstPressureReactor::initialize(doublereal t0)
 void IdealGasConstPressureReactor::updateState(doublereal* y)
 {
     // The components of y are [0] the total mass, [1] the temperature,
-    // [2...K+2) are the mass fractions of each species, and [K+2...] are the
-    // coverages of surface species on each wall.
+    // [2...K+2) are the mass fractions of each species (except for
+    // quasi-steady-state species), and [K+2...] are the coverages of surface
+    // species on each wall.
     m_mass = y[0];
-    m_thermo->setMassFractions_NoNorm(y+2);
+    setStateMassFractions(y+2);
     m_thermo->setState_TP(y[1], m_pressure);
     m_vol = m_mass / m_thermo->density();
-    updateSurfaceState(y + m_nsp + 2);
+    updateSurfaceState(y + nStateSpecies() + 2);
     updateConnected(false);
 }
 
@@ -69,13 +70,13 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
 {
     double dmdt = 0.0; // dm/dt (gas phase)
     double mcpdTdt = 0.0; // m * c_p * dT/dt
-    double* dYdt = ydot + 2;
+    double* dYdt = m_dYdt.data();
 
     applySensitivity(params);
     evalWalls(time);
 
     m_thermo->restoreState(m_state);
-    double mdot_surf = evalSurfaces(time, ydot + m_nsp + 2);
+    double mdot_surf = evalSurfaces(time, ydot + nStateSpecies() + 2);
     dmdt += mdot_surf;
 
     m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
@@ -124,6 +125,7 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
         ydot[1] = 0.0;
     }
 
+    getStateSpeciesRates(ydot + 2);
     resetSensitivity(params);
 }
 
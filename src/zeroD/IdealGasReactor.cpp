@@ -42,11 +42,11 @@ void IdealGasReactor::getState(double* y)
     y[2] = m_thermo->temperature();
 
     // set components y+3 ... y+K+2 to the mass fractions of each species
-    m_thermo->getMassFractions(y+3);
+    getStateMassFractions(y+3);
 
     // set the remaining components to the surface species
     // coverages on the walls
-    getSurfaceInitialConditions(y + m_nsp + 3);
+    getSurfaceInitialConditions(y + nStateSpecies() + 3);
 }
 
 void IdealGasReactor::initialize(doublereal t0)
@@ -58,13 +58,14 @@ void IdealGasReactor::initialize(doublereal t0)
 void IdealGasReactor::updateState(doublereal* y)
 {
     // The components of y are [0] the total mass, [1] the total volume,
-    // [2] the temperature, [3...K+3] are the mass fractions of each species,
-    // and [K+3...] are the coverages of surface species on each wall.
+    // [2] the temperature, [3...K+3] are the mass fractions of each species
+    // (except for quasi-steady-state species), and [K+3...] are the coverages
+    // of surface species on each wall.
     m_mass = y[0];
     m_vol = y[1];
-    m_thermo->setMassFractions_NoNorm(y+3);
+    setStateMassFractions(y+3);
     m_thermo->setState_TR(y[2], m_mass / m_vol);
-    updateSurfaceState(y + m_nsp + 3);
+    updateSurfaceState(y + nStateSpecies() + 3);
     updateConnected(true);
 }
 
@@ -73,7 +74,7 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
 {
     double dmdt = 0.0; // dm/dt (gas phase)
     double mcvdTdt = 0.0; // m * c_v * dT/dt
-    double* dYdt = ydot + 3;
+    double* dYdt = m_dYdt.data();
 
     evalWalls(time);
     applySensitivity(params);
@@ -86,7 +87,7 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
         m_kin->getNetProductionRates(&m_wdot[0]); // "omega dot"
     }
 
-    double mdot_surf = evalSurfaces(time, ydot + m_nsp + 3);
+    double mdot_surf = evalSurfaces(time, ydot + nStateSpecies() + 3);
     dmdt += mdot_surf;
 
     // compression work and external heat transfer
@@ -133,6 +134,7 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
         ydot[2] = 0;
     }
 
+    getStateSpeciesRates(ydot + 3);
     resetSensitivity(params);
 }
 
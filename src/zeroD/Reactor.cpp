@@ -9,6 +9,7 @@
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/ReactorSurface.h"
+#include "cantera/kinetics/GasKinetics.h"
 
 #include <boost/math/tools/roots.hpp>
 
@@ -37,6 +38,26 @@ void Reactor::setKineticsMgr(Kinetics& kin)
     }
 }
 
+void Reactor::setAdaptiveChemistry(const std::vector<std::string>& targets,
+                                   double threshold, double rtol, double atol)
+{
+    GasKinetics* kin = dynamic_cast<GasKinetics*>(m_kin);
+    if (!kin) {
+        throw CanteraError("Reactor::setAdaptiveChemistry",
+            "Adaptive chemistry requires a GasKinetics object for reactor "
+            "'{}'.", m_name);
+    }
+    kin->setAdaptiveChemistry(targets, threshold, rtol, atol);
+}
+
+void Reactor::disableAdaptiveChemistry()
+{
+    GasKinetics* kin = dynamic_cast<GasKinetics*>(m_kin);
+    if (kin) {
+        kin->disableAdaptiveChemistry();
+    }
+}
+
 void Reactor::getState(double* y)
 {
     if (m_thermo == 0) {
@@ -56,11 +77,42 @@ void Reactor::getState(double* y)
     y[2] = m_thermo->intEnergy_mass() * m_mass;
 
     // set components y+3 ... y+K+2 to the mass fractions of each species
-    m_thermo->getMassFractions(y+3);
+    getStateMassFractions(y+3);
 
     // set the remaining components to the surface species
     // coverages on the walls
-    getSurfaceInitialConditions(y + m_nsp + 3);
+    getSurfaceInitialConditions(y + nStateSpecies() + 3);
+}
+
+void Reactor::getStateMassFractions(double* y)
+{
+    if (nStateSpecies() == m_nsp) {
+        m_thermo->getMassFractions(y);
+        return;
+    }
+    m_thermo->getMassFractions(m_Ywork.data());
+    for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+        y[n] = m_Ywork[m_stateSpecies[n]];
+    }
+}
+
+void Reactor::setStateMassFractions(const double* y)
+{
+    if (nStateSpecies() == m_nsp) {
+        m_thermo->setMassFractions_NoNorm(y);
+        return;
+    }
+    for (size_t n = 0; n < m_stateSpecies.size(); n++) {
+        m_Ywork[m_stateSpecies[n]] = y[n];
+    }
+    m_thermo->setMassFractions_NoNorm(m_Ywork.data());
+}
+
+void Reactor::getStateSpeciesRates(double* ydot) const
+{
+    for (size_t n = 0; n < nStateSpecies(); n++) {
+        ydot[n] = m_dYdt[stateSpecies(n)];
+    }
 }
 
 void Reactor::getSurfaceInitialConditions(double* y)
@@ -81,14 +133,33 @@ void Reactor::initialize(doublereal t0)
     m_thermo->restoreState(m_state);
     m_sdot.resize(m_nsp, 0.0);
     m_wdot.resize(m_nsp, 0.0);
+    m_dYdt.resize(m_nsp, 0.0);
     updateConnected(true);
 
+    // Quasi-steady-state species are not part of the state vector. Their
+    // mass fractions are held at the values in the phase at this point.
+    std::vector<char> isQss(m_nsp, 0);
+    GasKinetics* gasKin = dynamic_cast<GasKinetics*>(m_kin);
+    if (m_chem && gasKin) {
+        for (size_t k : gasKin->quasiSteadySpecies()) {
+            isQss[k] = 1;
+        }
+    }
+    m_stateSpecies.clear();
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (!isQss[k]) {
+            m_stateSpecies.push_back(k);
+        }
+    }
+    m_Ywork.resize(m_nsp);
+    m_thermo->getMassFractions(m_Ywork.data());
+
     for (size_t n = 0; n < m_wall.size(); n++) {
         WallBase* W = m_wall[n];
         W->initialize();
     }
 
-    m_nv = m_nsp + 3;
+    m_nv = nStateSpecies() + 3;
     size_t maxnt = 0;
     for (auto& S : m_surfaces) {
         m_nv += S->thermo()->nSpecies();
@@ -121,28 +192,31 @@ void Reactor::updateState(doublereal* y)
 {
     // The components of y are [0] the total mass, [1] the total volume,
     // [2] the total internal energy, [3...K+3] are the mass fractions of each
-    // species, and [K+3...] are the coverages of surface species on each wall.
+    // species (except for quasi-steady-state species), and [K+3...] are the
+    // coverages of surface species on each wall.
     m_mass = y[0];
     m_vol = y[1];
-    m_thermo->setMassFractions_NoNorm(y+3);
+    setStateMassFractions(y+3);
 
     if (m_energy) {
         double U = y[2];
-        // Residual function: error in internal energy as a function of T
-        auto u_err = [this, U](double T) {
-            m_thermo->setState_TR(T, m_mass / m_vol);
-            return m_thermo->intEnergy_mass() * m_mass - U;
-        };
-
         double T = m_thermo->temperature();
-        boost::uintmax_t maxiter = 100;
-        std::pair<double, double> TT;
+        m_thermo->setDensity(m_mass / m_vol);
         try {
-            TT = bmt::bracket_and_solve_root(
-                u_err, T, 1.2, true, bmt::eps_tolerance<double>(48), maxiter);
-        } catch (std::exception&) {
-            // Try full-range bisection if bracketing fails (e.g. near
-            // temperature limits for the phase's equation of state)
+            // Newton iteration starting from the temperature of the last
+            // evaluation, which usually converges in a few iterations
+            m_thermo->setTemperature_HorU(U / m_mass, 1e-14, true);
+        } catch (CanteraError&) {
+            // Residual function: error in internal energy as a function of T
+            auto u_err = [this, U](double T) {
+                m_thermo->setState_TR(T, m_mass / m_vol);
+                return m_thermo->intEnergy_mass() * m_mass - U;
+            };
+
+            // Try full-range bisection if the Newton iteration fails (e.g.
+            // near temperature limits for the phase's equation of state)
+            boost::uintmax_t maxiter = 100;
+            std::pair<double, double> TT;
             try {
                 TT = bmt::bisect(u_err, m_thermo->minTemp(), m_thermo->maxTemp(),
                     bmt::eps_tolerance<double>(48), maxiter);
@@ -152,16 +226,16 @@ void Reactor::updateState(doublereal* y)
                 throw CanteraError("Reactor::updateState",
                     "{}\nat U = {}, rho = {}", err2.what(), U, m_mass / m_vol);
             }
+            if (fabs(TT.first - TT.second) > 1e-7*TT.first) {
+                throw CanteraError("Reactor::updateState", "root finding failed");
+            }
+            m_thermo->setState_TR(TT.second, m_mass / m_vol);
         }
-        if (fabs(TT.first - TT.second) > 1e-7*TT.first) {
-            throw CanteraError("Reactor::updateState", "root finding failed");
-        }
-        m_thermo->setState_TR(TT.second, m_mass / m_vol);
     } else {
         m_thermo->setDensity(m_mass/m_vol);
     }
 
-    updateSurfaceState(y + m_nsp + 3);
+    updateSurfaceState(y + nStateSpecies() + 3);
     updateConnected(true);
 }
 
@@ -197,12 +271,12 @@ void Reactor::evalEqs(doublereal time, doublereal* y,
                       doublereal* ydot, doublereal* params)
 {
     double dmdt = 0.0; // dm/dt (gas phase)
-    double* dYdt = ydot + 3;
+    double* dYdt = m_dYdt.data();
 
     evalWalls(time);
     applySensitivity(params);
     m_thermo->restoreState(m_state);
-    double mdot_surf = evalSurfaces(time, ydot + m_nsp + 3);
+    double mdot_surf = evalSurfaces(time, ydot + nStateSpecies() + 3);
     dmdt += mdot_surf; // mass added to gas phase from surface reactions
 
     // volume equation
@@ -256,6 +330,7 @@ void Reactor::evalEqs(doublereal time, doublereal* y,
     }
 
     ydot[0] = dmdt;
+    getStateSpeciesRates(ydot + 3);
     resetSensitivity(params);
 }
 
@@ -339,11 +414,19 @@ size_t Reactor::speciesIndex(const string& nm) const
     // check for a gas species name
     size_t k = m_thermo->speciesIndex(nm);
     if (k != npos) {
+        if (nStateSpecies() != m_nsp) {
+            auto iter = std::lower_bound(m_stateSpecies.begin(),
+                                         m_stateSpecies.end(), k);
+            if (iter == m_stateSpecies.end() || *iter != k) {
+                return npos; // quasi-steady-state species
+            }
+            k = iter - m_stateSpecies.begin();
+        }
         return k;
     }
 
     // check for a wall species
-    size_t offset = m_nsp;
+    size_t offset = nStateSpecies();
     for (auto& S : m_surfaces) {
         ThermoPhase* th = S->thermo();
         k = th->speciesIndex(nm);
@@ -381,10 +464,10 @@ std::string Reactor::componentName(size_t k) {
         return "int_energy";
     } else if (k >= 3 && k < neq()) {
         k -= 3;
-        if (k < m_thermo->nSpecies()) {
-            return m_thermo->speciesName(k);
+        if (k < nStateSpecies()) {
+            return m_thermo->speciesName(stateSpecies(k));
         } else {
-            k -= m_thermo->nSpecies();
+            k -= nStateSpecies();
         }
         for (auto& S : m_surfaces) {
             ThermoPhase* th = S->thermo();
@@ -469,8 +552,6 @@ bool Reactor::getAdvanceLimits(double *limits)
 
 void Reactor::setAdvanceLimit(const string& nm, const double limit)
 {
-    size_t k = componentIndex(nm);
-
     if (m_thermo == 0) {
         throw CanteraError("Reactor::setAdvanceLimit",
                            "Error: reactor is empty.");
@@ -483,7 +564,9 @@ void Reactor::setAdvanceLimit(const string& nm, const double limit)
         } else {
             m_net->initialize();
         }
-    } else if (k > m_nv) {
+    }
+    size_t k = componentIndex(nm);
+    if (k >= m_nv) {
         throw CanteraError("Reactor::setAdvanceLimit",
                            "Index out of bounds.");
     }
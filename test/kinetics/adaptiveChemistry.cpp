@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+
+namespace Cantera
+{
+
+TEST(AdaptiveChemistry, ActiveSubset)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto ref = newSolution("gri30.yaml");
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    ThermoPhase& thermo = *sol->thermo();
+    size_t kk = thermo.nSpecies();
+    size_t nr = kin.nReactions();
+    std::string X = "CH4:0.08, O2:0.18, N2:0.6, H2O:0.05, CO2:0.02, CO:0.01, "
+                    "H2:0.005, H:1e-4, OH:1e-3, O:1e-4, CH3:1e-4, HO2:1e-5";
+    thermo.setState_TPX(1400.0, OneAtm, X);
+    ref->thermo()->setState_TPX(1400.0, OneAtm, X);
+
+    kin.setAdaptiveChemistry({"CH4", "CO"}, 1e-3);
+    EXPECT_TRUE(kin.adaptiveChemistry());
+    vector_fp rop(nr), ropref(nr), wdot(kk), wref(kk);
+    kin.getNetRatesOfProgress(rop.data());
+    ref->kinetics()->getNetRatesOfProgress(ropref.data());
+    std::vector<size_t> active = kin.activeReactions();
+    std::vector<size_t> species = kin.activeSpecies();
+    EXPECT_EQ(kin.nAdaptiveSelections(), 1u);
+    EXPECT_GT(active.size(), 0u);
+    EXPECT_LT(active.size(), nr);
+    EXPECT_LT(species.size(), kk);
+    EXPECT_EQ(std::count(species.begin(), species.end(),
+                         thermo.speciesIndex("NO")), 0);
+
+    // Active reactions are evaluated as in the full mechanism
+    std::vector<char> isActive(nr, 0);
+    for (size_t i : active) {
+        isActive[i] = 1;
+    }
+    for (size_t i = 0; i < nr; i++) {
+        if (isActive[i]) {
+            EXPECT_NEAR(rop[i], ropref[i], 1e-13 * std::abs(ropref[i])) << i;
+        } else {
+            EXPECT_EQ(rop[i], 0.0) << i;
+        }
+    }
+
+    // Only active species are produced, and the production rates of the
+    // target species are close to those of the full mechanism
+    kin.getNetProductionRates(wdot.data());
+    ref->kinetics()->getNetProductionRates(wref.data());
+    std::vector<char> isActiveSpecies(kk, 0);
+    for (size_t k : species) {
+        isActiveSpecies[k] = 1;
+    }
+    for (size_t k = 0; k < kk; k++) {
+        if (!isActiveSpecies[k]) {
+            EXPECT_EQ(wdot[k], 0.0) << thermo.speciesName(k);
+        }
+    }
+    for (const char* name : {"CH4", "CO"}) {
+        size_t k = thermo.speciesIndex(name);
+        EXPECT_NEAR(wdot[k], wref[k], 0.02 * std::abs(wref[k])) << name;
+    }
+
+    // Small changes in the state keep the active subset, for which the
+    // third-body and falloff terms are evaluated at the new state
+    thermo.setState_TP(1410.0, OneAtm);
+    ref->thermo()->setState_TP(1410.0, OneAtm);
+    kin.getNetProductionRates(wdot.data());
+    EXPECT_EQ(kin.nAdaptiveSelections(), 1u);
+    EXPECT_EQ(kin.activeReactions(), active);
+    kin.getNetRatesOfProgress(rop.data());
+    ref->kinetics()->getNetRatesOfProgress(ropref.data());
+    for (size_t i : active) {
+        EXPECT_NEAR(rop[i], ropref[i], 1e-13 * std::abs(ropref[i])) << i;
+    }
+
+    // Cached rates of progress are updated when a multiplier changes
+    size_t iActive = active.back();
+    kin.setMultiplier(iActive, 2.0);
+    vector_fp rop2(nr);
+    kin.getNetRatesOfProgress(rop2.data());
+    EXPECT_NEAR(rop2[iActive], 2 * rop[iActive], 1e-13 * std::abs(rop[iActive]));
+    kin.setMultiplier(iActive, 1.0);
+
+    // Larger changes cause a new subset to be selected
+    thermo.setState_TP(1600.0, OneAtm);
+    kin.getNetProductionRates(wdot.data());
+    EXPECT_EQ(kin.nAdaptiveSelections(), 2u);
+
+    // All reactions are evaluated after disabling adaptive chemistry
+    kin.disableAdaptiveChemistry();
+    thermo.setState_TPX(1400.0, OneAtm, X);
+    ref->thermo()->setState_TPX(1400.0, OneAtm, X);
+    ref->kinetics()->getNetRatesOfProgress(ropref.data());
+    kin.getNetRatesOfProgress(rop.data());
+    EXPECT_EQ(kin.activeReactions().size(), nr);
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_NEAR(rop[i], ropref[i], 1e-13 * std::abs(ropref[i])) << i;
+    }
+
+    EXPECT_THROW(kin.setAdaptiveChemistry({"CH5"}), CanteraError);
+}
+
+}
@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+
+namespace Cantera
+{
+
+class MultiStateKineticsTest : public testing::Test
+{
+public:
+    void setup(const std::string& infile, const std::string& phase) {
+        sol_ = newSolution(infile, phase);
+        thermo_ = sol_->thermo().get();
+        kin_ = sol_->kinetics().get();
+    }
+
+    //! Generate `n` states with varying temperature, pressure and
+    //! composition, evaluate them together and compare with evaluating each
+    //! state separately
+    void compare(size_t n) {
+        size_t kk = thermo_->nSpecies();
+        vector_fp T(n), P(n), Y(n*kk);
+        for (size_t j = 0; j < n; j++) {
+            T[j] = 700.0 + 1900.0 * j / n;
+            P[j] = OneAtm * std::pow(10.0, -1.0 + 3.0 * ((7 * j) % n) / n);
+            for (size_t k = 0; k < kk; k++) {
+                Y[j*kk + k] = 1.0 + (j * 13 + k * 7) % 17;
+            }
+            // one species absent in some of the states
+            Y[j*kk + j % kk] = 0.0;
+        }
+
+        thermo_->setState_TP(1234.0, 3e5);
+        vector_fp state0, state1;
+        thermo_->saveState(state0);
+        vector_fp wdot(n*kk);
+        kin_->getNetProductionRates(n, T.data(), P.data(), Y.data(),
+                                    wdot.data());
+        thermo_->saveState(state1);
+        EXPECT_EQ(state0, state1);
+
+        vector_fp wref(kk);
+        for (size_t j = 0; j < n; j++) {
+            thermo_->setState_TPY(T[j], P[j], &Y[j*kk]);
+            kin_->getNetProductionRates(wref.data());
+            double scale = 0.0;
+            for (size_t k = 0; k < kk; k++) {
+                scale = std::max(scale, std::abs(wref[k]));
+            }
+            for (size_t k = 0; k < kk; k++) {
+                EXPECT_NEAR(wdot[j*kk + k], wref[k],
+                            1e-12 * std::abs(wref[k]) + 1e-14 * scale)
+                    << "state " << j << ", species " << thermo_->speciesName(k);
+            }
+        }
+    }
+
+protected:
+    shared_ptr<Solution> sol_;
+    ThermoPhase* thermo_;
+    Kinetics* kin_;
+};
+
+TEST_F(MultiStateKineticsTest, gri30)
+{
+    setup("gri30.yaml", "");
+    compare(45);
+}
+
+TEST_F(MultiStateKineticsTest, pdep)
+{
+    setup("../data/pdep-test.xml", "gas");
+    compare(7);
+}
+
+TEST_F(MultiStateKineticsTest, single)
+{
+    setup("h2o2.yaml", "");
+    compare(1);
+}
+
+}
@@ -0,0 +1,211 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/CompiledKinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+namespace Cantera
+{
+
+class CompiledKineticsTest : public testing::Test
+{
+public:
+    void SetUp() {
+        sol = newSolution("gri30.yaml", "gri30", "None");
+        kin = dynamic_cast<GasKinetics*>(sol->kinetics().get());
+
+        // Add reaction types and orders not present in GRI-Mech 3.0
+        const char* reactions[] = {
+            "{equation: CH3 + OH (+M) <=> CH2O + H2 (+M),"
+            " units: {length: cm, quantity: mol},"
+            " type: chemically-activated,"
+            " high-P-rate-constant: [5.88E-14, 6.721, -3022.227],"
+            " low-P-rate-constant: [282320.078, 1.46878, -3270.56495]}",
+            "{equation: N2O (+M) = N2 + O (+ M),"
+            " type: falloff,"
+            " high-P-rate-constant: [7.91000E+10, 0, 56020],"
+            " low-P-rate-constant: [6.37000E+14, 0, 56640],"
+            " SRI: {A: 1.1, B: 700.0, C: 1234.0, D: 56.0, E: 0.7},"
+            " efficiencies: {AR: 0.625}}",
+            "{equation: 'H + CH4 <=> H2 + CH3',"
+            " units: {pressure: atm},"
+            " type: pressure-dependent-Arrhenius,"
+            " rate-constants: [{P: 0.039474, A: 2.72e+09, b: 1.2, Ea: 6834.0},"
+            " {P: 1.0 atm, A: 1.26e+20, b: -1.83, Ea: 15003.0},"
+            " {P: 1.0 atm, A: 1.23e+04, b: 2.68, Ea: 6335.0},"
+            " {P: 10 atm, A: 1.68e+16, b: -0.6, Ea: 14754.0}]}",
+            "{equation: 'CH4 <=> CH3 + H', type: Chebyshev,"
+            " temperature-range: [290, 3000],"
+            " pressure-range: [0.01 atm, 100 atm],"
+            " data: [[-14.428, 0.25997, -0.022432],"
+            "        [22.063, 0.48809, -0.039643],"
+            "        [-0.23294, 0.4019, -0.026073]]}",
+            "{equation: 2 H2 + O2 => 2 H2O, rate-constant: [1.0e12, 0, 20000],"
+            " orders: {H2: 1.5, O2: 0.75}}"
+        };
+        for (const char* r : reactions) {
+            kin->addReaction(newReaction(AnyMap::fromYamlString(r), *kin));
+        }
+        sol->thermo()->setState_TPX(1250.0, 2 * OneAtm,
+            "CH4:1, O2:2, N2:7, H2:0.1, H:0.01, OH:0.02, CH3:0.005, N2O:0.001");
+    }
+
+    void TearDown() {
+#ifndef _WIN32
+        for (const auto& name : m_files) {
+            std::remove(name.c_str());
+        }
+        if (!m_tmpdir.empty()) {
+            rmdir(m_tmpdir.c_str());
+        }
+#endif
+    }
+
+    //! Generate and compile the kernels for the mechanism in a temporary
+    //! directory. Returns the path of the library, or an empty string if no
+    //! compiler is available or compilation fails.
+    std::string compile(const std::string& name) {
+#ifdef _WIN32
+        return "";
+#else
+        if (std::system("c++ --version > /dev/null 2>&1") != 0) {
+            return "";
+        }
+        if (m_tmpdir.empty()) {
+            const char* tmp = getenv("TMPDIR");
+            std::string pattern = std::string(tmp ? tmp : "/tmp")
+                + "/cantera-compiled-XXXXXX";
+            std::vector<char> buf(pattern.begin(), pattern.end());
+            buf.push_back('\0');
+            if (!mkdtemp(buf.data())) {
+                return "";
+            }
+            m_tmpdir = buf.data();
+        }
+        std::string source = m_tmpdir + "/" + name + ".cpp";
+        std::string library = m_tmpdir + "/lib" + name + ".so";
+        m_files.push_back(source);
+        m_files.push_back(library);
+        generateCompiledKinetics(*kin, source);
+        std::string cmd = "c++ -O1 -shared -fPIC '" + source + "' -o '"
+            + library + "' > /dev/null 2>&1";
+        return std::system(cmd.c_str()) == 0 ? library : "";
+#endif
+    }
+
+    shared_ptr<Solution> sol;
+    GasKinetics* kin;
+
+private:
+    std::string m_tmpdir; //!< Directory for the generated files
+    std::vector<std::string> m_files; //!< Generated files
+};
+
+TEST_F(CompiledKineticsTest, GeneratedSource)
+{
+    std::stringstream source;
+    generateCompiledKinetics(*kin, source);
+    std::string text = source.str();
+    EXPECT_NE(text.find("ct_kinetics_updateROP"), npos);
+    EXPECT_NE(text.find("troe(pr, work["), npos);
+    EXPECT_NE(text.find("sri(pr, work + "), npos);
+    EXPECT_NE(text.find("cpow(c["), npos);
+    EXPECT_NE(text.find("// 327: CH4 + H <=> CH3 + H2\n    k = kf[327];"), npos);
+    EXPECT_EQ(text.find("#include \"cantera"), npos);
+}
+
+TEST_F(CompiledKineticsTest, LoadAndEvaluate)
+{
+#ifdef _WIN32
+    GTEST_SKIP() << "Compilation of the generated source is not tested";
+#endif
+    std::string library = compile("compiled_kinetics_test");
+    if (library.empty()) {
+        GTEST_SKIP() << "C++ compiler not available";
+    }
+    size_t nr = kin->nReactions();
+    size_t nsp = kin->nTotalSpecies();
+    vector_fp ropf(nr), ropr(nr), wdot(nsp), ropf2(nr), ropr2(nr), wdot2(nsp);
+    kin->setMultiplier(10, 2.5);
+    kin->getFwdRatesOfProgress(ropf.data());
+    kin->getRevRatesOfProgress(ropr.data());
+    kin->getNetProductionRates(wdot.data());
+
+    kin->loadCompiledKinetics(library);
+    ASSERT_TRUE(kin->hasCompiledKinetics());
+    kin->getFwdRatesOfProgress(ropf2.data());
+    kin->getRevRatesOfProgress(ropr2.data());
+    kin->getNetProductionRates(wdot2.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_NEAR(ropf2[i], ropf[i], 1e-10 * std::abs(ropf[i]) + 1e-30) << i;
+        EXPECT_NEAR(ropr2[i], ropr[i], 1e-10 * std::abs(ropr[i]) + 1e-30) << i;
+    }
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot2[k], wdot[k], 1e-10 * std::abs(wdot[k]) + 1e-14) << k;
+    }
+
+    // Changes in state and multipliers are taken into account
+    sol->thermo()->setState_TP(1500.0, 5 * OneAtm);
+    kin->setMultiplier(20, 0.5);
+    kin->getNetProductionRates(wdot2.data());
+    kin->unloadCompiledKinetics();
+    kin->getNetProductionRates(wdot.data());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot2[k], wdot[k], 1e-10 * std::abs(wdot[k]) + 1e-14) << k;
+    }
+
+    // Rates of progress are re-evaluated when only the temperature changes,
+    // and the generic evaluation is not affected by the compiled one
+    kin->loadCompiledKinetics(library);
+    kin->getFwdRatesOfProgress(ropf2.data());
+    sol->thermo()->setState_TR(1400.0, sol->thermo()->density());
+    kin->getFwdRatesOfProgress(ropf2.data());
+    kin->getNetProductionRates(wdot2.data());
+    kin->unloadCompiledKinetics();
+    kin->getFwdRatesOfProgress(ropf.data());
+    kin->getNetProductionRates(wdot.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_NEAR(ropf2[i], ropf[i], 1e-10 * std::abs(ropf[i]) + 1e-30) << i;
+    }
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot2[k], wdot[k], 1e-10 * std::abs(wdot[k]) + 1e-14) << k;
+    }
+
+    // The library is unloaded when the mechanism is changed
+    kin->loadCompiledKinetics(library);
+    auto R = kin->reaction(10);
+    kin->modifyReaction(10, R);
+    EXPECT_FALSE(kin->hasCompiledKinetics());
+}
+
+TEST_F(CompiledKineticsTest, InconsistentLibrary)
+{
+#ifdef _WIN32
+    GTEST_SKIP() << "Compilation of the generated source is not tested";
+#endif
+    std::string library = compile("compiled_kinetics_test2");
+    if (library.empty()) {
+        GTEST_SKIP() << "C++ compiler not available";
+    }
+    // Library generated for different rate parameters
+    auto R = std::dynamic_pointer_cast<ElementaryReaction>(kin->reaction(10));
+    ElementaryReaction R2(*R);
+    R2.rate = Arrhenius(2 * R->rate.preExponentialFactor(),
+                        R->rate.temperatureExponent(),
+                        R->rate.activationEnergy_R());
+    kin->modifyReaction(10, std::make_shared<ElementaryReaction>(R2));
+    EXPECT_THROW(kin->loadCompiledKinetics(library), CanteraError);
+    EXPECT_FALSE(kin->hasCompiledKinetics());
+    EXPECT_THROW(kin->loadCompiledKinetics("./nonexistent.so"), CanteraError);
+}
+
+}
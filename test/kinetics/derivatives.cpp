@@ -0,0 +1,258 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/thermo/SurfPhase.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+namespace Cantera
+{
+
+class KineticsDerivativesTest : public testing::Test
+{
+public:
+    KineticsDerivativesTest() {
+        sol_ = newSolution("gri30.yaml");
+        thermo_ = sol_->thermo().get();
+        kin_ = sol_->kinetics().get();
+        // all species present so that every derivative is exercised
+        vector_fp X(thermo_->nSpecies(), 1e-3);
+        X[thermo_->speciesIndex("CH4")] = 0.08;
+        X[thermo_->speciesIndex("O2")] = 0.18;
+        X[thermo_->speciesIndex("H2O")] = 0.1;
+        X[thermo_->speciesIndex("N2")] = 0.5;
+        thermo_->setState_TPX(1500.0, 2 * OneAtm, X.data());
+    }
+
+    //! Compare each column of the analytic derivatives of `rates` with
+    //! respect to concentrations with central finite differences
+    void checkColumns(const Eigen::SparseMatrix<double>& dRdC, size_t nRates,
+                      void (Kinetics::*getRates)(double*)) {
+        size_t kk = thermo_->nSpecies();
+        vector_fp conc(kk), R0(nRates), R1(nRates), R2(nRates);
+        thermo_->getConcentrations(conc.data());
+        (kin_->*getRates)(R0.data());
+        double Rmax = 0.0;
+        for (size_t i = 0; i < nRates; i++) {
+            Rmax = std::max(Rmax, std::abs(R0[i]));
+        }
+        Eigen::MatrixXd dense(dRdC);
+        for (size_t k = 0; k < kk; k++) {
+            vector_fp cpert = conc;
+            double dc = 1e-5 * conc[k];
+            cpert[k] = conc[k] + dc;
+            thermo_->setConcentrations(cpert.data());
+            (kin_->*getRates)(R1.data());
+            cpert[k] = conc[k] - dc;
+            thermo_->setConcentrations(cpert.data());
+            (kin_->*getRates)(R2.data());
+            thermo_->setConcentrations(conc.data());
+            for (size_t i = 0; i < nRates; i++) {
+                double fd = (R1[i] - R2[i]) / (2 * dc);
+                // absolute floor accounts for round-off in rates which are
+                // sums of many terms, e.g. for inert species
+                double atol = (1e-8 * std::abs(R0[i]) + 1e-12 * Rmax) / conc[k];
+                EXPECT_NEAR(dense(i, k), fd, 1e-6 * std::abs(fd) + atol)
+                    << "row " << i << ", species " << thermo_->speciesName(k);
+            }
+        }
+    }
+
+protected:
+    shared_ptr<Solution> sol_;
+    ThermoPhase* thermo_;
+    Kinetics* kin_;
+};
+
+TEST_F(KineticsDerivativesTest, fwdRatesOfProgress_ddC)
+{
+    auto dqdc = kin_->fwdRatesOfProgress_ddC();
+    EXPECT_EQ((size_t) dqdc.rows(), kin_->nReactions());
+    EXPECT_EQ((size_t) dqdc.cols(), kin_->nTotalSpecies());
+    checkColumns(dqdc, kin_->nReactions(), &Kinetics::getFwdRatesOfProgress);
+}
+
+TEST_F(KineticsDerivativesTest, netRatesOfProgress_ddC)
+{
+    checkColumns(kin_->netRatesOfProgress_ddC(), kin_->nReactions(),
+                 &Kinetics::getNetRatesOfProgress);
+}
+
+TEST_F(KineticsDerivativesTest, netProductionRates_ddC)
+{
+    auto dwdc = kin_->netProductionRates_ddC();
+    EXPECT_EQ((size_t) dwdc.rows(), kin_->nTotalSpecies());
+    EXPECT_EQ((size_t) dwdc.cols(), kin_->nTotalSpecies());
+    checkColumns(dwdc, kin_->nTotalSpecies(), &Kinetics::getNetProductionRates);
+}
+
+TEST_F(KineticsDerivativesTest, netProductionRates_ddT)
+{
+    size_t kk = thermo_->nSpecies();
+    vector_fp dwdT(kk), w0(kk), w1(kk);
+    kin_->getNetProductionRates_ddT(dwdT.data());
+    kin_->getNetProductionRates(w0.data());
+    double T = thermo_->temperature();
+    double rho = thermo_->density();
+    thermo_->setState_TR(T + 1e-3, rho);
+    kin_->getNetProductionRates(w1.data());
+    for (size_t k = 0; k < kk; k++) {
+        double fd = (w1[k] - w0[k]) / 1e-3;
+        EXPECT_NEAR(dwdT[k], fd, 1e-3 * std::abs(fd) + 1e-8);
+    }
+}
+
+//! Compare the temperature derivatives of the net rates of progress with
+//! central finite differences at constant density, for mechanisms with
+//! P-log, Chebyshev and SRI falloff reactions
+void checkRatesOfProgress_ddT(const std::string& infile)
+{
+    auto sol = newSolution(infile);
+    auto thermo = sol->thermo();
+    auto kin = sol->kinetics();
+    vector_fp X(thermo->nSpecies(), 1.0);
+    thermo->setState_TPX(1100.0, 3 * OneAtm, X.data());
+    size_t nr = kin->nReactions();
+    vector_fp drop(nr), R1(nr), R2(nr);
+    kin->getNetRatesOfProgress_ddT(drop.data());
+    double T = thermo->temperature();
+    double rho = thermo->density();
+    EXPECT_DOUBLE_EQ(thermo->pressure(), 3 * OneAtm);
+
+    double dT = 1e-4;
+    thermo->setState_TR(T + dT, rho);
+    kin->getNetRatesOfProgress(R1.data());
+    thermo->setState_TR(T - dT, rho);
+    kin->getNetRatesOfProgress(R2.data());
+    for (size_t i = 0; i < nr; i++) {
+        double fd = (R1[i] - R2[i]) / (2 * dT);
+        EXPECT_NEAR(drop[i], fd, 1e-6 * std::abs(fd) + 1e-12)
+            << kin->reactionString(i);
+    }
+}
+
+TEST(GasKinetics, netRatesOfProgress_ddT_pdep)
+{
+    checkRatesOfProgress_ddT("pdep-test.xml");
+}
+
+TEST(GasKinetics, netRatesOfProgress_ddT_sri)
+{
+    checkRatesOfProgress_ddT("sri-falloff.xml");
+}
+
+class InterfaceDerivativesTest : public testing::Test
+{
+public:
+    InterfaceDerivativesTest() {
+        gas_.reset(newPhase("surface-phases.yaml", "gas"));
+        surf_.reset(newPhase("surface-phases.yaml", "Pt-surf"));
+        phases_ = {surf_.get(), gas_.get()};
+        kin_ = newKinetics(phases_, "surface-phases.yaml", "Pt-surf");
+
+        // Reversible, coverage-dependent and Motz-Wise sticking reactions
+        const char* reactions[] = {
+            "{equation: H2 + 2 Pt(s) <=> 2 H(s),"
+            " rate-constant: {A: 4.4579e16, b: 0.5, Ea: 1000 J/mol},"
+            " coverage-dependencies: {H(s): {a: 0.1, m: -0.5, E: 2000 J/mol},"
+            "                         O(s): {a: -0.2, m: 0.3, E: 0}}}",
+            "{equation: H + Pt(s) => H(s), sticking-coefficient: [0.5, 0, 0],"
+            " Motz-Wise: true,"
+            " coverage-dependencies: {H(s): {a: 0, m: 0, E: 3000 J/mol}}}"
+        };
+        for (const char* r : reactions) {
+            kin_->addReaction(newReaction(AnyMap::fromYamlString(r), *kin_));
+        }
+        gas_->setState_TPX(900.0, OneAtm, "H2:0.4, H:0.01, Ar:0.59");
+        surf_->setState_TP(900.0, OneAtm);
+        auto surf = std::dynamic_pointer_cast<SurfPhase>(surf_);
+        surf->setCoveragesByName("Pt(s):0.5, H(s):0.4, O(s):0.1");
+    }
+
+protected:
+    shared_ptr<ThermoPhase> gas_, surf_;
+    std::vector<ThermoPhase*> phases_;
+    unique_ptr<Kinetics> kin_;
+};
+
+TEST_F(InterfaceDerivativesTest, netRatesOfProgress_ddC)
+{
+    size_t nr = kin_->nReactions();
+    Eigen::MatrixXd dense(kin_->netRatesOfProgress_ddC());
+    vector_fp R0(nr), R1(nr), R2(nr);
+    kin_->getNetRatesOfProgress(R0.data());
+    for (size_t n = 0; n < kin_->nPhases(); n++) {
+        ThermoPhase& tp = kin_->thermo(n);
+        vector_fp conc(tp.nSpecies());
+        tp.getConcentrations(conc.data());
+        for (size_t k = 0; k < tp.nSpecies(); k++) {
+            vector_fp cpert = conc;
+            double dc = 1e-5 * conc[k];
+            cpert[k] = conc[k] + dc;
+            tp.setConcentrations(cpert.data());
+            kin_->getNetRatesOfProgress(R1.data());
+            cpert[k] = conc[k] - dc;
+            tp.setConcentrations(cpert.data());
+            kin_->getNetRatesOfProgress(R2.data());
+            tp.setConcentrations(conc.data());
+            size_t kk = kin_->kineticsSpeciesIndex(k, n);
+            for (size_t i = 0; i < nr; i++) {
+                double fd = (R1[i] - R2[i]) / (2 * dc);
+                // absolute floor accounts for round-off in the differences
+                double atol = 1e-9 * std::abs(R0[i]) / conc[k];
+                EXPECT_NEAR(dense(i, kk), fd, 1e-6 * std::abs(fd) + atol)
+                    << "reaction " << i << ", species "
+                    << kin_->kineticsSpeciesName(kk);
+            }
+        }
+    }
+}
+
+TEST_F(InterfaceDerivativesTest, ImplicitSurfChemJacobian)
+{
+    auto ikin = dynamic_cast<InterfaceKinetics*>(kin_.get());
+    ImplicitSurfChem surfChem({ikin});
+    size_t n = surfChem.neq();
+    vector_fp y(n), ydot(n), ydot1(n), ydot2(n), jac(n * n);
+    surfChem.getState(y.data());
+    surfChem.eval(0.0, y.data(), ydot.data(), nullptr);
+    surfChem.evalJacobian(0.0, y.data(), ydot.data(), jac.data());
+    for (size_t j = 0; j < n; j++) {
+        vector_fp ypert = y;
+        double dy = 1e-6;
+        ypert[j] = y[j] + dy;
+        surfChem.eval(0.0, ypert.data(), ydot1.data(), nullptr);
+        ypert[j] = y[j] - dy;
+        surfChem.eval(0.0, ypert.data(), ydot2.data(), nullptr);
+        for (size_t i = 0; i < n; i++) {
+            double fd = (ydot1[i] - ydot2[i]) / (2 * dy);
+            EXPECT_NEAR(jac[j * n + i], fd, 1e-6 * std::abs(fd) + 1e-6)
+                << "row " << i << ", column " << j;
+        }
+    }
+}
+
+TEST(InterfaceKinetics, SteadyStateCoverages)
+{
+    shared_ptr<ThermoPhase> gas(newPhase("ptcombust.yaml", "gas"));
+    shared_ptr<ThermoPhase> surf(newPhase("ptcombust.yaml", "Pt_surf"));
+    std::vector<ThermoPhase*> phases{surf.get(), gas.get()};
+    auto kin = newKinetics(phases, "ptcombust.yaml", "Pt_surf");
+    gas->setState_TPX(900.0, OneAtm, "CH4:0.095, O2:0.21, AR:0.695");
+    surf->setState_TP(900.0, OneAtm);
+    auto ikin = dynamic_cast<InterfaceKinetics*>(kin.get());
+    ikin->solvePseudoSteadyStateProblem();
+
+    vector_fp wdot(kin->nTotalSpecies()), ropf(kin->nReactions());
+    kin->getNetProductionRates(wdot.data());
+    kin->getFwdRatesOfProgress(ropf.data());
+    double scale = *std::max_element(ropf.begin(), ropf.end());
+    for (size_t k = 0; k < surf->nSpecies(); k++) {
+        EXPECT_NEAR(wdot[kin->kineticsSpeciesIndex(k, 0)], 0.0, 1e-6 * scale)
+            << surf->speciesName(k);
+    }
+}
+
+}
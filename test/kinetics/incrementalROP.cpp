@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+
+namespace Cantera
+{
+
+TEST(IncrementalROP, PerturbedSpecies)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto ref = newSolution("gri30.yaml");
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    kin.setIncrementalROP(true);
+    ThermoPhase& thermo = *sol->thermo();
+    size_t kk = thermo.nSpecies();
+    size_t nr = kin.nReactions();
+
+    vector_fp X(kk, 1e-4);
+    X[thermo.speciesIndex("CH4")] = 0.08;
+    X[thermo.speciesIndex("O2")] = 0.18;
+    X[thermo.speciesIndex("N2")] = 0.6;
+    thermo.setState_TPX(1400.0, OneAtm, X.data());
+    vector_fp conc0(kk);
+    thermo.getConcentrations(conc0.data());
+
+    vector_fp wdot(kk), wref(kk), rop(nr), ropref(nr);
+    auto compare = [&](const vector_fp& conc) {
+        thermo.setConcentrations(conc.data());
+        ref->thermo()->setState_TR(thermo.temperature(), thermo.density());
+        ref->thermo()->setConcentrations(conc.data());
+        kin.getNetRatesOfProgress(rop.data());
+        ref->kinetics()->getNetRatesOfProgress(ropref.data());
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_DOUBLE_EQ(rop[i], ropref[i]) << "reaction " << i;
+        }
+        kin.getNetProductionRates(wdot.data());
+        ref->kinetics()->getNetProductionRates(wref.data());
+        double scale = 0.0;
+        for (size_t k = 0; k < kk; k++) {
+            scale = std::max(scale, std::abs(wref[k]));
+        }
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(wdot[k], wref[k], 1e-12 * std::abs(wref[k]) + 1e-14 * scale)
+                << "species " << thermo.speciesName(k);
+        }
+    };
+
+    compare(conc0);
+    // perturb one species at a time, as for a finite difference Jacobian
+    for (size_t k = 0; k < kk; k++) {
+        vector_fp conc = conc0;
+        conc[k] *= 1.0 + 1e-3;
+        compare(conc);
+    }
+    // return to the reference state
+    compare(conc0);
+    // a new temperature requires evaluating all reactions
+    thermo.setState_TP(1500.0, OneAtm);
+    thermo.getConcentrations(conc0.data());
+    conc0[thermo.speciesIndex("OH")] *= 2.0;
+    compare(conc0);
+}
+
+}
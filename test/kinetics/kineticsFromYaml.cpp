@@ -4,6 +4,7 @@
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/kinetics/KineticsFactory.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/transport/MixTransport.h"
 
 using namespace Cantera;
 
@@ -252,6 +253,66 @@ TEST(Kinetics, ElectrochemFromYaml)
     EXPECT_NEAR(ropr[0], 0.045559670, 1e-8);
 }
 
+TEST(Kinetics, InterfaceRateConstantCache)
+{
+    shared_ptr<ThermoPhase> gas(newPhase("surface-phases.yaml", "gas"));
+    shared_ptr<ThermoPhase> surf_tp(newPhase("surface-phases.yaml", "Pt-surf"));
+    auto surf = std::dynamic_pointer_cast<SurfPhase>(surf_tp);
+    std::vector<ThermoPhase*> phases{surf_tp.get(), gas.get()};
+    auto kin = newKinetics(phases, "surface-phases.yaml", "Pt-surf");
+    size_t nr = kin->nReactions();
+    vector_fp kf(nr), kr(nr), kf_ref(nr), kr_ref(nr);
+
+    // Compare with a kinetics object that has not cached anything
+    auto check = [&]() {
+        auto kin_ref = newKinetics(phases, "surface-phases.yaml", "Pt-surf");
+        kin->getFwdRateConstants(kf.data());
+        kin->getRevRateConstants(kr.data());
+        kin_ref->getFwdRateConstants(kf_ref.data());
+        kin_ref->getRevRateConstants(kr_ref.data());
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_DOUBLE_EQ(kf[i], kf_ref[i]) << i;
+            EXPECT_DOUBLE_EQ(kr[i], kr_ref[i]) << i;
+        }
+    };
+
+    surf->setCoveragesByName("Pt(s):0.7, H(s):0.3");
+    check();
+    double kf1 = kf[1];
+    surf->setCoveragesByName("Pt(s):0.2, H(s):0.8");
+    check();
+    EXPECT_GT(kf[1], kf1); // coverage-dependent activation energy
+    gas->setState_TP(900, 2 * OneAtm);
+    surf->setState_TP(900, 2 * OneAtm);
+    check();
+    surf->setSiteDensity(2 * surf->siteDensity());
+    check();
+}
+
+TEST(Kinetics, ElectrochemRateConstantCache)
+{
+    shared_ptr<ThermoPhase> graphite(newPhase("surface-phases.yaml", "graphite"));
+    shared_ptr<ThermoPhase> electrolyte(newPhase("surface-phases.yaml", "electrolyte"));
+    shared_ptr<ThermoPhase> anode(newPhase("surface-phases.yaml", "anode-surface"));
+    std::vector<ThermoPhase*> phases{anode.get(), graphite.get(), electrolyte.get()};
+    auto kin = newKinetics(phases, "surface-phases.yaml", "anode-surface");
+    vector_fp ropf(kin->nReactions()), ropr(kin->nReactions());
+    kin->getFwdRatesOfProgress(ropf.data());
+    graphite->setElectricPotential(0.4);
+    kin->getFwdRatesOfProgress(ropf.data());
+    kin->getRevRatesOfProgress(ropr.data());
+    EXPECT_NEAR(ropf[0], 0.279762338, 1e-8);
+    EXPECT_NEAR(ropr[0], 0.045559670, 1e-8);
+
+    graphite->setElectricPotential(0.0);
+    kin->getFwdRatesOfProgress(ropf.data());
+    graphite->setElectricPotential(0.4);
+    kin->getFwdRatesOfProgress(ropf.data());
+    kin->getRevRatesOfProgress(ropr.data());
+    EXPECT_NEAR(ropf[0], 0.279762338, 1e-8);
+    EXPECT_NEAR(ropr[0], 0.045559670, 1e-8);
+}
+
 TEST(KineticsFromYaml, NoKineticsModelOrReactionsField1)
 {
     auto soln = newSolution("phase-reaction-spec1.yaml",
@@ -319,3 +380,135 @@ TEST(KineticsFromYaml, ReactionsFieldWithoutKineticsModel2)
                              "nokinetics-reactions"),
                  InputFileError);
 }
+
+TEST(KineticsFromYaml, CompactMode)
+{
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto thermo = sol->thermo();
+    auto kin = sol->kinetics();
+    thermo->setState_TPX(1400, 2 * OneAtm, "CH4:1, O2:2, N2:7.52, OH:0.01");
+    size_t nr = kin->nReactions();
+    size_t kk = kin->nTotalSpecies();
+    vector_fp wdot(kk), wdot2(kk);
+    kin->getNetProductionRates(wdot.data());
+    std::vector<std::string> equations, reactants, products;
+    vector_int types;
+    for (size_t i = 0; i < nr; i++) {
+        equations.push_back(kin->reactionString(i));
+        reactants.push_back(kin->reactantString(i));
+        products.push_back(kin->productString(i));
+        types.push_back(kin->reactionType(i));
+    }
+    double nuO2 = kin->reactantStoichCoeff(thermo->speciesIndex("O2"), 37);
+    double nuH2O = kin->productStoichCoeff(thermo->speciesIndex("H2O"), 84);
+
+    auto before = sol->memoryUsage();
+    EXPECT_GT(before["species"], 0);
+    EXPECT_GT(before["reactions"], 0);
+    EXPECT_GT(before["phase-input"], 0);
+    EXPECT_GT(before["input-cache"], 0);
+    EXPECT_GT(before["species-thermo"], 0);
+    EXPECT_GT(before["stoichiometry"], 0);
+    EXPECT_GT(before["rates"], 0);
+
+    // The input cache is shared with other objects, and is only cleared on
+    // request
+    sol->compact();
+    EXPECT_TRUE(thermo->isCompact());
+    EXPECT_TRUE(kin->isCompact());
+    auto after = sol->memoryUsage();
+    EXPECT_EQ(after["species"], (size_t) 0);
+    EXPECT_LT(after["phase-input"], before["phase-input"]);
+    EXPECT_EQ(after["input-cache"], before["input-cache"]);
+    EXPECT_LT(after["reactions"], before["reactions"] / 4);
+    // The numerical managers are kept
+    EXPECT_EQ(after["species-thermo"], before["species-thermo"]);
+    EXPECT_EQ(after["stoichiometry"], before["stoichiometry"]);
+    EXPECT_EQ(after["rates"], before["rates"]);
+    sol->compact(true);
+    EXPECT_EQ(sol->memoryUsage()["input-cache"], (size_t) 0);
+
+    EXPECT_EQ(kin->nReactions(), nr);
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_EQ(kin->reactionString(i), equations[i]);
+        EXPECT_EQ(kin->reactantString(i), reactants[i]);
+        EXPECT_EQ(kin->productString(i), products[i]);
+        EXPECT_EQ(kin->reactionType(i), types[i]);
+    }
+    EXPECT_DOUBLE_EQ(kin->reactantStoichCoeff(thermo->speciesIndex("O2"), 37),
+                     nuO2);
+    EXPECT_DOUBLE_EQ(kin->productStoichCoeff(thermo->speciesIndex("H2O"), 84),
+                     nuH2O);
+
+    thermo->setState_TPX(1000, OneAtm, "H2:1, O2:1");
+    thermo->setState_TPX(1400, 2 * OneAtm, "CH4:1, O2:2, N2:7.52, OH:0.01");
+    kin->getNetProductionRates(wdot2.data());
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(wdot2[k], wdot[k]);
+    }
+
+    const Kinetics& constKin = *kin;
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_THROW(kin->reaction(i), CanteraError);
+        EXPECT_THROW(constKin.reaction(i), CanteraError);
+    }
+    EXPECT_THROW(thermo->species(0), CanteraError);
+    EXPECT_THROW(thermo->species("H2"), CanteraError);
+    EXPECT_THROW(kin->checkDuplicates(), CanteraError);
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: N + NO <=> N2 + O,"
+        " rate-constant: [2.7e+13 cm^3/mol/s, 0, 355 cal/mol]}");
+    shared_ptr<Reaction> R = newReaction(rxn, *kin);
+    EXPECT_THROW(kin->addReaction(R), CanteraError);
+}
+
+TEST(KineticsFromYaml, CloneSolution)
+{
+    auto sol = newSolution("gri30.yaml", "", "Mix");
+    sol->thermo()->setState_TPX(1400, 2 * OneAtm,
+                                "CH4:1, O2:2, N2:7.52, OH:0.01");
+    sol->kinetics()->setMultiplier(12, 0.5);
+    auto copy = sol->clone();
+    auto thermo = copy->thermo();
+    auto kin = copy->kinetics();
+    auto tran = copy->transport();
+    ASSERT_NE(thermo, sol->thermo());
+    EXPECT_EQ(thermo->species(5), sol->thermo()->species(5));
+    EXPECT_EQ(kin->reaction(7), sol->kinetics()->reaction(7));
+    EXPECT_EQ(tran->transportType(), "Mix");
+    EXPECT_DOUBLE_EQ(kin->multiplier(12), 0.5);
+
+    size_t kk = thermo->nSpecies();
+    vector_fp wdot1(kk), wdot2(kk), D1(kk), D2(kk);
+    EXPECT_DOUBLE_EQ(thermo->temperature(), 1400);
+    EXPECT_DOUBLE_EQ(thermo->enthalpy_mass(), sol->thermo()->enthalpy_mass());
+    sol->kinetics()->getNetProductionRates(wdot1.data());
+    kin->getNetProductionRates(wdot2.data());
+    sol->transport()->getMixDiffCoeffs(D1.data());
+    tran->getMixDiffCoeffs(D2.data());
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(wdot2[k], wdot1[k]);
+        EXPECT_DOUBLE_EQ(D2[k], D1[k]);
+    }
+    EXPECT_DOUBLE_EQ(tran->viscosity(), sol->transport()->viscosity());
+    EXPECT_DOUBLE_EQ(tran->thermalConductivity(),
+                     sol->transport()->thermalConductivity());
+
+    // The state of the copy is independent of the original
+    thermo->setState_TP(900, OneAtm);
+    EXPECT_DOUBLE_EQ(sol->thermo()->temperature(), 1400);
+
+    // The fits are copied by useFitsFrom(), so the source may be destroyed
+    // before they are used
+    MixTransport tran2;
+    {
+        auto sol2 = newSolution("gri30.yaml", "", "Mix");
+        tran2.useFitsFrom(dynamic_cast<GasTransport&>(*sol2->transport()));
+    }
+    tran2.init(thermo.get());
+    tran->getMixDiffCoeffs(D1.data());
+    tran2.getMixDiffCoeffs(D2.data());
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(D2[k], D1[k]);
+    }
+}
@@ -0,0 +1,279 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/transport/TransportBase.h"
+#include "cantera/zeroD/IdealGasReactor.h"
+#include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ConstPressureReactor.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/Boundary1D.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/refine.h"
+
+#include <map>
+
+namespace Cantera
+{
+
+TEST(QuasiSteadySpecies, ProductionRates)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto ref = newSolution("gri30.yaml");
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    ThermoPhase& thermo = *sol->thermo();
+    size_t kk = thermo.nSpecies();
+    std::string X = "CH4:0.08, O2:0.18, N2:0.6, H2O:0.05, CO2:0.02, CO:0.01, "
+                    "H2:0.005, H:1e-3, OH:1e-3, O:1e-3, CH3:1e-4, HO2:1e-5";
+    std::vector<std::string> names = {"CH2", "CH2(S)", "HCO", "CH3O", "CH2OH"};
+    kin.setQuasiSteadySpecies(names);
+    ASSERT_EQ(kin.quasiSteadySpecies().size(), names.size());
+
+    vector_fp wdot(kk), wref(kk), cdot(kk), ddot(kk), cq(names.size());
+    for (double T : {1400.0, 1500.0, 1800.0}) {
+        thermo.setState_TPX(T, OneAtm, X);
+        kin.getNetProductionRates(wdot.data());
+        kin.getCreationRates(cdot.data());
+        kin.getDestructionRates(ddot.data());
+        kin.getQuasiSteadyConcentrations(cq.data());
+        for (size_t j = 0; j < names.size(); j++) {
+            size_t k = kin.quasiSteadySpecies()[j];
+            EXPECT_EQ(wdot[k], 0.0);
+            EXPECT_GT(cq[j], 0.0) << names[j];
+            // production and consumption of the QSS species are balanced
+            EXPECT_NEAR(cdot[k], ddot[k], 1e-8 * cdot[k]) << names[j];
+        }
+
+        // Other species are produced as if the QSS species had the computed
+        // concentrations, apart from small differences in the third-body
+        // concentrations
+        vector_fp conc(kk);
+        thermo.getConcentrations(conc.data());
+        for (size_t j = 0; j < names.size(); j++) {
+            conc[kin.quasiSteadySpecies()[j]] = cq[j];
+        }
+        ref->thermo()->setState_TP(T, OneAtm);
+        ref->thermo()->setConcentrations(conc.data());
+        ref->kinetics()->getNetProductionRates(wref.data());
+        for (size_t k = 0; k < kk; k++) {
+            if (wdot[k] != 0.0) {
+                EXPECT_NEAR(wdot[k], wref[k], 1e-5 * std::abs(wref[k]))
+                    << thermo.speciesName(k);
+            }
+        }
+    }
+
+    kin.setQuasiSteadySpecies({});
+    thermo.setState_TPX(1400.0, OneAtm, X);
+    ref->thermo()->setState_TPX(1400.0, OneAtm, X);
+    kin.getNetProductionRates(wdot.data());
+    ref->kinetics()->getNetProductionRates(wref.data());
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(wdot[k], wref[k]) << thermo.speciesName(k);
+    }
+    EXPECT_THROW(kin.setQuasiSteadySpecies({"CH5"}), CanteraError);
+
+    // The QSS assumption does not hold for the whole radical pool, and the
+    // iteration fails to converge
+    kin.setQuasiSteadySpecies({"H", "O", "OH", "HO2", "CH3", "CH2O", "HCO"});
+    thermo.setState_TPX(1500.0, OneAtm, X);
+    EXPECT_THROW(kin.getNetProductionRates(wdot.data()), CanteraError);
+}
+
+namespace {
+
+std::vector<std::string> qssNames = {"CH2", "CH2(S)", "HCO", "CH2OH", "C2H3"};
+
+void setQuasiSteadySpecies(Solution& sol, const std::vector<std::string>& names)
+{
+    dynamic_cast<GasKinetics&>(*sol.kinetics()).setQuasiSteadySpecies(names);
+}
+
+//! Compare a reactor which leaves the QSS species out of its state vector with
+//! a reactor using the same kinetics that was set up with the full state vector
+template <class R>
+void compareReactors()
+{
+    std::string X = "CH4:0.05, O2:0.15, N2:0.6, H2O:0.1, CO2:0.05, CO:0.02, "
+                    "H2:0.01, H:1e-3, OH:2e-3, O:1e-3, CH3:1e-3, HO2:1e-4, "
+                    "CH2O:1e-4";
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto ref = newSolution("gri30.yaml", "", "None");
+    sol->thermo()->setState_TPX(1500.0, OneAtm, X);
+    ref->thermo()->setState_TPX(1500.0, OneAtm, X);
+
+    setQuasiSteadySpecies(*sol, qssNames);
+    R reactor;
+    reactor.insert(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    reactor.initialize(0.0);
+
+    R refReactor;
+    refReactor.insert(ref);
+    ReactorNet refNet;
+    refNet.addReactor(refReactor);
+    refReactor.initialize(0.0);
+    setQuasiSteadySpecies(*ref, qssNames);
+
+    size_t kk = sol->thermo()->nSpecies();
+    ASSERT_EQ(reactor.neq(), refReactor.neq() - qssNames.size());
+    for (auto& name : qssNames) {
+        EXPECT_EQ(reactor.componentIndex(name), npos) << name;
+        EXPECT_NE(refReactor.componentIndex(name), npos) << name;
+    }
+
+    size_t nv = reactor.neq();
+    size_t nref = refReactor.neq();
+    vector_fp y(nv), ydot(nv), yref(nref), ydotRef(nref);
+    reactor.getState(y.data());
+    refReactor.getState(yref.data());
+    reactor.updateState(y.data());
+    refReactor.updateState(yref.data());
+    reactor.evalEqs(0.0, y.data(), ydot.data(), nullptr);
+    refReactor.evalEqs(0.0, yref.data(), ydotRef.data(), nullptr);
+
+    size_t nSpeciesComponents = 0;
+    for (size_t i = 0; i < nv; i++) {
+        std::string name = reactor.componentName(i);
+        EXPECT_EQ(reactor.componentIndex(name), i) << name;
+        size_t j = refReactor.componentIndex(name);
+        ASSERT_NE(j, npos) << name;
+        EXPECT_DOUBLE_EQ(y[i], yref[j]) << name;
+        EXPECT_NEAR(ydot[i], ydotRef[j], 1e-8 * std::abs(ydotRef[j]) + 1e-20)
+            << name;
+        if (sol->thermo()->speciesIndex(name) != npos) {
+            nSpeciesComponents++;
+        }
+    }
+    EXPECT_EQ(nSpeciesComponents, kk - qssNames.size());
+}
+
+//! Set up a free flame domain with an inlet and an outlet, and evaluate the
+//! residual of the initial guess
+struct FreeFlame
+{
+    FreeFlame(bool qssBeforeSetup) {
+        std::string X = "CH4:0.095, O2:0.19, N2:0.715";
+        sol = newSolution("gri30.yaml", "", "Mix");
+        sol->thermo()->setState_TPX(300.0, OneAtm, X);
+        if (qssBeforeSetup) {
+            setQuasiSteadySpecies(*sol, qssNames);
+        }
+        gas = std::dynamic_pointer_cast<IdealGasPhase>(sol->thermo());
+        flow.reset(new StFlow(gas.get(), gas->nSpecies(), 10));
+        flow->setFreeFlow();
+        flow->setKinetics(*sol->kinetics());
+        flow->setTransport(*sol->transport());
+        flow->setPressure(OneAtm);
+        if (!qssBeforeSetup) {
+            // The flame keeps all species in its solution vector
+            setQuasiSteadySpecies(*sol, qssNames);
+        }
+        vector_fp z(10);
+        for (size_t j = 0; j < 10; j++) {
+            z[j] = 0.003 * j;
+        }
+        flow->setupGrid(10, z.data());
+        inlet.setMoleFractions(X);
+        inlet.setMdot(0.4);
+        inlet.setTemperature(300.0);
+
+        std::vector<Domain1D*> domains{&inlet, flow.get(), &outlet};
+        sim.reset(new Sim1D(domains));
+        vector_fp locs{0.0, 0.3, 0.6, 1.0};
+        std::map<std::string, vector_fp> guess{
+            {"T", {300.0, 600.0, 1800.0, 2000.0}},
+            {"velocity", {0.4, 0.6, 1.5, 1.7}},
+            {"CH4", {0.05, 0.03, 0.003, 0.003}},
+            {"O2", {0.22, 0.12, 0.003, 0.003}},
+            {"N2", {0.72, 0.72, 0.72, 0.72}},
+            {"H2O", {0.0, 0.06, 0.12, 0.12}},
+            {"CO2", {0.0, 0.065, 0.13, 0.13}}};
+        for (auto name : {"CO", "OH", "H", "CH3"}) {
+            guess[name] = {0.0, 0.0015, 0.003, 0.003};
+        }
+        for (auto& item : guess) {
+            sim->setInitialGuess(item.first, locs, item.second);
+        }
+        residual.resize(sim->size());
+        sim->getResidual(0.0, residual.data());
+    }
+
+    double flowResidual(size_t n, size_t j) const {
+        return residual[flow->loc() + flow->index(n, j)];
+    }
+
+    shared_ptr<Solution> sol;
+    shared_ptr<IdealGasPhase> gas;
+    std::unique_ptr<StFlow> flow;
+    Inlet1D inlet;
+    Outlet1D outlet;
+    std::unique_ptr<Sim1D> sim;
+    vector_fp residual;
+};
+
+}
+
+TEST(QuasiSteadySpecies, ReactorComponents)
+{
+    compareReactors<Reactor>();
+    compareReactors<IdealGasReactor>();
+    compareReactors<ConstPressureReactor>();
+    compareReactors<IdealGasConstPressureReactor>();
+}
+
+TEST(QuasiSteadySpecies, FlameComponents)
+{
+    FreeFlame flame(true);
+    FreeFlame ref(false);
+    StFlow& flow = *flame.flow;
+    StFlow& refFlow = *ref.flow;
+    size_t kk = flame.gas->nSpecies();
+    ASSERT_EQ(flow.nStateSpecies(), kk - qssNames.size());
+    ASSERT_EQ(flow.nComponents(), refFlow.nComponents() - qssNames.size());
+
+    for (size_t n = 0; n < flow.nStateSpecies(); n++) {
+        size_t k = flow.stateSpecies(n);
+        EXPECT_EQ(flow.componentName(c_offset_Y + n), flame.gas->speciesName(k));
+        EXPECT_EQ(flow.speciesComponent(k), c_offset_Y + n);
+    }
+    for (auto& name : qssNames) {
+        size_t k = flame.gas->speciesIndex(name);
+        EXPECT_EQ(flow.speciesComponent(k), npos) << name;
+        EXPECT_THROW(flow.componentIndex(name), CanteraError) << name;
+    }
+
+    // Only the species components are added to the refinement criteria
+    for (size_t n = 0; n < flow.nComponents(); n++) {
+        EXPECT_EQ(flow.refiner().active(n), refFlow.refiner().active(n))
+            << flow.componentName(n);
+    }
+
+    // The residuals of the remaining components match those of a flame which
+    // keeps the QSS species in its solution vector
+    for (size_t j = 0; j < flow.nPoints(); j++) {
+        for (size_t n = 0; n < flow.nComponents(); n++) {
+            size_t m = refFlow.componentIndex(flow.componentName(n));
+            double r = ref.flowResidual(m, j);
+            EXPECT_NEAR(flame.flowResidual(n, j), r, 1e-8 * std::abs(r) + 1e-14)
+                << flow.componentName(n) << " at point " << j;
+        }
+    }
+}
+
+TEST(QuasiSteadySpecies, FlameExcessSpecies)
+{
+    // The first species of the mechanism is the default excess species at the
+    // boundaries, and needs to be replaced if it is quasi-steady
+    auto sol = newSolution("gri30.yaml", "", "None");
+    auto gas = std::dynamic_pointer_cast<IdealGasPhase>(sol->thermo());
+    setQuasiSteadySpecies(*sol, {gas->speciesName(0)});
+    StFlow flow(gas.get(), gas->nSpecies(), 5);
+    flow.setKinetics(*sol->kinetics());
+    EXPECT_NE(flow.speciesComponent(flow.leftExcessSpecies()), npos);
+    EXPECT_NE(flow.speciesComponent(flow.rightExcessSpecies()), npos);
+}
+
+}
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+
+namespace Cantera
+{
+
+TEST(GasKinetics, RateTables)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto sol2 = newSolution("gri30.yaml");
+    auto ref = newSolution("gri30.yaml");
+    auto& kin = dynamic_cast<GasKinetics&>(*sol->kinetics());
+    auto& kin2 = dynamic_cast<GasKinetics&>(*sol2->kinetics());
+    ThermoPhase& thermo = *sol->thermo();
+    size_t nr = kin.nReactions();
+    size_t kk = thermo.nSpecies();
+    std::string X = "CH4:0.08, O2:0.18, N2:0.6, H2O:0.05, CO2:0.02, CO:0.01, "
+                    "H2:0.005, H:1e-3, OH:1e-3, O:1e-3, CH3:1e-4, HO2:1e-5";
+    kin.enableRateTables(300.0, 3000.0, 1e-7);
+    ASSERT_TRUE(kin.rateTable());
+
+    vector_fp kf(nr), kfref(nr), kc(nr), kcref(nr), wdot(kk), wref(kk);
+    for (double T : {300.0, 412.3, 999.9, 1000.1, 1873.2, 2999.7, 3500.0}) {
+        thermo.setState_TPX(T, 2 * OneAtm, X);
+        ref->thermo()->setState_TPX(T, 2 * OneAtm, X);
+        kin.getFwdRateConstants(kf.data());
+        ref->kinetics()->getFwdRateConstants(kfref.data());
+        kin.getEquilibriumConstants(kc.data());
+        ref->kinetics()->getEquilibriumConstants(kcref.data());
+        kin.getNetProductionRates(wdot.data());
+        ref->kinetics()->getNetProductionRates(wref.data());
+        // Values are calculated directly outside of the table
+        double rtol = (T > 3000) ? 1e-14 : 2e-7;
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_NEAR(kf[i], kfref[i], rtol * kfref[i]) << T << ", " << i;
+            EXPECT_NEAR(kc[i], kcref[i], rtol * kcref[i]) << T << ", " << i;
+        }
+        double scale = 0.0;
+        for (size_t k = 0; k < kk; k++) {
+            scale = std::max(scale, std::abs(wref[k]));
+        }
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(wdot[k], wref[k], 1e-5 * std::abs(wref[k]) + 1e-10 * scale)
+                << T << ", " << thermo.speciesName(k);
+        }
+    }
+
+    // Kinetics managers for the same mechanism share the table
+    kin2.enableRateTables(300.0, 3000.0, 1e-7);
+    EXPECT_EQ(kin.rateTable().get(), kin2.rateTable().get());
+    kin2.setMultiplier(0, 2.0);
+    kin2.enableRateTables(300.0, 3000.0, 1e-7);
+    EXPECT_EQ(kin.rateTable().get(), kin2.rateTable().get());
+
+    // The table is discarded when the mechanism is modified
+    kin2.modifyReaction(0, kin2.reaction(0));
+    EXPECT_FALSE(kin2.rateTable());
+    kin.disableRateTables();
+    EXPECT_FALSE(kin.rateTable());
+
+    // Size of the table with the default tolerance
+    kin.enableRateTables();
+    auto table = kin.rateTable();
+    EXPECT_EQ(table->nSegments(), 5u);
+    EXPECT_EQ(table->nIntervals(), 240u);
+    double bytes = 8.0 * table->nValues()
+                   * (table->nIntervals() + table->nSegments());
+    EXPECT_NEAR(bytes, 1.4e6, 0.05e6);
+}
+
+}
@@ -4,6 +4,9 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/FalloffMgr.h"
+#include "cantera/base/Array.h"
+#include "cantera/base/Solution.h"
 
 namespace Cantera
 {
@@ -142,6 +145,30 @@ TEST_F(FracCoeffTest, EquilibriumConstants)
     EXPECT_NEAR(exp(-deltaG0_1/RT) * pow(pRef/RT, -0.5), Kc[1], 1e-13 * Kc[1]);
 }
 
+TEST(GasKinetics, EquilibriumConstants)
+{
+    auto sol = newSolution("gri30.yaml");
+    auto& kin = *sol->kinetics();
+    ThermoPhase& thermo = *sol->thermo();
+    size_t nr = kin.nReactions();
+    thermo.setState_TPX(1500.0, 3 * OneAtm, "CH4:1, O2:2, N2:7, H:0.01");
+    vector_fp rop1(nr), rop2(nr), kc(nr), dG(nr);
+    kin.getNetRatesOfProgress(rop1.data());
+    kin.getEquilibriumConstants(kc.data());
+    kin.getNetRatesOfProgress(rop2.data());
+    kin.getDeltaSSGibbs(dG.data());
+    double logC0 = std::log(thermo.standardConcentration());
+    for (size_t i = 0; i < nr; i++) {
+        double dn = 0.0;
+        for (size_t k = 0; k < thermo.nSpecies(); k++) {
+            dn += kin.productStoichCoeff(k, i) - kin.reactantStoichCoeff(k, i);
+        }
+        double kc_ref = std::exp(-dG[i] / thermo.RT() + dn * logC0);
+        EXPECT_NEAR(kc[i], kc_ref, 1e-12 * kc_ref) << "reaction " << i;
+        EXPECT_DOUBLE_EQ(rop1[i], rop2[i]) << "reaction " << i;
+    }
+}
+
 class NegativePreexponentialFactor : public testing::Test
 {
 public:
@@ -210,4 +237,342 @@ TEST(InterfaceReaction, CoverageDependency) {
     EXPECT_NEAR(kf[1], 3.7e20 * exp(-(67.4e6-6e6*0.3)/(GasConstant*T)), 1e-14*kf[1]);
 }
 
+TEST(Rate1, ArrheniusScattered)
+{
+    std::vector<Arrhenius> rates {
+        Arrhenius(3.5e13, 0.0, 8000.0), Arrhenius(-2.0e8, 1.5, 120.0),
+        Arrhenius(1.2e17, -1.0, 0.0), Arrhenius(0.0, 2.0, 1000.0)
+    };
+    std::vector<size_t> rxns {1, 4, 5, 7};
+    Rate1<Arrhenius> mgr;
+    for (size_t i = 0; i < rates.size(); i++) {
+        mgr.install(rxns[i], rates[i]);
+    }
+    mgr.replace(5, Arrhenius(2.4e16, -0.8, 50.0));
+    rates[2] = Arrhenius(2.4e16, -0.8, 50.0);
+
+    double T = 1234.0;
+    vector_fp values(8, -1.0);
+    mgr.update(T, std::log(T), values.data());
+    for (size_t i = 0; i < rates.size(); i++) {
+        double k = rates[i].updateRC(std::log(T), 1.0/T);
+        EXPECT_NEAR(values[rxns[i]], k, 1e-14 * std::abs(k));
+    }
+    EXPECT_DOUBLE_EQ(values[0], -1.0);
+    EXPECT_DOUBLE_EQ(values[6], -1.0);
+}
+
+TEST(Rate1, ArrheniusContiguous)
+{
+    Rate1<Arrhenius> mgr;
+    std::vector<Arrhenius> rates;
+    for (size_t i = 0; i < 11; i++) {
+        rates.emplace_back(1e10 * (i + 1), 0.1 * i, 500.0 * i);
+        mgr.install(i, rates.back());
+    }
+    double T = 800.0;
+    vector_fp values(rates.size());
+    mgr.update(T, std::log(T), values.data());
+    for (size_t i = 0; i < rates.size(); i++) {
+        double k = rates[i].updateRC(std::log(T), 1.0/T);
+        EXPECT_NEAR(values[i], k, 1e-14 * k);
+    }
+}
+
+TEST(StoichManagerN, ProductsAndProductionRates)
+{
+    StoichManagerN mgr;
+    mgr.add(0, {2});
+    mgr.add(1, {0, 1});
+    mgr.add(2, {2, 1}, {1.0, 2.0}, {1.0, 2.0});
+    mgr.add(3, {0, 2}, {0.5, 1.5});
+
+    vector_fp conc {2.0, -0.5, 3.0};
+    vector_fp R(4, 1.0);
+    mgr.multiply(conc.data(), R.data());
+    EXPECT_DOUBLE_EQ(R[0], 3.0);
+    EXPECT_DOUBLE_EQ(R[1], -1.0);
+    EXPECT_DOUBLE_EQ(R[2], 0.0); // two negative concentrations
+    EXPECT_DOUBLE_EQ(R[3], std::sqrt(2.0) * std::pow(3.0, 1.5));
+
+    R = {1.0, 2.0, 3.0, 4.0};
+    vector_fp S(3, 1.0);
+    mgr.incrementSpecies(R.data(), S.data());
+    EXPECT_DOUBLE_EQ(S[0], 1.0 + 2.0 + 4.0);
+    EXPECT_DOUBLE_EQ(S[1], 1.0 + 2.0 + 2 * 3.0);
+    EXPECT_DOUBLE_EQ(S[2], 1.0 + 1.0 + 3.0 + 4.0);
+    mgr.decrementSpecies(R.data(), S.data());
+    EXPECT_DOUBLE_EQ(S[0], 1.0);
+    EXPECT_DOUBLE_EQ(S[1], 1.0);
+    EXPECT_DOUBLE_EQ(S[2], 1.0);
+
+    vector_fp dG(4, 0.0);
+    mgr.incrementReactions(conc.data(), dG.data());
+    EXPECT_DOUBLE_EQ(dG[1], 1.5);
+    EXPECT_DOUBLE_EQ(dG[2], 2.0);
+
+    // multi-state versions match the single-state versions
+    size_t n = 3;
+    vector_fp concN(3*n), RN(4*n, 1.0), SN(3*n, 0.0);
+    for (size_t k = 0; k < 3; k++) {
+        for (size_t j = 0; j < n; j++) {
+            concN[k*n + j] = conc[k] + 0.4*j;
+        }
+    }
+    mgr.multiply(concN.data(), RN.data(), n);
+    EXPECT_THROW(mgr.incrementSpecies(RN.data(), SN.data(), n), CanteraError);
+    mgr.finalize(3);
+    mgr.incrementSpecies(RN.data(), SN.data(), n);
+
+    // single-reaction versions match the versions for all reactions
+    vector_fp RN2(4*n, 1.0), SN2(3*n, 0.0);
+    for (size_t i = 0; i < 4; i++) {
+        mgr.multiply(i, concN.data(), &RN2[i*n], n);
+        mgr.incrementSpecies(i, &RN2[i*n], SN2.data(), n);
+    }
+    for (size_t m = 0; m < 4*n; m++) {
+        EXPECT_DOUBLE_EQ(RN2[m], RN[m]);
+    }
+    for (size_t m = 0; m < 3*n; m++) {
+        EXPECT_DOUBLE_EQ(SN2[m], SN[m]);
+    }
+
+    for (size_t j = 0; j < n; j++) {
+        vector_fp c1(3), R1(4, 1.0), S1(3, 0.0);
+        for (size_t k = 0; k < 3; k++) {
+            c1[k] = concN[k*n + j];
+        }
+        mgr.multiply(c1.data(), R1.data());
+        mgr.incrementSpecies(R1.data(), S1.data());
+        for (size_t i = 0; i < 4; i++) {
+            EXPECT_DOUBLE_EQ(RN[i*n + j], R1[i]);
+        }
+        for (size_t k = 0; k < 3; k++) {
+            EXPECT_DOUBLE_EQ(SN[k*n + j], S1[k]);
+        }
+    }
+}
+
+TEST(ThirdBodyCalc, EnhancedConcentrations)
+{
+    ThirdBodyCalc calc;
+    calc.install(1, {{0, 2.5}, {2, 0.0}});
+    calc.install(3, {}, 0.0);
+    calc.install(4, {{1, 6.0}});
+    ASSERT_EQ(calc.workSize(), (size_t) 3);
+
+    vector_fp conc {0.5, 0.25, 0.125};
+    double ctot = 0.875;
+    vector_fp M(3);
+    calc.update(conc, ctot, M.data());
+    EXPECT_DOUBLE_EQ(M[0], 2.5 * 0.5 + 0.25);
+    EXPECT_DOUBLE_EQ(M[1], 0.0);
+    EXPECT_DOUBLE_EQ(M[2], 0.5 + 6.0 * 0.25 + 0.125);
+
+    vector_fp R(5, 2.0);
+    calc.multiply(R.data(), M.data());
+    EXPECT_DOUBLE_EQ(R[0], 2.0);
+    EXPECT_DOUBLE_EQ(R[1], 2.0 * M[0]);
+    EXPECT_DOUBLE_EQ(R[3], 0.0);
+    EXPECT_DOUBLE_EQ(R[4], 2.0 * M[2]);
+
+    // multi-state versions match the single-state versions
+    size_t n = 4;
+    vector_fp concN(3*n), ctotN(n), MN(3*n), RN(5*n, 2.0);
+    for (size_t j = 0; j < n; j++) {
+        ctotN[j] = 0.0;
+        for (size_t k = 0; k < 3; k++) {
+            concN[k*n + j] = conc[k] * (1.0 + j) + 0.1 * k;
+            ctotN[j] += concN[k*n + j];
+        }
+    }
+    calc.update(concN.data(), ctotN.data(), MN.data(), n);
+    calc.multiply(RN.data(), MN.data(), n);
+    for (size_t j = 0; j < n; j++) {
+        vector_fp c1(3), M1(3), R1(5, 2.0);
+        for (size_t k = 0; k < 3; k++) {
+            c1[k] = concN[k*n + j];
+        }
+        calc.update(c1, ctotN[j], M1.data());
+        calc.multiply(R1.data(), M1.data());
+        for (size_t i = 0; i < 3; i++) {
+            EXPECT_DOUBLE_EQ(MN[i*n + j], M1[i]);
+        }
+        for (size_t i = 0; i < 5; i++) {
+            EXPECT_DOUBLE_EQ(RN[i*n + j], R1[i]);
+        }
+    }
+}
+
+TEST(FalloffMgr, GroupedEvaluation)
+{
+    std::vector<shared_ptr<Falloff>> funcs {
+        newFalloff("Troe", {0.7346, 94.0, 1756.0, 5182.0}),
+        newFalloff("Simple", {}),
+        newFalloff("SRI", {0.45, 797.0, 979.0, 1.2, 0.1}),
+        newFalloff("Troe", {0.562, 91.0, 5836.0}),
+        newFalloff("SRI", {1.1, 700.0, 0.0}),
+    };
+    vector_int types {FALLOFF_RXN, FALLOFF_RXN, FALLOFF_RXN, CHEMACT_RXN,
+                      CHEMACT_RXN};
+    FalloffMgr mgr;
+    for (size_t i = 0; i < funcs.size(); i++) {
+        mgr.install(i, types[i], funcs[i]);
+    }
+
+    // Compare with evaluating each falloff function separately
+    auto check = [&](double T) {
+        vector_fp work(mgr.workSize());
+        mgr.updateTemp(T, work.data());
+        vector_fp pr {0.0, 0.3, 2.0, 1e-3, 40.0};
+        vector_fp values = pr;
+        mgr.pr_to_falloff(values.data(), work.data());
+        for (size_t i = 0; i < funcs.size(); i++) {
+            vector_fp w(funcs[i]->workSize());
+            funcs[i]->updateTemp(T, w.data());
+            double F = funcs[i]->F(pr[i], w.data());
+            double expected = (types[i] == FALLOFF_RXN) ? pr[i] * F / (1 + pr[i])
+                                                        : F / (1 + pr[i]);
+            EXPECT_NEAR(values[i], expected, 1e-14 * std::abs(expected))
+                << "reaction " << i << " at T = " << T;
+        }
+    };
+    check(300.0);
+    check(1800.0);
+
+    // Replacing a function by one of a different type changes the groups
+    funcs[1] = newFalloff("Troe", {0.5, 100.0, 1000.0});
+    mgr.replace(1, funcs[1]);
+    funcs[2] = newFalloff("Simple", {});
+    mgr.replace(2, funcs[2]);
+    check(1200.0);
+}
+
+TEST(Rate1, PlogGroupedPressures)
+{
+    std::vector<Plog> plogs {
+        Plog({{1e3, {1e10, 0.5, 1000.0}}, {1e5, {2e12, 0.0, 1500.0}},
+              {1e5, {-3e11, 0.2, 2000.0}}, {1e7, {5e13, -0.5, 1200.0}}}),
+        Plog({{1e3, {3e8, 1.0, 500.0}}, {1e5, {4e9, 0.8, 800.0}},
+              {1e7, {1e11, 0.3, 900.0}}}),
+        Plog({{5e4, {7e10, 0.1, 300.0}}}),
+        Plog({{2e4, {1e11, 0.0, 100.0}}, {2e6, {1e12, 0.0, 4000.0}}}),
+    };
+    std::vector<size_t> rxns {5, 0, 3, 2};
+    Rate1<Plog> mgr;
+    for (size_t i = 0; i < plogs.size(); i++) {
+        mgr.install(rxns[i], plogs[i]);
+    }
+    // replacing a rate keeps the other reactions unchanged
+    plogs[3] = Plog({{2e4, {1e11, 0.0, 100.0}}, {1e5, {1e10, 0.0, 10.0}},
+                     {2e6, {1e12, 0.0, 4000.0}}});
+    mgr.replace(2, plogs[3]);
+
+    for (double P : {10.0, 1e3, 2e4, 3.3e4, 1e5, 8e5, 1e7, 1e9, 5e4}) {
+        double logP = std::log(P);
+        mgr.update_C(&logP);
+        for (double T : {500.0, 1500.0}) {
+            vector_fp values(6, -1.0);
+            mgr.update(T, std::log(T), values.data());
+            EXPECT_EQ(values[1], -1.0);
+            EXPECT_EQ(values[4], -1.0);
+            for (size_t i = 0; i < plogs.size(); i++) {
+                plogs[i].update_C(&logP);
+                double k = plogs[i].updateRC(std::log(T), 1.0/T);
+                EXPECT_NEAR(values[rxns[i]], k, 1e-13 * k)
+                    << "reaction " << i << " at P = " << P << ", T = " << T;
+            }
+        }
+    }
+}
+
+TEST(Rate1, ChebyshevGroups)
+{
+    auto coeffs = [](size_t nT, size_t nP, double offset) {
+        Array2D c(nT, nP);
+        for (size_t t = 0; t < nT; t++) {
+            for (size_t p = 0; p < nP; p++) {
+                c(t, p) = offset + 0.5 / (1.0 + t + 2*p) - 0.1 * t * p;
+            }
+        }
+        return c;
+    };
+    std::vector<ChebyshevRate> rates {
+        ChebyshevRate(290, 3000, 1000, 1e7, coeffs(6, 4, 8.0)),
+        ChebyshevRate(290, 3000, 1000, 1e7, coeffs(6, 4, 10.0)),
+        ChebyshevRate(300, 2000, 1e3, 1e6, coeffs(3, 2, 9.0)),
+        ChebyshevRate(290, 3000, 1000, 1e7, coeffs(6, 4, 7.5)),
+        ChebyshevRate(290, 3000, 1000, 1e7, coeffs(1, 1, 12.0)),
+    };
+    std::vector<size_t> rxns {4, 1, 0, 7, 6};
+    Rate1<ChebyshevRate> mgr;
+    for (size_t i = 0; i < rates.size(); i++) {
+        mgr.install(rxns[i], rates[i]);
+    }
+    // replacement with a different range moves the reaction to another group
+    rates[3] = ChebyshevRate(300, 2000, 1e3, 1e6, coeffs(3, 2, 6.0));
+    mgr.replace(7, rates[3]);
+
+    for (double P : {2e3, 1e5, 8e6}) {
+        double log10P = std::log10(P);
+        mgr.update_C(&log10P);
+        for (double T : {400.0, 1800.0}) {
+            vector_fp values(8, -1.0);
+            mgr.update(T, std::log(T), values.data());
+            for (size_t i = 0; i < rates.size(); i++) {
+                rates[i].update_C(&log10P);
+                double k = rates[i].updateRC(std::log(T), 1.0/T);
+                EXPECT_NEAR(values[rxns[i]], k, 1e-13 * k)
+                    << "reaction " << i << " at P = " << P << ", T = " << T;
+            }
+            EXPECT_EQ(values[2], -1.0);
+        }
+    }
+}
+
+TEST(Rate1, SurfaceArrheniusCoverages)
+{
+    std::vector<SurfaceArrhenius> rates {
+        SurfaceArrhenius(3.7e20, 0.0, 8000.0),
+        SurfaceArrhenius(1.2e13, 0.5, 12000.0),
+        SurfaceArrhenius(-4.0e9, -1.0, 0.0),
+        SurfaceArrhenius(5.0e17, 0.0, 15000.0),
+    };
+    rates[0].addCoverageDependence(1, 0.0, 0.0, -700.0);
+    rates[1].addCoverageDependence(0, 0.5, -1.0, 300.0);
+    rates[1].addCoverageDependence(3, -0.2, 0.0, 0.0);
+    rates[1].addCoverageDependence(0, 0.0, 0.5, 100.0); // repeated species
+    rates[3].addCoverageDependence(2, 0.0, 1.0, 0.0);
+    std::vector<size_t> rxns {3, 0, 5, 1};
+    Rate1<SurfaceArrhenius> mgr;
+    for (size_t i = 0; i < rates.size(); i++) {
+        mgr.install(rxns[i], rates[i]);
+    }
+    rates[2].addCoverageDependence(1, 0.1, 0.0, -250.0);
+    mgr.replace(5, rates[2]);
+
+    std::vector<vector_fp> coverages {
+        {0.5, 0.2, 0.2, 0.1}, {0.0, 0.9, 0.05, 0.05}, {0.25, 0.25, 0.25, 0.25}
+    };
+    for (auto& theta : coverages) {
+        mgr.update_C(theta.data());
+        for (double T : {500.0, 1100.0}) {
+            vector_fp values(6, -1.0);
+            mgr.update(T, std::log(T), values.data());
+            for (size_t i = 0; i < rates.size(); i++) {
+                rates[i].update_C(theta.data());
+                double k = rates[i].updateRC(std::log(T), 1.0/T);
+                EXPECT_NEAR(values[rxns[i]], k, 1e-13 * std::abs(k))
+                    << "reaction " << i << " at T = " << T;
+                EXPECT_NEAR(mgr.effectiveActivationEnergy_R(i),
+                            rates[i].activationEnergy_R(), 1e-10);
+                EXPECT_NEAR(mgr.effectivePreExponentialFactor(i),
+                            rates[i].preExponentialFactor(),
+                            1e-13 * std::abs(rates[i].preExponentialFactor()));
+            }
+            EXPECT_EQ(values[2], -1.0);
+        }
+    }
+}
+
 }
@@ -0,0 +1,121 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/Reaction.h"
+
+namespace Cantera
+{
+
+TEST(GasKinetics, ReactionOrder)
+{
+    // The rates are evaluated with the reactions in an internal order, grouped
+    // by rate type and reversibility, which must not affect the results for
+    // the reactions in the order in which they are added
+    auto sol = newSolution("gri30.yaml");
+    auto& kin = *sol->kinetics();
+    ThermoPhase& thermo = *sol->thermo();
+    AnyMap extra = AnyMap::fromYamlString(
+        "reactions:\n"
+        "- {equation: CH3 + OH (+M) <=> CH2O + H2 (+M),\n"
+        "   units: {length: cm, quantity: mol},\n"
+        "   type: chemically-activated,\n"
+        "   high-P-rate-constant: [5.88E-14, 6.721, -3022.227],\n"
+        "   low-P-rate-constant: [282320.078, 1.46878, -3270.56495]}\n"
+        "- {equation: H2 + O2 => 2 OH, rate-constant: {A: 1.7e10, b: 0,\n"
+        "   Ea: 4.8e4}}\n"
+        "- equation: H + CH4 <=> CH3 + H2\n"
+        "  type: pressure-dependent-Arrhenius\n"
+        "  rate-constants:\n"
+        "  - {P: 0.039474 atm, A: 2.720000e+09, b: 1.2, Ea: 6834.0}\n"
+        "  - {P: 1.0 atm, A: 1.230000e+04, b: 2.68, Ea: 6335.0}\n"
+        "  - {P: 10.0 atm, A: 1.680000e+16, b: -0.6, Ea: 14754.0}\n"
+        "- equation: CH4 <=> CH3 + H\n"
+        "  type: Chebyshev\n"
+        "  temperature-range: [290, 3000]\n"
+        "  pressure-range: [0.0098692326671601278 atm, 98.692326671601279 atm]\n"
+        "  data: [[-1.44280e+01,  2.59970e-01, -2.24320e-02, -2.78700e-03],\n"
+        "         [ 2.20630e+01,  4.88090e-01, -3.96430e-02, -5.48110e-03],\n"
+        "         [-2.32940e-01,  4.01900e-01, -2.60730e-02, -5.04860e-03]]\n");
+    for (const auto& rxn : extra["reactions"].asVector<AnyMap>()) {
+        kin.addReaction(newReaction(rxn, kin));
+    }
+    size_t nr = kin.nReactions();
+    size_t kk = thermo.nSpecies();
+
+    // the same reactions in reverse order, except for the first reaction
+    GasKinetics kin2(&thermo);
+    kin2.init();
+    for (size_t i = nr - 1; i > 0; i--) {
+        kin2.addReaction(kin.reaction(i));
+    }
+
+    vector_fp kf(nr), kf2(nr), rop(nr), rop2(nr), wdot(kk), wdot2(kk);
+    thermo.setState_TPX(1200.0, 2 * OneAtm, "CH4:0.08, O2:0.18, N2:0.6, "
+                        "H2O:0.05, H2:0.01, H:1e-3, OH:1e-3, CH3:1e-4");
+    kin2.getFwdRateConstants(kf2.data());
+
+    // add a reaction after the rates have been evaluated
+    kin2.addReaction(kin.reaction(0));
+    kin.setMultiplier(0, 0.5);
+    kin2.setMultiplier(nr - 1, 0.5);
+    for (double T : {900.0, 1500.0}) {
+        thermo.setState_TP(T, 3 * OneAtm);
+        kin.getFwdRateConstants(kf.data());
+        kin2.getFwdRateConstants(kf2.data());
+        kin.getNetRatesOfProgress(rop.data());
+        kin2.getNetRatesOfProgress(rop2.data());
+        kin.getNetProductionRates(wdot.data());
+        kin2.getNetProductionRates(wdot2.data());
+        for (size_t i = 0; i < nr; i++) {
+            size_t i2 = (i == 0) ? nr - 1 : nr - 1 - i;
+            EXPECT_DOUBLE_EQ(kf[i], kf2[i2]) << kin.reactionString(i);
+            EXPECT_DOUBLE_EQ(rop[i], rop2[i2]) << kin.reactionString(i);
+        }
+        double scale = 0.0;
+        for (size_t k = 0; k < kk; k++) {
+            scale = std::max(scale, std::abs(wdot[k]));
+        }
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(wdot[k], wdot2[k], 1e-14 * scale)
+                << thermo.speciesName(k);
+        }
+    }
+
+    // Derivatives of the rates of progress
+    vector_fp drop(nr), drop2(nr);
+    kin.getNetRatesOfProgress_ddT(drop.data());
+    kin2.getNetRatesOfProgress_ddT(drop2.data());
+    Eigen::SparseMatrix<double> jac = kin.netRatesOfProgress_ddC();
+    Eigen::SparseMatrix<double> jac2 = kin2.netRatesOfProgress_ddC();
+    for (size_t i = 0; i < nr; i++) {
+        size_t i2 = (i == 0) ? nr - 1 : nr - 1 - i;
+        EXPECT_NEAR(drop[i], drop2[i2], 1e-12 * std::abs(drop[i]))
+            << kin.reactionString(i);
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_DOUBLE_EQ(jac.coeff(i, k), jac2.coeff(i2, k))
+                << kin.reactionString(i) << ", " << thermo.speciesName(k);
+        }
+    }
+
+    // Multiple states
+    vector_fp T{1000.0, 1800.0}, P{OneAtm, 5 * OneAtm}, Y(2 * kk);
+    thermo.getMassFractions(Y.data());
+    thermo.getMassFractions(Y.data() + kk);
+    vector_fp wdots(2 * kk);
+    kin2.getNetProductionRates(2, T.data(), P.data(), Y.data(), wdots.data());
+    for (size_t j = 0; j < 2; j++) {
+        thermo.setState_TPY(T[j], P[j], Y.data() + j * kk);
+        kin.getNetProductionRates(wdot.data());
+        double scale = 0.0;
+        for (size_t k = 0; k < kk; k++) {
+            scale = std::max(scale, std::abs(wdot[k]));
+        }
+        for (size_t k = 0; k < kk; k++) {
+            EXPECT_NEAR(wdots[j * kk + k], wdot[k], 1e-12 * scale)
+                << thermo.speciesName(k);
+        }
+    }
+}
+
+}
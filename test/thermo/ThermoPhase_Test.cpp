@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/utilities.h"
 #include <vector>
 
 namespace Cantera
@@ -75,6 +76,229 @@ TEST_F(TestThermoMethods, setState_nan)
     EXPECT_THROW(thermo->setState_TR(555, nan), CanteraError);
 }
 
+TEST(ThermoPhase, getReferenceProperties)
+{
+    // Ideal gas, phases based on VPStandardStateTP, and a phase using the
+    // default implementation
+    std::vector<shared_ptr<ThermoPhase>> phases {
+        shared_ptr<ThermoPhase>(newPhase("h2o2.xml")),
+        shared_ptr<ThermoPhase>(newPhase("thermo-models.yaml", "IdealSolnGas-liquid")),
+        shared_ptr<ThermoPhase>(newPhase("thermo-models.yaml", "ideal-molal-aqueous")),
+        shared_ptr<ThermoPhase>(newPhase("thermo-models.yaml", "HMW-NaCl-HKFT")),
+        shared_ptr<ThermoPhase>(newPhase("thermo-models.yaml", "CO2-RK"))
+    };
+    vector_fp T{300.0, 350.0, 299.0, 400.0, 500.0};
+    for (auto& phase : phases) {
+        size_t kk = phase->nSpecies();
+        size_t nT = T.size();
+        vector_fp cp(nT * kk), h(nT * kk), s(nT * kk), g(nT * kk);
+        double T0 = phase->temperature();
+        double P0 = phase->pressure();
+        double h0 = phase->enthalpy_mole();
+        phase->getReferenceProperties(nT, T.data(), cp.data(), h.data(),
+                                      s.data(), g.data());
+        EXPECT_DOUBLE_EQ(phase->temperature(), T0);
+        EXPECT_DOUBLE_EQ(phase->pressure(), P0);
+        EXPECT_DOUBLE_EQ(phase->enthalpy_mole(), h0);
+
+        vector_fp cp1(kk), h1(kk), s1(kk), g1(kk);
+        for (size_t i = 0; i < nT; i++) {
+            phase->setState_TP(T[i], P0);
+            phase->getCp_R_ref(cp1.data());
+            phase->getEnthalpy_RT_ref(h1.data());
+            phase->getEntropy_R_ref(s1.data());
+            phase->getGibbs_RT_ref(g1.data());
+            // Properties from HKFT standard states depend slightly on the
+            // initial guess for the water density
+            for (size_t k = 0; k < kk; k++) {
+                size_t j = i * kk + k;
+                EXPECT_NEAR(cp[j], cp1[k], 1e-12 * std::abs(cp1[k]))
+                    << phase->name();
+                EXPECT_NEAR(h[j], h1[k], 1e-12 * std::abs(h1[k]))
+                    << phase->name();
+                EXPECT_NEAR(s[j], s1[k], 1e-12 * std::abs(s1[k]))
+                    << phase->name();
+                EXPECT_NEAR(g[j], g1[k], 1e-12 * std::abs(g1[k]))
+                    << phase->name();
+            }
+        }
+    }
+}
+
+TEST(ThermoPhase, saveRestoreState)
+{
+    // Phases with mass fractions, mole fractions (lattice), pressure (condensed)
+    // and no composition (pure fluid) in the native state
+    std::vector<shared_ptr<ThermoPhase>> phases {
+        shared_ptr<ThermoPhase>(newPhase("h2o2.xml")),
+        shared_ptr<ThermoPhase>(newPhase("thermo-models.yaml", "Li7Si3-interstitial")),
+        shared_ptr<ThermoPhase>(newPhase("thermo-models.yaml", "IdealSolidSolnPhase")),
+        shared_ptr<ThermoPhase>(newPhase("thermo-models.yaml", "nitrogen"))
+    };
+    for (auto& phase : phases) {
+        vector_fp state0, state1;
+        phase->saveState(state0);
+        ASSERT_EQ(state0.size(), phase->stateSize());
+        double h0 = phase->enthalpy_mass();
+
+        // Restoring the current state leaves the phase untouched
+        int n = phase->stateMFNumber();
+        phase->restoreState(state0);
+        EXPECT_EQ(phase->stateMFNumber(), n) << phase->name();
+
+        phase->setState_TP(1.1 * phase->temperature(), 2 * phase->pressure());
+        if (!phase->isPure()) {
+            vector_fp X(phase->nSpecies(), 1.0);
+            phase->setMoleFractions(X.data());
+        }
+        phase->saveState(state1);
+        phase->restoreState(state0);
+        EXPECT_NE(phase->stateMFNumber(), n) << phase->name();
+        EXPECT_DOUBLE_EQ(phase->enthalpy_mass(), h0) << phase->name();
+        vector_fp state2;
+        phase->saveState(state2);
+        for (size_t i = 0; i < state0.size(); i++) {
+            EXPECT_DOUBLE_EQ(state2[i], state0[i]) << phase->name();
+        }
+        phase->restoreState(state1);
+        EXPECT_DOUBLE_EQ(phase->temperature(), state1[0]) << phase->name();
+    }
+}
+
+TEST(ThermoPhase, setTemperature_HorU)
+{
+    std::vector<shared_ptr<ThermoPhase>> phases {
+        shared_ptr<ThermoPhase>(newPhase("h2o2.xml")),
+        shared_ptr<ThermoPhase>(newPhase("thermo-models.yaml", "CO2-RK"))
+    };
+    phases[0]->setState_TPX(1200, OneAtm, "H2:2, O2:1, AR:5");
+    phases[1]->setState_TP(350, 50 * OneAtm);
+    for (auto& phase : phases) {
+        double T0 = phase->temperature();
+        double P0 = phase->pressure();
+        double rho0 = phase->density();
+        double u0 = phase->intEnergy_mass();
+        double h0 = phase->enthalpy_mass();
+
+        // Starting close to the solution requires only a few iterations
+        phase->setTemperature(1.001 * T0);
+        int n = phase->setTemperature_HorU(u0, 1e-14, true);
+        EXPECT_LE(n, 3) << phase->name();
+        EXPECT_NEAR(phase->temperature(), T0, 1e-12 * T0) << phase->name();
+        EXPECT_DOUBLE_EQ(phase->density(), rho0) << phase->name();
+
+        phase->setState_TP(1.001 * T0, P0);
+        n = phase->setTemperature_HorU(h0, 1e-14, false);
+        EXPECT_LE(n, 3) << phase->name();
+        EXPECT_NEAR(phase->temperature(), T0, 1e-12 * T0) << phase->name();
+        EXPECT_DOUBLE_EQ(phase->pressure(), P0) << phase->name();
+
+        // Large changes in temperature are still found
+        phase->setState_TP(T0 + 200, P0);
+        phase->setTemperature_HorU(h0, 1e-14, false);
+        EXPECT_NEAR(phase->temperature(), T0, 1e-12 * T0) << phase->name();
+    }
+}
+
+TEST(ThermoPhase, getTemperatures_HPorUV)
+{
+    // Ideal gases with NASA polynomials having the same and different
+    // midpoint temperatures, an ideal gas with NASA9 polynomials, and a phase
+    // using the default implementation
+    std::vector<shared_ptr<ThermoPhase>> phases {
+        shared_ptr<ThermoPhase>(newPhase("h2o2.xml")),
+        shared_ptr<ThermoPhase>(newPhase("nDodecane_Reitz.yaml", "nDodecane_IG")),
+        shared_ptr<ThermoPhase>(newPhase("airNASA9.yaml")),
+        shared_ptr<ThermoPhase>(newPhase("thermo-models.yaml", "CO2-RK"))
+    };
+    for (auto& phase : phases) {
+        size_t kk = phase->nSpecies();
+        size_t n = 40;
+        vector_fp Y(n * kk), h(n), u(n), P(n), v(n), T(n), Tguess(n);
+        // Start from a gas-like state so that the density solver for the
+        // Redlich-Kwong phase finds all of the test states
+        phase->setState_TP(1000, OneAtm);
+        for (size_t j = 0; j < n; j++) {
+            double sum = 0.0;
+            for (size_t k = 0; k < kk; k++) {
+                Y[j * kk + k] = 1 + (j * 7 + k * 3) % 11;
+                sum += Y[j * kk + k];
+            }
+            scale(&Y[j * kk], &Y[(j + 1) * kk], &Y[j * kk], 1.0 / sum);
+            T[j] = 300 + 2500.0 * j / n;
+            P[j] = OneAtm * (1 + j % 3);
+            phase->setMassFractions(&Y[j * kk]);
+            phase->setState_TP(T[j], P[j]);
+            h[j] = phase->enthalpy_mass();
+            u[j] = phase->intEnergy_mass();
+            v[j] = 1.0 / phase->density();
+            Tguess[j] = T[j] + ((j % 2) ? 30.0 : -250.0 * j / n);
+        }
+        double T0 = phase->temperature();
+        double P0 = phase->pressure();
+
+        vector_fp Thp = Tguess;
+        auto failed = phase->getTemperatures_HP(n, h.data(), P.data(),
+                                                Y.data(), Thp.data(), 1e-12);
+        EXPECT_TRUE(failed.empty()) << phase->name();
+        vector_fp Tuv = Tguess;
+        failed = phase->getTemperatures_UV(n, u.data(), v.data(), Y.data(),
+                                           Tuv.data(), 1e-12);
+        EXPECT_TRUE(failed.empty()) << phase->name();
+        EXPECT_DOUBLE_EQ(phase->temperature(), T0) << phase->name();
+        EXPECT_DOUBLE_EQ(phase->pressure(), P0) << phase->name();
+        for (size_t j = 0; j < n; j++) {
+            EXPECT_NEAR(Thp[j], T[j], 1e-10 * T[j]) << phase->name();
+            EXPECT_NEAR(Tuv[j], T[j], 1e-10 * T[j]) << phase->name();
+        }
+
+        // Ideal gases with NASA polynomials use a separate solver
+        if (phase->type() == "IdealGas"
+            && phase->speciesThermo().allNasaPoly()) {
+            // Initial guesses outside of the temperature range are moved into
+            // the range before the first evaluation
+            for (size_t j = 0; j < n; j++) {
+                Thp[j] = (j % 2) ? 1e300 : 1.0;
+            }
+            failed = phase->getTemperatures_HP(n, h.data(), P.data(),
+                                               Y.data(), Thp.data(), 1e-12);
+            EXPECT_TRUE(failed.empty()) << phase->name();
+            for (size_t j = 0; j < n; j++) {
+                EXPECT_NEAR(Thp[j], T[j], 1e-10 * T[j]) << phase->name();
+            }
+
+            // Changes to the heats of formation are taken into account
+            phase->modifyOneHf298SS(0, phase->Hf298SS(0) + 1e7);
+            for (size_t j = 0; j < n; j++) {
+                phase->setMassFractions(&Y[j * kk]);
+                phase->setState_TP(T[j], P[j]);
+                h[j] = phase->enthalpy_mass();
+            }
+            Thp = Tguess;
+            failed = phase->getTemperatures_HP(n, h.data(), P.data(),
+                                               Y.data(), Thp.data(), 1e-12);
+            EXPECT_TRUE(failed.empty()) << phase->name();
+            for (size_t j = 0; j < n; j++) {
+                EXPECT_NEAR(Thp[j], T[j], 1e-10 * T[j]) << phase->name();
+            }
+        }
+
+        // States with an invalid enthalpy or pressure are reported, and the
+        // initial guess is kept
+        h[1] = std::numeric_limits<double>::quiet_NaN();
+        P[2] = -1.0;
+        Thp = Tguess;
+        failed = phase->getTemperatures_HP(3, h.data(), P.data(), Y.data(),
+                                           Thp.data());
+        ASSERT_EQ(failed.size(), (size_t) 2) << phase->name();
+        EXPECT_EQ(failed[0], (size_t) 1) << phase->name();
+        EXPECT_EQ(failed[1], (size_t) 2) << phase->name();
+        EXPECT_NEAR(Thp[0], T[0], 1e-8 * T[0]) << phase->name();
+        EXPECT_DOUBLE_EQ(Thp[1], Tguess[1]) << phase->name();
+        EXPECT_DOUBLE_EQ(Thp[2], Tguess[2]) << phase->name();
+    }
+}
+
 TEST_F(TestThermoMethods, setState_AnyMap)
 {
     AnyMap state;
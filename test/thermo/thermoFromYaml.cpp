@@ -419,6 +419,9 @@ TEST(ThermoFromYaml, Lattice)
         EXPECT_NEAR(mu[k], mu_ref[k], 1e-7*fabs(mu_ref[k]));
         EXPECT_NEAR(vol[k], vol_ref[k], 1e-7);
     }
+
+    // The lattice phases are not kept, so the phase cannot be copied
+    EXPECT_THROW(newPhase(*thermo), CanteraError);
 }
 
 TEST(ThermoFromYaml, Lattice_fromString)
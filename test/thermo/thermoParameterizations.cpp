@@ -106,6 +106,52 @@ TEST_F(SpeciesThermoInterpTypeTest, install_shomate)
     EXPECT_DOUBLE_EQ(p2.cp_mass(), p.cp_mass());
 }
 
+TEST_F(SpeciesThermoInterpTypeTest, install_mixed_nasa)
+{
+    // NASA polynomials for species which are not consecutive, evaluated from
+    // the packed coefficients in MultiSpeciesThermo
+    auto sO2 = make_shared<Species>("O2", parseCompString("O:2"));
+    auto sH2 = make_shared<Species>("H2", parseCompString("H:2"));
+    auto sH2O = make_shared<Species>("H2O", parseCompString("H:2 O:1"));
+    auto sCO2 = make_shared<Species>("CO2", parseCompString("C:1 O:2"));
+    sO2->thermo.reset(new NasaPoly2(200, 3500, 101325, o2_nasa_coeffs));
+    sH2->thermo.reset(new ConstCpPoly(200, 5000, 101325, c_h2));
+    sH2O->thermo.reset(new NasaPoly2(200, 3500, 101325, h2o_nasa_coeffs));
+    sCO2->thermo.reset(new ShomatePoly2(200, 6000, 101325, co2_shomate_coeffs));
+    p.addSpecies(sO2);
+    p.addSpecies(sH2);
+    p.addSpecies(sH2O);
+    p.addSpecies(sCO2);
+    p.initThermo();
+
+    auto& spthermo = p.speciesThermo();
+    auto check = [&]() {
+        for (double T : {300.0, 999.0, 1000.0, 1001.0, 2500.0}) {
+            double cp[4], h[4], s[4];
+            spthermo.update(T, cp, h, s);
+            for (size_t k = 0; k < 4; k++) {
+                double cp1, h1, s1;
+                p.species(k)->thermo->updatePropertiesTemp(T, &cp1, &h1, &s1);
+                EXPECT_DOUBLE_EQ(cp1, cp[k]) << k << " " << T;
+                EXPECT_DOUBLE_EQ(h1, h[k]) << k << " " << T;
+                EXPECT_DOUBLE_EQ(s1, s[k]) << k << " " << T;
+            }
+        }
+    };
+    check();
+
+    p.modifyOneHf298SS(2, -2.5e8);
+    EXPECT_NEAR(p.Hf298SS(2), -2.5e8, 1e-3);
+    check();
+    p.resetHf298(2);
+    check();
+
+    auto sH2O_mod = make_shared<Species>("H2O", parseCompString("H:2 O:1"));
+    sH2O_mod->thermo.reset(new NasaPoly2(200, 3500, 101325, o2_nasa_coeffs));
+    p.modifySpecies(2, sH2O_mod);
+    check();
+}
+
 TEST(Shomate, modifyOneHf298)
 {
     ShomatePoly2 S(200, 6000, 101325, co2_shomate_coeffs);